@@ -71,6 +71,7 @@ typedef struct
  * @brief 	: THIS FUNCTION INITIALIZES DS1307 MODULE THROUGH I2C COMMUNICATION
  * @param 	: Copy_I2CConfig => A POINTER TO STRUCTURE HOLDING I2C CONFIGURATION INFO
  * @return	: ERROR STATUS
+ * @note	: THE BUS IS SHARED THROUGH I2CBUS , OTHER DEVICES ON IT CAN BE INITIALIZED WITH THE SAME CONFIGURATION
  */
 ERRORS_t HDS1307_eInit( I2C_Config_t * Copy_I2CConfig ) ;
 
@@ -32,6 +32,8 @@
 
 #define DS1307_HOUR_REG_MASK		0x1F
 
+#define DS1307_BUS_PRIORITY			I2CBUS_PRIORITY_LOW
+
 typedef enum
 {
 	DS1307_SEC = 0  ,
@@ -48,6 +50,15 @@ typedef enum
  *==============================================================================================================================================*/
 
 
+/**
+ * @fn 		: _eRunRequest(void)
+ * @brief 	: THIS FUNCTION SUBMITS THE PREPARED DS1307 REQUEST TO THE BUS & WAITS FOR IT TO END
+ *
+ * @return	: ERROR STATUS , OK ONLY IF THE TRANSACTION ENDED WITH I2C_TRANSFER_DONE
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY , THE REQUEST BUFFERS CAN LIVE ON THE CALLER STACK SINCE IT WAITS
+ */
+static ERRORS_t _eRunRequest( void ) ;
+
 /**
  * @fn 		: _u8SingleBinaryToBCD(uint8_t)
  * @brief 	: THIS FUNCTION CONVERTS FROM BINARY TO BCD FOR A SINGLE DECIMAL NUMBER
@@ -24,6 +24,8 @@
 
 #include "../../../MCAL/I2C/Inc/I2C_Interface.h"
 
+#include "../../I2CBUS/Inc/I2CBUS_Interface.h"
+
 #include "../Inc/DS1307_Config.h"
 #include "../Inc/DS1307_Interface.h"
 #include "../Inc/DS1307_Prv.h"
@@ -31,7 +33,10 @@
 /*==============================================================================================================================================
  * GLOBAL SECTION
  *==============================================================================================================================================*/
-I2C_Config_t * I2CCONFIG  ;
+static I2C_t DS1307_I2CNumber ;
+
+/* BELONGS TO THE BUS WHILE ITS STATUS IS I2C_TRANSFER_BUSY */
+static I2CBUS_Request_t DS1307_Request ;
 
 /*==============================================================================================================================================
  * IMPLEMENTATION SECTION
@@ -42,16 +47,20 @@ I2C_Config_t * I2CCONFIG  ;
  * @brief 	: THIS FUNCTION INITIALIZES DS1307 MODULE THROUGH I2C COMMUNICATION
  * @param 	: Copy_I2CConfig => A POINTER TO STRUCTURE HOLDING I2C CONFIGURATION INFO
  * @return	: ERROR STATUS
+ * @note	: THE BUS IS SHARED THROUGH I2CBUS , OTHER DEVICES ON IT CAN BE INITIALIZED WITH THE SAME CONFIGURATION
  */
 ERRORS_t HDS1307_eInit( I2C_Config_t * Copy_pI2CConfig )
 {
 	ERRORS_t Local_ErrorStatus = OK ;
 
-	/* INITIALIZE I2C CONFIGURATION GLOBALLY */
-	I2CCONFIG = Copy_pI2CConfig ;
+	/* INITIALIZE THE SHARED BUS */
+	Local_ErrorStatus = HI2CBUS_eInit( Copy_pI2CConfig ) ;
 
-	/* INITIALIZE I2C PERIPHERAL */
-	Local_ErrorStatus = MI2C_eInit( Copy_pI2CConfig );
+	/* KEEP BUS NUMBER GLOBALLY */
+	if( Local_ErrorStatus == OK )
+	{
+		DS1307_I2CNumber = Copy_pI2CConfig->I2CNumber ;
+	}
 
 	return Local_ErrorStatus ;
 }
@@ -72,20 +81,26 @@ ERRORS_t HDS1307_eWriteData( DS1307_Config_t * Copy_pDS1307Config )
 	/* Length of Data to Send to DS1307 Module */
 	uint8_t Local_u8DataLength ;
 
+	/* Previous Transaction Not Over Yet ( Called From an Interrupt ) , Its Request is Still in Use */
+	if( DS1307_Request.Transfer.Status == I2C_TRANSFER_BUSY )
+	{
+		return NOK ;
+	}
+
 	/* Converting DS1307 Config Structure into Array of Data */
 	Local_ErrorStatus = _eAllBinaryToBCD( Copy_pDS1307Config, Local_u8Data, &Local_u8DataLength ) ;
 
 	if( Local_ErrorStatus != NOK )
 	{
 		/* RIGHT VALUES */
-		/* Send Start Condition , DS1307 Address with Write */
-		MI2C_eSendStartCondition( I2CCONFIG , DEVICE_ADDRESS , I2C_RW_BIT_WRITE ) ;
-
-		/* Send Array of Time / Date Configuration to DS1307 Module */
-		MI2C_eMasterWriteData( I2CCONFIG, Local_u8Data, Local_u8DataLength) ;
-
-		/* Send Stop Condition */
-		MI2C_vSendStopCondition( I2CCONFIG);
+		/* Start , DS1307 Address with Write , Array of Time / Date Configuration , Stop */
+		DS1307_Request.Transfer.SlaveAddress = DEVICE_ADDRESS ;
+		DS1307_Request.Transfer.TxBuffer = Local_u8Data ;
+		DS1307_Request.Transfer.TxSize = Local_u8DataLength ;
+		DS1307_Request.Transfer.RxBuffer = NULL ;
+		DS1307_Request.Transfer.RxSize = 0 ;
+
+		Local_ErrorStatus = _eRunRequest( ) ;
 	}
 
 	return Local_ErrorStatus ;
@@ -107,25 +122,29 @@ ERRORS_t HDS1307_eReadData( DS1307_Config_t * Copy_pDS1307_DataToRead )
 	/* Array Holding Data Read From DS1307 Module */
 	uint8_t Local_u8ReadData[ DS1307_READ_ARR_SIZE ] = { 0 } ;
 
-	/* START THE PROCEDURE OF READING */
-
-	/* Send Start Condition , DS1307 Address with Write */
-	MI2C_eSendStartCondition( I2CCONFIG, DEVICE_ADDRESS , I2C_RW_BIT_WRITE ) ;
-
-	/* Send Word Address Byte to the Module */
-	MI2C_eMasterWriteData( I2CCONFIG, &Local_u8WordAddress, 1 ) ;
+	/* Previous Transaction Not Over Yet ( Called From an Interrupt ) , Its Request is Still in Use */
+	if( DS1307_Request.Transfer.Status == I2C_TRANSFER_BUSY )
+	{
+		return NOK ;
+	}
 
-	/* Send A Repeated Start to Change Direction to Read with the Same Address */
-	MI2C_eSendRepeatedStart( I2CCONFIG, DEVICE_ADDRESS ,  I2C_RW_BIT_READ ) ;
+	/* START THE PROCEDURE OF READING */
 
-	/* Read Data From DS1307 Module */
-	MI2C_eReadData( I2CCONFIG, Local_u8ReadData, DS1307_READ_ARR_SIZE ) ;
+	/* Start , DS1307 Address with Write , Word Address Byte ,
+	 * Repeated Start to Change Direction to Read with the Same Address , Data Bytes , Stop */
+	DS1307_Request.Transfer.SlaveAddress = DEVICE_ADDRESS ;
+	DS1307_Request.Transfer.TxBuffer = &Local_u8WordAddress ;
+	DS1307_Request.Transfer.TxSize = 1 ;
+	DS1307_Request.Transfer.RxBuffer = Local_u8ReadData ;
+	DS1307_Request.Transfer.RxSize = DS1307_READ_ARR_SIZE ;
 
-	/* Send Stop Condition */
-	MI2C_vSendStopCondition( I2CCONFIG ) ;
+	Local_ErrorStatus = _eRunRequest( ) ;
 
-	/* Convert Array of Data Read From DS1307 Module into Data in terms of DS1307 Structure */
-	Local_ErrorStatus = _eAllBCDToBinary( Copy_pDS1307_DataToRead , Local_u8ReadData ) ;
+	/* Convert Array of Data Read From DS1307 Module into Data in terms of DS1307 Structure , Only IF The Read Went Through */
+	if( Local_ErrorStatus == OK )
+	{
+		Local_ErrorStatus = _eAllBCDToBinary( Copy_pDS1307_DataToRead , Local_u8ReadData ) ;
+	}
 
 	return Local_ErrorStatus ;
 }
@@ -134,6 +153,40 @@ ERRORS_t HDS1307_eReadData( DS1307_Config_t * Copy_pDS1307_DataToRead )
  * PRIVATE FUNCTIONS SECTION
  *==============================================================================================================================================*/
 
+/**
+ * @fn 		: _eRunRequest(void)
+ * @brief 	: THIS FUNCTION SUBMITS THE PREPARED DS1307 REQUEST TO THE BUS & WAITS FOR IT TO END
+ *
+ * @return	: ERROR STATUS , OK ONLY IF THE TRANSACTION ENDED WITH I2C_TRANSFER_DONE
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY , THE REQUEST BUFFERS CAN LIVE ON THE CALLER STACK SINCE IT WAITS
+ */
+static ERRORS_t _eRunRequest( void )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	DS1307_Request.Priority = DS1307_BUS_PRIORITY ;
+	DS1307_Request.Mode = I2CBUS_MODE_IT ;
+	DS1307_Request.CallBack = NULL ;
+
+	Local_ErrorStatus = HI2CBUS_eSubmit( DS1307_I2CNumber , &DS1307_Request ) ;
+
+	if( Local_ErrorStatus == OK )
+	{
+		/* OTHER DEVICES ON THE BUS MAY RUN FIRST , A STUCK TRANSFER IS ENDED BY ITS DEADLINE */
+		while( DS1307_Request.Transfer.Status == I2C_TRANSFER_BUSY )
+		{
+			MI2C_eCheckTimeout( DS1307_I2CNumber ) ;
+		}
+
+		if( DS1307_Request.Transfer.Status != I2C_TRANSFER_DONE )
+		{
+			Local_ErrorStatus = NOK ;
+		}
+	}
+
+	return Local_ErrorStatus ;
+}
+
 /**
  * @fn 			: _eAllBinaryToBCD(DS1307_Config_t* , uint8_t* , uint8_t*)
  * @brief 		: THIS FUNCTION TRANSFERS THE WHOLE DS1307 CONFIG STRUCTURE INTO AN ARRAY TO SEND DIRECTLY TO DS1307 MODULE
@@ -37,6 +37,7 @@
  *
  * @param 	: I2CConfig		=> POINTER TO STRUCTURE HOLDING I2C CONFIGURATION INFO
  * @return	: ERROR STATUS
+ * @note	: THE BUS IS SHARED THROUGH I2CBUS , OTHER DEVICES ON IT CAN BE INITIALIZED WITH THE SAME CONFIGURATION
  */
 ERRORS_t HEEPROM_eInit( I2C_Config_t * I2CConfig ) ;
 
@@ -49,12 +50,13 @@ ERRORS_t HEEPROM_eInit( I2C_Config_t * I2CConfig ) ;
  * 										CHECK VALID MEMORY ADDRESSES @ADDRESS_LIMIT
  * @param 	: Copy_pu8DataBuffer	=> BUFFER HOLDING DATA TO WRITE STARTING FROM PROVIDED MEM ADDRESS
  * @param 	: Copy_u8BufferSize		=> SIZE OF DATA BUFFER
- * @return	: ERROR STATUS
+ * @return	: ERROR STATUS , NOK IF MORE THAN A PAGE IS REQUESTED OR THE BUS TRANSACTION FAILED
  * @note	: IF MEMORY ADDRESS PROVIDED IS A START OF A PAGE ( MULTIPLIES OF 16 ) FOR EX ( 0 , 0X10 , 0X20 , 0X30 , ... )
  * 								-> YOU CAN WRITE UP TO 16 BYTE IN THE SAME PAGE
  * 			  IF YOU PROVIDED MEMORY ADDRESS NOT AT START OF A PAGE & REQUESTED TO WRITE MORE THAN PAGE CAN HANDLE
  * 			  PAGE WILL ROLL OVER AND START FROM THE BEGINING OF THE PAGE
  * 			 -SO FOR NOW KEEP MAX SIZE TO WRITE 16 BYTES & PROVIDE ADDRESS MULTIPILES OF 16 ONLY ( PAGE START ADDRESS )
+ * 			  WORD ADDRESS & DATA ARE SENT AS ONE BUS TRANSACTION , THE FUNCTION WAITS FOR IT TO END
   NOTE 		: CAN SUPPORT MORE THAN 16 BYTES IN LATER VERSIONS
  */
 ERRORS_t HEEPROM_eWriteData( uint16_t Copy_u16MemAddress , uint8_t * Copy_pu8DataBuffer , uint8_t Copy_u8BufferSize ) ;
@@ -22,4 +22,21 @@
 
 #define EEPROM_WRITE_CYCLE_TIME 5U
 
+#define EEPROM_PAGE_SIZE		16U
+
+#define EEPROM_BUS_PRIORITY		I2CBUS_PRIORITY_MEDIUM
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: _eRunRequest(void)
+ * @brief 	: THIS FUNCTION SUBMITS THE PREPARED EEPROM REQUEST TO THE BUS & WAITS FOR IT TO END
+ *
+ * @return	: ERROR STATUS , OK ONLY IF THE TRANSACTION ENDED WITH I2C_TRANSFER_DONE
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static ERRORS_t _eRunRequest( void ) ;
+
 #endif /* INC_EEPROM_PRV_H_ */
@@ -38,6 +38,8 @@
 #include "../../../MCAL/I2C/Inc/I2C_Interface.h"
 #include "../../../MCAL/SYSTICK/Inc/SYSTICK_Interface.h"
 
+#include "../../I2CBUS/Inc/I2CBUS_Interface.h"
+
 #include "../Inc/EEPROM_Interface.h"
 #include "../Inc/EEPROM_Config.h"
 #include "../Inc/EEPROM_Prv.h"
@@ -45,7 +47,13 @@
 /* ======================================================================
  * GLOBALS SECTION
  * ====================================================================== */
-I2C_Config_t * I2C_CONFIG ;
+static I2C_t EEPROM_I2CNumber ;
+
+/* BELONGS TO THE BUS WHILE ITS STATUS IS I2C_TRANSFER_BUSY */
+static I2CBUS_Request_t EEPROM_Request ;
+
+/* WORD ADDRESS FOLLOWED BY ONE PAGE OF DATA , SENT AS ONE TRANSACTION */
+static uint8_t EEPROM_TxBuffer[ 1 + EEPROM_PAGE_SIZE ] ;
 
 /* ======================================================================
  * IMPLEMENTATION SECTION
@@ -57,16 +65,20 @@ I2C_Config_t * I2C_CONFIG ;
  *
  * @param 	: I2CConfig		=> POINTER TO STRUCTURE HOLDING I2C CONFIGURATION INFO
  * @return	: ERROR STATUS
+ * @note	: THE BUS IS SHARED THROUGH I2CBUS , OTHER DEVICES ON IT CAN BE INITIALIZED WITH THE SAME CONFIGURATION
  */
 ERRORS_t HEEPROM_eInit( I2C_Config_t * I2CConfig )
 {
 	ERRORS_t Local_ErrorStatus = OK ;
 
-	/* INITIALIZE I2C */
-	Local_ErrorStatus = MI2C_eInit(I2CConfig);
+	/* INITIALIZE THE SHARED BUS */
+	Local_ErrorStatus = HI2CBUS_eInit( I2CConfig ) ;
 
-	/* INITIALIZE POINTER TO STRUCT GLOBALLY */
-	I2C_CONFIG = I2CConfig ;
+	/* KEEP BUS NUMBER GLOBALLY */
+	if( Local_ErrorStatus == OK )
+	{
+		EEPROM_I2CNumber = I2CConfig->I2CNumber ;
+	}
 
 	return Local_ErrorStatus ;
 }
@@ -79,67 +91,50 @@ ERRORS_t HEEPROM_eInit( I2C_Config_t * I2CConfig )
  * 										CHECK VALID MEMORY ADDRESSES @ADDRESS_LIMIT
  * @param 	: Copy_pu8DataBuffer	=> BUFFER HOLDING DATA TO WRITE STARTING FROM PROVIDED MEM ADDRESS
  * @param 	: Copy_u8BufferSize		=> SIZE OF DATA BUFFER
- * @return	: ERROR STATUS
+ * @return	: ERROR STATUS , NOK IF MORE THAN A PAGE IS REQUESTED OR THE BUS TRANSACTION FAILED
  * @note	: IF MEMORY ADDRESS PROVIDED IS A START OF A PAGE ( MULTIPLIES OF 16 ) FOR EX ( 0 , 0X10 , 0X20 , 0X30 , ... )
  * 								-> YOU CAN WRITE UP TO 16 BYTE IN THE SAME PAGE
  * 			  IF YOU PROVIDED MEMORY ADDRESS NOT AT START OF A PAGE & REQUESTED TO WRITE MORE THAN PAGE CAN HANDLE
  * 			  PAGE WILL ROLL OVER AND START FROM THE BEGINING OF THE PAGE
  * 			 -SO FOR NOW KEEP MAX SIZE TO WRITE 16 BYTES & PROVIDE ADDRESS MULTIPILES OF 16 ONLY ( PAGE START ADDRESS )
+ * 			  WORD ADDRESS & DATA ARE SENT AS ONE BUS TRANSACTION , THE FUNCTION WAITS FOR IT TO END
   NOTE 		: CAN SUPPORT MORE THAN 16 BYTES IN LATER VERSIONS
  */
 ERRORS_t HEEPROM_eWriteData( uint16_t Copy_u16MemAddress , uint8_t * Copy_pu8DataBuffer , uint8_t Copy_u8BufferSize )
 {
-	ERRORS_t Local_ErrorStatus = OK ;
-
 	uint8_t Local_u8LoopCounter ;
 
 	uint8_t Local_u8MemBlock = (uint8_t)( Copy_u16MemAddress >> 8 ) ;
 
 	uint8_t Local_u8DeviceAddress = (uint8_t)( ( EEPROM_DEVICE_ADDRESS << 3 ) | ( EEPROM_MEM_DEVICE << 2 ) | ( Local_u8MemBlock )  ) ;
 
-	/* SEND START CONDITION , DEVICE ADDRESS( 1010 + A2 + BIT9 + BIT8 ) WITH WRITE */
-	Local_ErrorStatus = MI2C_eSendStartCondition( I2C_CONFIG , Local_u8DeviceAddress , I2C_RW_BIT_WRITE ) ;
-
-	/*CHECK*/
-	if( Local_ErrorStatus != OK )
+	if( ( NULL == Copy_pu8DataBuffer ) || ( Copy_u8BufferSize > EEPROM_PAGE_SIZE ) )
 	{
 		return NOK ;
 	}
 
-	/* SEND WORD ADDRESS */
-	Local_ErrorStatus = MI2C_eMasterWriteData( I2C_CONFIG , (uint8_t*)&Copy_u16MemAddress , 1 ) ;
-
-	/*CHECK*/
-	if( Local_ErrorStatus != OK )
+	/* PREVIOUS TRANSACTION NOT OVER YET , ITS BUFFER IS STILL IN USE */
+	if( EEPROM_Request.Transfer.Status == I2C_TRANSFER_BUSY )
 	{
 		return NOK ;
 	}
 
+	/* WORD ADDRESS FIRST THEN DATA BYTES */
+	EEPROM_TxBuffer[ 0 ] = (uint8_t)Copy_u16MemAddress ;
 
-	/* DELAY 1us */
-	SYSTICK_Delayus( 1u ) ;
-
-	/* SEND DATA BYTES */
 	for( Local_u8LoopCounter = 0 ; Local_u8LoopCounter < Copy_u8BufferSize ; Local_u8LoopCounter++ )
 	{
-		/* SEND BYTE BY BYTE */
-		Local_ErrorStatus = MI2C_eMasterWriteData(I2C_CONFIG, &Copy_pu8DataBuffer[ Local_u8LoopCounter ] , 1 ) ;
-
-		/*CHECK*/
-		if( Local_ErrorStatus != OK )
-		{
-			return NOK ;
-		}
-
-		/* DELAY 200us BETWEEN EACH DATA BYTE SENT */
-		SYSTICK_Delayus( 200u ) ;
+		EEPROM_TxBuffer[ 1 + Local_u8LoopCounter ] = Copy_pu8DataBuffer[ Local_u8LoopCounter ] ;
 	}
 
-	/* SEND STOP CONDITION */
-
-	MI2C_vSendStopCondition(I2C_CONFIG);
+	/* START , DEVICE ADDRESS( 1010 + A2 + BIT9 + BIT8 ) WITH WRITE , WORD ADDRESS , DATA , STOP */
+	EEPROM_Request.Transfer.SlaveAddress = Local_u8DeviceAddress ;
+	EEPROM_Request.Transfer.TxBuffer = EEPROM_TxBuffer ;
+	EEPROM_Request.Transfer.TxSize = (uint16_t)( 1 + Copy_u8BufferSize ) ;
+	EEPROM_Request.Transfer.RxBuffer = NULL ;
+	EEPROM_Request.Transfer.RxSize = 0 ;
 
-	return Local_ErrorStatus ;
+	return _eRunRequest( ) ;
 }
 
 
@@ -166,51 +161,70 @@ void HEEPROM_vWriteCycleDelay( void )
  */
 ERRORS_t HEEPROM_eReadData( uint16_t Copy_u16MemAddress , uint8_t * Copy_pu8ReadDataBuffer , uint8_t Copy_u8BufferSize )
 {
-	ERRORS_t Local_ErrorStatus = OK ;
-
 	/* GET BIT9 & BIT8 OF MEMORY ADDRESS */
 	uint8_t Local_u8MemBlock = (uint8_t)( Copy_u16MemAddress >> 8 ) ;
 
 	/* GET DEVICE ADDRES TO SEND */
 	uint8_t Local_u8DeviceAddress = (uint8_t)( ( EEPROM_DEVICE_ADDRESS << 3 ) | ( EEPROM_MEM_DEVICE << 2 ) | ( Local_u8MemBlock )  ) ;
 
-	/* SEND START CONDITION , DEVICE ADDRESS( 1010 + A2 + BIT9 + BIT8 ) WITH WRITE */
-	Local_ErrorStatus = MI2C_eSendStartCondition( I2C_CONFIG , Local_u8DeviceAddress , I2C_RW_BIT_WRITE ) ;
-
-	/*CHECK*/
-	if( Local_ErrorStatus != OK )
+	if( ( NULL == Copy_pu8ReadDataBuffer ) || ( 0 == Copy_u8BufferSize ) )
 	{
 		return NOK ;
 	}
 
-	/* SEND WORD ADDRESS */
-	Local_ErrorStatus = MI2C_eMasterWriteData( I2C_CONFIG , (uint8_t*)&Copy_u16MemAddress , 1 ) ;
-
-	/*CHECK*/
-	if( Local_ErrorStatus != OK )
+	/* PREVIOUS TRANSACTION NOT OVER YET , ITS BUFFER IS STILL IN USE */
+	if( EEPROM_Request.Transfer.Status == I2C_TRANSFER_BUSY )
 	{
 		return NOK ;
 	}
 
-	/* SEND REPEATED START , DEVICE ADDRESS ( 1010 + A2 + BIT9 + BIT8 ) WITH READ */
-	Local_ErrorStatus = MI2C_eSendRepeatedStart(I2C_CONFIG, Local_u8DeviceAddress , I2C_RW_BIT_READ ) ;
+	EEPROM_TxBuffer[ 0 ] = (uint8_t)Copy_u16MemAddress ;
 
-	if( Local_ErrorStatus != OK )
-	{
-		return NOK ;
-	}
+	/* START , DEVICE ADDRESS ( 1010 + A2 + BIT9 + BIT8 ) WITH WRITE , WORD ADDRESS ,
+	 * REPEATED START WITH READ , DATA BYTES , STOP */
+	EEPROM_Request.Transfer.SlaveAddress = Local_u8DeviceAddress ;
+	EEPROM_Request.Transfer.TxBuffer = EEPROM_TxBuffer ;
+	EEPROM_Request.Transfer.TxSize = 1 ;
+	EEPROM_Request.Transfer.RxBuffer = Copy_pu8ReadDataBuffer ;
+	EEPROM_Request.Transfer.RxSize = Copy_u8BufferSize ;
+
+	return _eRunRequest( ) ;
+}
 
-	/* READ DATA BYTES AND STORE THEM IN BUFFER FOR USER RETURN */
-	Local_ErrorStatus = MI2C_eReadData(I2C_CONFIG, Copy_pu8ReadDataBuffer, Copy_u8BufferSize) ;
+/* ======================================================================
+ * PRIVATE FUNCTIONS SECTION
+ * ====================================================================== */
 
-	/* CHECK */
-	if( Local_ErrorStatus != OK )
+/**
+ * @fn 		: _eRunRequest(void)
+ * @brief 	: THIS FUNCTION SUBMITS THE PREPARED EEPROM REQUEST TO THE BUS & WAITS FOR IT TO END
+ *
+ * @return	: ERROR STATUS , OK ONLY IF THE TRANSACTION ENDED WITH I2C_TRANSFER_DONE
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static ERRORS_t _eRunRequest( void )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	EEPROM_Request.Priority = EEPROM_BUS_PRIORITY ;
+	EEPROM_Request.Mode = I2CBUS_MODE_IT ;
+	EEPROM_Request.CallBack = NULL ;
+
+	Local_ErrorStatus = HI2CBUS_eSubmit( EEPROM_I2CNumber , &EEPROM_Request ) ;
+
+	if( Local_ErrorStatus == OK )
 	{
-		return NOK ;
-	}
+		/* OTHER DEVICES ON THE BUS MAY RUN FIRST , A STUCK TRANSFER IS ENDED BY ITS DEADLINE */
+		while( EEPROM_Request.Transfer.Status == I2C_TRANSFER_BUSY )
+		{
+			MI2C_eCheckTimeout( EEPROM_I2CNumber ) ;
+		}
 
-	/* SEND STOP CONDITION */
-	MI2C_vSendStopCondition(I2C_CONFIG);
+		if( EEPROM_Request.Transfer.Status != I2C_TRANSFER_DONE )
+		{
+			Local_ErrorStatus = NOK ;
+		}
+	}
 
 	return Local_ErrorStatus ;
 }
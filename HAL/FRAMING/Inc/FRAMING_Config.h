@@ -0,0 +1,21 @@
+/*
+ ******************************************************************************
+ * @file           : FRAMING_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : COBS PACKET FRAMING CONFIGURATION FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef FRAMING_INC_FRAMING_CONFIG_H_
+#define FRAMING_INC_FRAMING_CONFIG_H_
+
+/* MAXIMUM PAYLOAD LENGTH OF A SINGLE PACKET IN BYTES */
+#define FRAMING_MAX_PAYLOAD_SIZE	256U
+
+#endif /* FRAMING_INC_FRAMING_CONFIG_H_ */
@@ -0,0 +1,74 @@
+/*
+ ******************************************************************************
+ * @file           : FRAMING_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : COBS PACKET FRAMING INTERFACE FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef FRAMING_INC_FRAMING_INTERFACE_H_
+#define FRAMING_INC_FRAMING_INTERFACE_H_
+
+/* ======================================================================
+ * PLEASE READ THE FOLLOWING SPECIFICATIONS
+ * ====================================================================== */
+/**
+ *   @FRAME_FORMAT      : COBS( PAYLOAD + CRC16 ) + 0x00
+ *   @CRC               : CRC-16/CCITT-FALSE ( POLY 0x1021 , INIT 0xFFFF ) OVER THE PAYLOAD , SENT LITTLE ENDIAN
+ *   @DELIMITER         : 0x00 NEVER APPEARS INSIDE AN ENCODED FRAME , SO THE RECEIVER RESYNCHRONIZES ON THE NEXT 0x00
+ *   @TRANSPORT         : USART INTERRUPT DRIVEN TX & RX FIFOs ( USART_StartFifo )
+ *   @ZERO_COPY         : FRAMES ARE DECODED IN PLACE IN THE RECEIVE BUFFER & THE CALL BACK GETS A POINTER TO THE PAYLOAD INSIDE IT
+ *                        THE PAYLOAD IS VALID UNTIL THE CALL BACK RETURNS
+ */
+
+/* ======================================================================
+ * PROTOTYPES SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: HFRAMING_eInit(USART_Config_t*, void(*)(uint8_t*, uint16_t))
+ * @brief 	: THIS FUNCTION INITIALIZES THE USART & ITS FIFOs & SETS THE CALL BACK RECEIVING VERIFIED PACKETS
+ *
+ * @param 	: USARTConfig			=> POINTER TO STRUCTURE HOLDING USART CONFIGURATION INFO
+ * @param 	: Copy_pvPacketCallBack	=> CALL BACK INVOKED ONCE PER VERIFIED PACKET WITH ITS PAYLOAD & LENGTH
+ * @return	: ERROR STATUS
+ * @note	: THE USART IRQ MUST BE ENABLED IN THE NVIC
+ */
+ERRORS_t HFRAMING_eInit( USART_Config_t * USARTConfig , void ( * Copy_pvPacketCallBack )( uint8_t * Copy_pu8Payload , uint16_t Copy_u16Length ) ) ;
+
+/**
+ * @fn 		: HFRAMING_eSendPacket(const uint8_t*, uint16_t)
+ * @brief 	: THIS FUNCTION ENCODES A PACKET & STREAMS IT DIRECTLY INTO THE USART TX FIFO
+ *
+ * @param 	: Copy_pu8Payload	=> PACKET PAYLOAD
+ * @param 	: Copy_u16Length	=> PAYLOAD LENGTH 1 -> FRAMING_MAX_PAYLOAD_SIZE
+ * @return	: ERROR STATUS , NOK IF THE USART FIFO REJECTS A WRITE ( THE FRAME IS LEFT INCOMPLETE , THE RECEIVER DROPS IT )
+ * @note	: PAYLOAD RUNS ARE WRITTEN TO THE FIFO STRAIGHT FROM THE USER BUFFER , WAITS ONLY WHILE THE TX FIFO IS FULL
+ */
+ERRORS_t HFRAMING_eSendPacket( const uint8_t * Copy_pu8Payload , uint16_t Copy_u16Length ) ;
+
+/**
+ * @fn 		: HFRAMING_vProcess(void)
+ * @brief 	: THIS FUNCTION MOVES RECEIVED BYTES INTO THE RECEIVE BUFFER , DECODES COMPLETE FRAMES IN PLACE & INVOKES THE CALL BACK
+ *
+ * @note	: CALL IT PERIODICALLY FROM THE MAIN LOOP
+ */
+void HFRAMING_vProcess( void ) ;
+
+/**
+ * @fn 			: HFRAMING_eGetErrors(uint32_t*, uint32_t*)
+ * @brief 		: THIS FUNCTION RETURNS THE NUMBER OF FRAMES DROPPED SINCE INITIALIZATION
+ *
+ * @param[out] 	: Copy_pu32CRCErrors	=> RETURN FOR FRAMES HAVING A WRONG CRC
+ * @param[out] 	: Copy_pu32FrameErrors	=> RETURN FOR FRAMES HAVING A WRONG COBS ENCODING OR TOO LONG FOR THE RECEIVE BUFFER
+ * @return		: ERROR STATUS
+ */
+ERRORS_t HFRAMING_eGetErrors( uint32_t * Copy_pu32CRCErrors , uint32_t * Copy_pu32FrameErrors ) ;
+
+#endif /* FRAMING_INC_FRAMING_INTERFACE_H_ */
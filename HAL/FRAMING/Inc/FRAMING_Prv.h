@@ -0,0 +1,71 @@
+/*
+ ******************************************************************************
+ * @file           : FRAMING_Prv.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : COBS PACKET FRAMING PRIVATE FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef FRAMING_INC_FRAMING_PRV_H_
+#define FRAMING_INC_FRAMING_PRV_H_
+
+/*==============================================================================================================================================
+ * PRIVATE DEFINES
+ *==============================================================================================================================================*/
+
+#define FRAMING_DELIMITER			0x00
+
+#define FRAMING_CRC_SIZE			2U
+
+#define FRAMING_CRC_INIT			0xFFFF
+
+/* COBS CODE OF A FULL RUN ( 254 NON ZERO BYTES NOT FOLLOWED BY A ZERO ) */
+#define FRAMING_COBS_MAX_CODE		0xFF
+
+/* LARGEST ENCODED FRAME : DATA + ONE CODE BYTE EVERY 254 BYTES + FIRST CODE BYTE + DELIMITER */
+#define FRAMING_RX_BUFFER_SIZE		( FRAMING_MAX_PAYLOAD_SIZE + FRAMING_CRC_SIZE + ( ( FRAMING_MAX_PAYLOAD_SIZE + FRAMING_CRC_SIZE ) / 254U ) + 2U )
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS
+ *==============================================================================================================================================*/
+
+/**
+ * @fn 		: _u16CRC16Update(uint16_t, const uint8_t*, uint16_t)
+ * @brief 	: THIS FUNCTION UPDATES A CRC-16/CCITT-FALSE VALUE OVER A BUFFER ( HALF BYTE TABLE )
+ *
+ * @param 	: Copy_u16CRC		=> CRC VALUE SO FAR ( FRAMING_CRC_INIT AT START )
+ * @param 	: Copy_pu8Data		=> DATA BUFFER
+ * @param 	: Copy_u16Length	=> DATA LENGTH
+ * @return	: UPDATED CRC VALUE
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static uint16_t _u16CRC16Update( uint16_t Copy_u16CRC , const uint8_t * Copy_pu8Data , uint16_t Copy_u16Length ) ;
+
+/**
+ * @fn 		: _eWriteAll(const uint8_t*, uint16_t)
+ * @brief 	: THIS FUNCTION WRITES A BUFFER TO THE USART TX FIFO , WAITING ONLY WHILE THE FIFO IS FULL
+ *
+ * @param 	: Copy_pu8Data		=> DATA BUFFER
+ * @param 	: Copy_u16Length	=> DATA LENGTH
+ * @return	: OK , NOK IF THE USART FIFO REJECTS THE WRITE ( REMAINING BYTES ARE NOT SENT )
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static ERRORS_t _eWriteAll( const uint8_t * Copy_pu8Data , uint16_t Copy_u16Length ) ;
+
+/**
+ * @fn 		: _vHandleFrame(uint8_t*, uint16_t)
+ * @brief 	: THIS FUNCTION DECODES A COMPLETE FRAME IN PLACE , CHECKS ITS CRC & INVOKES THE PACKET CALL BACK
+ *
+ * @param 	: Copy_pu8Frame		=> FIRST BYTE OF THE FRAME INSIDE THE RECEIVE BUFFER
+ * @param 	: Copy_u16Length	=> ENCODED FRAME LENGTH WITHOUT THE DELIMITER
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vHandleFrame( uint8_t * Copy_pu8Frame , uint16_t Copy_u16Length ) ;
+
+#endif /* FRAMING_INC_FRAMING_PRV_H_ */
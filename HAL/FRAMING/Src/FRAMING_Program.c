@@ -0,0 +1,422 @@
+/*
+ ******************************************************************************
+ * @file           : FRAMING_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : COBS PACKET FRAMING MAIN PROGRAM FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/* ======================================================================
+ * INCLUDES SECTION
+ * ====================================================================== */
+
+#include <stdint.h>
+
+#include "../../../LIB/ErrType.h"
+#include "../../../LIB/STM32F446xx.h"
+
+#include "../../../MCAL/USART/Inc/USART_Interface.h"
+
+#include "../Inc/FRAMING_Interface.h"
+#include "../Inc/FRAMING_Config.h"
+#include "../Inc/FRAMING_Prv.h"
+
+/* ======================================================================
+ * GLOBALS SECTION
+ * ====================================================================== */
+
+/* CRC-16/CCITT HALF BYTE TABLE */
+static const uint16_t FRAMING_CRC_TABLE[ 16 ] =
+{
+	0x0000 , 0x1021 , 0x2042 , 0x3063 , 0x4084 , 0x50A5 , 0x60C6 , 0x70E7 ,
+	0x8108 , 0x9129 , 0xA14A , 0xB16B , 0xC18C , 0xD1AD , 0xE1CE , 0xF1EF
+};
+
+/* USART CARRYING THE FRAMES */
+static USART_Config_t * FRAMING_USART = NULL ;
+
+/* VERIFIED PACKETS CALL BACK */
+static void ( * FRAMING_PacketCallBack )( uint8_t * , uint16_t ) = NULL ;
+
+/* RECEIVE BUFFER , FRAMES ARE DECODED IN PLACE INSIDE IT */
+static uint8_t  FRAMING_RxBuffer[ FRAMING_RX_BUFFER_SIZE ] ;
+static uint16_t FRAMING_RxFill = 0 ;
+
+/* SET WHEN A FRAME OVERFLOWED THE RECEIVE BUFFER , ITS BYTES ARE SKIPPED UNTIL THE NEXT DELIMITER */
+static uint8_t  FRAMING_RxDiscard = 0 ;
+
+/* DROPPED FRAMES COUNTERS */
+static uint32_t FRAMING_CRCErrors = 0 ;
+static uint32_t FRAMING_FrameErrors = 0 ;
+
+/* ======================================================================
+ * IMPLEMENTATION SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: HFRAMING_eInit(USART_Config_t*, void(*)(uint8_t*, uint16_t))
+ * @brief 	: THIS FUNCTION INITIALIZES THE USART & ITS FIFOs & SETS THE CALL BACK RECEIVING VERIFIED PACKETS
+ *
+ * @param 	: USARTConfig			=> POINTER TO STRUCTURE HOLDING USART CONFIGURATION INFO
+ * @param 	: Copy_pvPacketCallBack	=> CALL BACK INVOKED ONCE PER VERIFIED PACKET WITH ITS PAYLOAD & LENGTH
+ * @return	: ERROR STATUS
+ * @note	: THE USART IRQ MUST BE ENABLED IN THE NVIC
+ */
+ERRORS_t HFRAMING_eInit( USART_Config_t * USARTConfig , void ( * Copy_pvPacketCallBack )( uint8_t * Copy_pu8Payload , uint16_t Copy_u16Length ) )
+{
+	if( USARTConfig == NULL || Copy_pvPacketCallBack == NULL )
+	{
+		return NULL_POINTER ;
+	}
+
+	/* INITIALIZE USART & START ITS INTERRUPT DRIVEN FIFOs */
+	if( USART_OK != USART_Init( USARTConfig ) || USART_OK != USART_StartFifo( USARTConfig ) )
+	{
+		return NOK ;
+	}
+
+	FRAMING_RxFill = 0 ;
+	FRAMING_RxDiscard = 0 ;
+	FRAMING_CRCErrors = 0 ;
+	FRAMING_FrameErrors = 0 ;
+
+	FRAMING_PacketCallBack = Copy_pvPacketCallBack ;
+
+	/* INITIALIZE POINTER TO STRUCT GLOBALLY */
+	FRAMING_USART = USARTConfig ;
+
+	return OK ;
+}
+
+/**
+ * @fn 		: HFRAMING_eSendPacket(const uint8_t*, uint16_t)
+ * @brief 	: THIS FUNCTION ENCODES A PACKET & STREAMS IT DIRECTLY INTO THE USART TX FIFO
+ *
+ * @param 	: Copy_pu8Payload	=> PACKET PAYLOAD
+ * @param 	: Copy_u16Length	=> PAYLOAD LENGTH 1 -> FRAMING_MAX_PAYLOAD_SIZE
+ * @return	: ERROR STATUS , NOK IF THE USART FIFO REJECTS A WRITE ( THE FRAME IS LEFT INCOMPLETE , THE RECEIVER DROPS IT )
+ * @note	: PAYLOAD RUNS ARE WRITTEN TO THE FIFO STRAIGHT FROM THE USER BUFFER , WAITS ONLY WHILE THE TX FIFO IS FULL
+ */
+ERRORS_t HFRAMING_eSendPacket( const uint8_t * Copy_pu8Payload , uint16_t Copy_u16Length )
+{
+	uint8_t Local_u8CRC[ FRAMING_CRC_SIZE ] ;
+
+	uint8_t Local_u8Code ;
+
+	uint8_t Local_u8Delimiter = FRAMING_DELIMITER ;
+
+	uint16_t Local_u16CRC ;
+
+	uint16_t Local_u16Position = 0 ;
+
+	uint16_t Local_u16Run ;
+
+	uint16_t Local_u16Total = (uint16_t)( Copy_u16Length + FRAMING_CRC_SIZE ) ;
+
+	if( Copy_pu8Payload == NULL )
+	{
+		return NULL_POINTER ;
+	}
+
+	if( FRAMING_USART == NULL || Copy_u16Length == 0 || Copy_u16Length > FRAMING_MAX_PAYLOAD_SIZE )
+	{
+		return NOK ;
+	}
+
+	/* CRC TRAILER ( LITTLE ENDIAN ) , ENCODED AS IF IT FOLLOWS THE PAYLOAD */
+	Local_u16CRC = _u16CRC16Update( FRAMING_CRC_INIT , Copy_pu8Payload , Copy_u16Length ) ;
+
+	Local_u8CRC[ 0 ] = (uint8_t)( Local_u16CRC ) ;
+	Local_u8CRC[ 1 ] = (uint8_t)( Local_u16CRC >> 8 ) ;
+
+	while( 1 )
+	{
+		/* MEASURE THE NEXT RUN OF NON ZERO BYTES ( 254 MAXIMUM ) */
+		for( Local_u16Run = 0 ; ( Local_u16Position + Local_u16Run ) < Local_u16Total && Local_u16Run < ( FRAMING_COBS_MAX_CODE - 1U ) ; Local_u16Run++ )
+		{
+			uint16_t Local_u16Index = (uint16_t)( Local_u16Position + Local_u16Run ) ;
+
+			if( ( ( Local_u16Index < Copy_u16Length ) ? Copy_pu8Payload[ Local_u16Index ] : Local_u8CRC[ Local_u16Index - Copy_u16Length ] ) == 0 )
+			{
+				break ;
+			}
+		}
+
+		/* SEND CODE BYTE THEN THE RUN ITSELF , PAYLOAD PART STRAIGHT FROM THE USER BUFFER */
+		Local_u8Code = (uint8_t)( Local_u16Run + 1U ) ;
+
+		if( OK != _eWriteAll( &Local_u8Code , 1 ) )
+		{
+			return NOK ;
+		}
+
+		if( Local_u16Position < Copy_u16Length )
+		{
+			uint16_t Local_u16PayloadPart = ( ( Local_u16Position + Local_u16Run ) <= Copy_u16Length ) ? Local_u16Run : (uint16_t)( Copy_u16Length - Local_u16Position ) ;
+
+			if( OK != _eWriteAll( &Copy_pu8Payload[ Local_u16Position ] , Local_u16PayloadPart ) ||
+					OK != _eWriteAll( Local_u8CRC , (uint16_t)( Local_u16Run - Local_u16PayloadPart ) ) )
+			{
+				return NOK ;
+			}
+		}
+		else if( OK != _eWriteAll( &Local_u8CRC[ Local_u16Position - Copy_u16Length ] , Local_u16Run ) )
+		{
+			return NOK ;
+		}
+
+		Local_u16Position += Local_u16Run ;
+
+		if( Local_u16Position == Local_u16Total )
+		{
+			break ;
+		}
+
+		/* RUN ENDED BY A ZERO ( NOT BY MAXIMUM LENGTH ) , ZERO IS IMPLIED BY THE CODE BYTE */
+		if( Local_u16Run < ( FRAMING_COBS_MAX_CODE - 1U ) )
+		{
+			Local_u16Position++ ;
+
+			/* DATA ENDS WITH A ZERO , AN EMPTY RUN ( CODE 0x01 ) CARRIES IT */
+			if( Local_u16Position == Local_u16Total )
+			{
+				Local_u8Code = 1 ;
+
+				if( OK != _eWriteAll( &Local_u8Code , 1 ) )
+				{
+					return NOK ;
+				}
+
+				break ;
+			}
+		}
+	}
+
+	/* FRAME DELIMITER */
+	return _eWriteAll( &Local_u8Delimiter , 1 ) ;
+}
+
+/**
+ * @fn 		: HFRAMING_vProcess(void)
+ * @brief 	: THIS FUNCTION MOVES RECEIVED BYTES INTO THE RECEIVE BUFFER , DECODES COMPLETE FRAMES IN PLACE & INVOKES THE CALL BACK
+ *
+ * @note	: CALL IT PERIODICALLY FROM THE MAIN LOOP
+ */
+void HFRAMING_vProcess( void )
+{
+	uint16_t Local_u16ReadLength = 0 ;
+
+	uint16_t Local_u16End ;
+
+	uint16_t Local_u16Scan ;
+
+	uint16_t Local_u16FrameStart ;
+
+	uint16_t Local_u16Counter ;
+
+	if( FRAMING_USART == NULL )
+	{
+		return ;
+	}
+
+	do
+	{
+		/* RECEIVE DIRECTLY AFTER THE BYTES ALREADY BUFFERED */
+		USART_FifoRead( FRAMING_USART->USART_Number , &FRAMING_RxBuffer[ FRAMING_RxFill ] , (uint16_t)( FRAMING_RX_BUFFER_SIZE - FRAMING_RxFill ) , &Local_u16ReadLength ) ;
+
+		Local_u16FrameStart = 0 ;
+		Local_u16End = (uint16_t)( FRAMING_RxFill + Local_u16ReadLength ) ;
+
+		for( Local_u16Scan = FRAMING_RxFill ; Local_u16Scan < Local_u16End ; Local_u16Scan++ )
+		{
+			if( FRAMING_RxBuffer[ Local_u16Scan ] == FRAMING_DELIMITER )
+			{
+				/* COMPLETE FRAME , EMPTY FRAMES ( BACK TO BACK DELIMITERS ) ARE IGNORED */
+				if( FRAMING_RxDiscard == 0 && Local_u16Scan != Local_u16FrameStart )
+				{
+					_vHandleFrame( &FRAMING_RxBuffer[ Local_u16FrameStart ] , (uint16_t)( Local_u16Scan - Local_u16FrameStart ) ) ;
+				}
+
+				FRAMING_RxDiscard = 0 ;
+
+				/* NEXT FRAME STARTS AFTER THE DELIMITER , NOTHING IS MOVED YET */
+				Local_u16FrameStart = (uint16_t)( Local_u16Scan + 1U ) ;
+			}
+		}
+
+		/* MOVE THE INCOMPLETE FRAME ( IF ANY ) TO THE BUFFER START ONCE PER READ */
+		if( Local_u16FrameStart != 0 )
+		{
+			for( Local_u16Counter = Local_u16FrameStart ; Local_u16Counter < Local_u16End ; Local_u16Counter++ )
+			{
+				FRAMING_RxBuffer[ Local_u16Counter - Local_u16FrameStart ] = FRAMING_RxBuffer[ Local_u16Counter ] ;
+			}
+		}
+
+		FRAMING_RxFill = (uint16_t)( Local_u16End - Local_u16FrameStart ) ;
+
+		/* BUFFER FULL WITHOUT A DELIMITER , FRAME IS TOO LONG */
+		if( FRAMING_RxFill == FRAMING_RX_BUFFER_SIZE )
+		{
+			if( FRAMING_RxDiscard == 0 )
+			{
+				FRAMING_FrameErrors++ ;
+			}
+
+			FRAMING_RxDiscard = 1 ;
+			FRAMING_RxFill = 0 ;
+		}
+
+	}while( Local_u16ReadLength != 0 ) ;
+}
+
+/**
+ * @fn 			: HFRAMING_eGetErrors(uint32_t*, uint32_t*)
+ * @brief 		: THIS FUNCTION RETURNS THE NUMBER OF FRAMES DROPPED SINCE INITIALIZATION
+ *
+ * @param[out] 	: Copy_pu32CRCErrors	=> RETURN FOR FRAMES HAVING A WRONG CRC
+ * @param[out] 	: Copy_pu32FrameErrors	=> RETURN FOR FRAMES HAVING A WRONG COBS ENCODING OR TOO LONG FOR THE RECEIVE BUFFER
+ * @return		: ERROR STATUS
+ */
+ERRORS_t HFRAMING_eGetErrors( uint32_t * Copy_pu32CRCErrors , uint32_t * Copy_pu32FrameErrors )
+{
+	if( Copy_pu32CRCErrors == NULL || Copy_pu32FrameErrors == NULL )
+	{
+		return NULL_POINTER ;
+	}
+
+	*Copy_pu32CRCErrors = FRAMING_CRCErrors ;
+	*Copy_pu32FrameErrors = FRAMING_FrameErrors ;
+
+	return OK ;
+}
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: _u16CRC16Update(uint16_t, const uint8_t*, uint16_t)
+ * @brief 	: THIS FUNCTION UPDATES A CRC-16/CCITT-FALSE VALUE OVER A BUFFER ( HALF BYTE TABLE )
+ *
+ * @param 	: Copy_u16CRC		=> CRC VALUE SO FAR ( FRAMING_CRC_INIT AT START )
+ * @param 	: Copy_pu8Data		=> DATA BUFFER
+ * @param 	: Copy_u16Length	=> DATA LENGTH
+ * @return	: UPDATED CRC VALUE
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static uint16_t _u16CRC16Update( uint16_t Copy_u16CRC , const uint8_t * Copy_pu8Data , uint16_t Copy_u16Length )
+{
+	uint16_t Local_u16Counter ;
+
+	for( Local_u16Counter = 0 ; Local_u16Counter < Copy_u16Length ; Local_u16Counter++ )
+	{
+		/* HIGH HALF BYTE THEN LOW HALF BYTE */
+		Copy_u16CRC = (uint16_t)( ( Copy_u16CRC << 4 ) ^ FRAMING_CRC_TABLE[ ( ( Copy_u16CRC >> 12 ) ^ ( Copy_pu8Data[ Local_u16Counter ] >> 4 ) ) & 0x0F ] ) ;
+		Copy_u16CRC = (uint16_t)( ( Copy_u16CRC << 4 ) ^ FRAMING_CRC_TABLE[ ( ( Copy_u16CRC >> 12 ) ^ ( Copy_pu8Data[ Local_u16Counter ] ) ) & 0x0F ] ) ;
+	}
+
+	return Copy_u16CRC ;
+}
+
+/**
+ * @fn 		: _eWriteAll(const uint8_t*, uint16_t)
+ * @brief 	: THIS FUNCTION WRITES A BUFFER TO THE USART TX FIFO , WAITING ONLY WHILE THE FIFO IS FULL
+ *
+ * @param 	: Copy_pu8Data		=> DATA BUFFER
+ * @param 	: Copy_u16Length	=> DATA LENGTH
+ * @return	: OK , NOK IF THE USART FIFO REJECTS THE WRITE ( REMAINING BYTES ARE NOT SENT )
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static ERRORS_t _eWriteAll( const uint8_t * Copy_pu8Data , uint16_t Copy_u16Length )
+{
+	uint16_t Local_u16Written = 0 ;
+
+	while( Copy_u16Length != 0 )
+	{
+		if( USART_OK != USART_FifoWrite( FRAMING_USART->USART_Number , Copy_pu8Data , Copy_u16Length , &Local_u16Written ) )
+		{
+			return NOK ;
+		}
+
+		Copy_pu8Data += Local_u16Written ;
+		Copy_u16Length -= Local_u16Written ;
+	}
+
+	return OK ;
+}
+
+/**
+ * @fn 		: _vHandleFrame(uint8_t*, uint16_t)
+ * @brief 	: THIS FUNCTION DECODES A COMPLETE FRAME IN PLACE , CHECKS ITS CRC & INVOKES THE PACKET CALL BACK
+ *
+ * @param 	: Copy_pu8Frame		=> FIRST BYTE OF THE FRAME INSIDE THE RECEIVE BUFFER
+ * @param 	: Copy_u16Length	=> ENCODED FRAME LENGTH WITHOUT THE DELIMITER
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vHandleFrame( uint8_t * Copy_pu8Frame , uint16_t Copy_u16Length )
+{
+	uint16_t Local_u16Read = 0 ;
+
+	uint16_t Local_u16Write = 0 ;
+
+	uint16_t Local_u16ReceivedCRC ;
+
+	uint8_t Local_u8Code ;
+
+	uint8_t Local_u8Counter ;
+
+	/* COBS DECODE , WRITE INDEX NEVER PASSES READ INDEX SO THE FRAME IS DECODED IN PLACE */
+	while( Local_u16Read < Copy_u16Length )
+	{
+		Local_u8Code = Copy_pu8Frame[ Local_u16Read++ ] ;
+
+		/* RUN LONGER THAN THE FRAME */
+		if( ( Local_u16Read + Local_u8Code - 1U ) > Copy_u16Length )
+		{
+			FRAMING_FrameErrors++ ;
+
+			return ;
+		}
+
+		for( Local_u8Counter = 1 ; Local_u8Counter < Local_u8Code ; Local_u8Counter++ )
+		{
+			Copy_pu8Frame[ Local_u16Write++ ] = Copy_pu8Frame[ Local_u16Read++ ] ;
+		}
+
+		/* IMPLIED ZERO , EXCEPT AFTER A FULL RUN & AT THE FRAME END */
+		if( Local_u8Code < FRAMING_COBS_MAX_CODE && Local_u16Read < Copy_u16Length )
+		{
+			Copy_pu8Frame[ Local_u16Write++ ] = 0 ;
+		}
+	}
+
+	/* PAYLOAD MUST HAVE AT LEAST ONE BYTE PLUS CRC */
+	if( Local_u16Write <= FRAMING_CRC_SIZE )
+	{
+		FRAMING_FrameErrors++ ;
+
+		return ;
+	}
+
+	Local_u16Write -= FRAMING_CRC_SIZE ;
+
+	Local_u16ReceivedCRC = (uint16_t)( Copy_pu8Frame[ Local_u16Write ] | ( Copy_pu8Frame[ Local_u16Write + 1U ] << 8 ) ) ;
+
+	if( Local_u16ReceivedCRC != _u16CRC16Update( FRAMING_CRC_INIT , Copy_pu8Frame , Local_u16Write ) )
+	{
+		FRAMING_CRCErrors++ ;
+
+		return ;
+	}
+
+	/* ONE CALL BACK PER VERIFIED PACKET , PAYLOAD STAYS IN THE RECEIVE BUFFER */
+	FRAMING_PacketCallBack( Copy_pu8Frame , Local_u16Write ) ;
+}
@@ -0,0 +1,115 @@
+/*
+ ******************************************************************************
+ * @file           : I2CBUS_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SHARED I2C BUS TRANSACTION SCHEDULER INTERFACE FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef I2CBUS_INC_I2CBUS_INTERFACE_H_
+#define I2CBUS_INC_I2CBUS_INTERFACE_H_
+
+/* ======================================================================
+ * PLEASE READ THE FOLLOWING SPECIFICATIONS
+ * ====================================================================== */
+/**
+ *   @IDEA              : EVERY DEVICE ON A BUS SUBMITS ITS TRANSACTIONS HERE INSTEAD OF DRIVING START / WRITE / STOP ITSELF
+ *                        THE BUS RUNS THEM ONE AFTER THE OTHER USING INTERRUPT DRIVEN OR DMA MASTER TRANSFERS
+ *   @ORDER             : HIGHER PRIORITY FIRST , SAME PRIORITY IN SUBMISSION ORDER , A RUNNING TRANSACTION IS NEVER PREEMPTED
+ *   @BACK_TO_BACK      : THE NEXT TRANSACTION IS STARTED FROM THE COMPLETION INTERRUPT BEFORE THE CALL BACK OF THE FINISHED ONE
+ *                        SO A SLOW CALL BACK NEVER LEAVES THE BUS IDLE
+ *   @CHAINING          : THE DRIVER WAITS A FEW SCL PERIODS AT MOST ( I2C_BUS_RELEASE_SCL_PERIODS ) FOR THE STOP OF THE FINISHED
+ *                        TRANSACTION TO LEAVE THE BUS , NO POLLING IS NEEDED , A BUS STILL HELD AFTER THAT ENDS THE TRANSACTION
+ *                        WITH I2C_TRANSFER_BUS_ERROR & THE NEXT ONE IS TRIED
+ *   @NO_COPY           : REQUESTS ARE LINKED IN PLACE ( NO POOL , NO MALLOC ) , A REQUEST & ITS BUFFERS BELONG TO THE BUS
+ *                        FROM SUBMISSION UNTIL ITS CALL BACK , ITS Transfer.Status STAYS I2C_TRANSFER_BUSY MEANWHILE
+ */
+
+/**
+ * @enum  : @I2CBUS_PRIORITY_t
+ * @brief : SPECIFIES PRIORITY OF A BUS REQUEST
+ *
+ */
+typedef enum
+{
+	I2CBUS_PRIORITY_LOW = 0 ,
+	I2CBUS_PRIORITY_MEDIUM ,
+	I2CBUS_PRIORITY_HIGH ,
+	I2CBUS_PRIORITY_VERY_HIGH
+
+}I2CBUS_PRIORITY_t;
+
+/**
+ * @enum  : @I2CBUS_MODE_t
+ * @brief : SPECIFIES HOW DATA BYTES OF A REQUEST ARE MOVED
+ *
+ */
+typedef enum
+{
+	I2CBUS_MODE_IT = 0 ,  /**< I2C BUFFER INTERRUPTS , BEST FOR FEW BYTES */
+	I2CBUS_MODE_DMA       /**< DMA STREAMS , BEST FOR BULK READS & WRITES */
+
+}I2CBUS_MODE_t;
+
+/**
+ * @struct : @I2CBUS_Request_t
+ * @brief  : ONE BUS TRANSACTION ( WRITE , READ OR WRITE THEN READ ) , CHECK @I2C_Transfer_t
+ */
+typedef struct I2CBUS_Request
+{
+	I2C_Transfer_t			Transfer ; /*!< SLAVE ADDRESS , BUFFERS & SIZES , Transfer.CallBack IS USED BY THE BUS >!*/
+
+	I2CBUS_PRIORITY_t		Priority ; /*!< CHECK @I2CBUS_PRIORITY_t >!*/
+
+	I2CBUS_MODE_t			Mode	 ; /*!< CHECK @I2CBUS_MODE_t >!*/
+
+	void ( * CallBack )( void )		 ; /*!< INVOKED FROM INTERRUPT CONTEXT WHEN THE REQUEST ENDS , CHECK Transfer.Status ( CAN BE NULL ) >!*/
+
+	struct I2CBUS_Request * Next	 ; /*!< USED BY THE BUS ONLY >!*/
+
+}I2CBUS_Request_t;
+
+/* ======================================================================
+ * PROTOTYPES SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: HI2CBUS_eInit(I2C_Config_t*)
+ * @brief 	: THIS FUNCTION INITIALIZES AN I2C PERIPHERAL & ITS EMPTY REQUESTS QUEUE
+ *
+ * @param 	: I2CConfig	=> POINTER TO STRUCTURE HOLDING I2C CONFIGURATION INFO , MUST STAY VALID
+ * @return	: ERROR STATUS
+ * @note	: I2C EV & ER IRQs ( AND I2C DMA STREAMS IRQs FOR DMA REQUESTS ) MUST BE ENABLED IN THE NVIC
+ * 			  CALLING IT AGAIN WITH THE SAME CONFIGURATION ( ONE CALL PER DEVICE DRIVER ON THE BUS ) DOES NOTHING
+ */
+ERRORS_t HI2CBUS_eInit( I2C_Config_t * I2CConfig ) ;
+
+/**
+ * @fn 		: HI2CBUS_eSubmit(I2C_t, I2CBUS_Request_t*)
+ * @brief 	: THIS FUNCTION QUEUES A REQUEST ON A BUS & STARTS IT RIGHT AWAY IF THE BUS IS IDLE
+ *
+ * @param 	: I2CNumber	=> BUS TO USE , CHECK @I2C_t
+ * @param 	: Request	=> POINTER TO THE REQUEST , CHECK @I2CBUS_Request_t
+ * @return	: ERROR STATUS , NOK IF THE BUS IS NOT INITIALIZED , THE REQUEST IS INVALID OR STILL PENDING
+ * @note	: CAN BE CALLED FROM A CALL BACK TO CHAIN TRANSACTIONS
+ */
+ERRORS_t HI2CBUS_eSubmit( I2C_t I2CNumber , I2CBUS_Request_t * Request ) ;
+
+/**
+ * @fn 			: HI2CBUS_eIsIdle(I2C_t, uint8_t*)
+ * @brief 		: THIS FUNCTION TELLS IF A BUS HAS NO RUNNING OR QUEUED REQUESTS
+ *
+ * @param[in] 	: I2CNumber		=> BUS TO CHECK , CHECK @I2C_t
+ * @param[out] 	: Copy_pu8Idle	=> RETURN , 1 IF IDLE , 0 OTHERWISE
+ * @return		: ERROR STATUS
+ * @note		: ALSO ENDS A RUNNING REQUEST PAST ITS DEADLINE WITH I2C_TRANSFER_TIMEOUT ( MI2C_eCheckTimeout ) , SO POLLING IT KEEPS THE BUS MOVING
+ */
+ERRORS_t HI2CBUS_eIsIdle( I2C_t I2CNumber , uint8_t * Copy_pu8Idle ) ;
+
+#endif /* I2CBUS_INC_I2CBUS_INTERFACE_H_ */
@@ -0,0 +1,97 @@
+/*
+ ******************************************************************************
+ * @file           : I2CBUS_Prv.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SHARED I2C BUS TRANSACTION SCHEDULER PRIVATE FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef I2CBUS_INC_I2CBUS_PRV_H_
+#define I2CBUS_INC_I2CBUS_PRV_H_
+
+/* ======================================================================
+ * PRIVATE DEFINES
+ * ====================================================================== */
+
+/* NUMBER OF BUSES , CHECK @I2C_t */
+#define I2CBUS_MAX_NUMBER			2U
+
+/* ======================================================================
+ * PRIVATE TYPES
+ * ====================================================================== */
+
+/**
+ * @struct : @I2CBUS_Bus_t
+ * @brief  : HOLDS THE STATE OF ONE BUS
+ */
+typedef struct
+{
+	I2C_Config_t *				I2CConfig ; /*!< NULL UNTIL HI2CBUS_eInit >!*/
+
+	I2CBUS_Request_t * volatile	Current	  ; /*!< RUNNING REQUEST , NULL WHEN THE BUS IS IDLE >!*/
+
+	I2CBUS_Request_t * volatile	Head	  ; /*!< QUEUED REQUESTS SORTED BY PRIORITY >!*/
+
+}I2CBUS_Bus_t;
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @fn 		: _u32EnterCritical(void)
+ * @brief 	: THIS FUNCTION MASKS INTERRUPTS & RETURNS THE PREVIOUS MASK ( PRIMASK )
+ *
+ * @return	: PREVIOUS PRIMASK VALUE TO PASS TO _vExitCritical
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY , KEEPS QUEUE UPDATES ATOMIC AGAINST COMPLETION INTERRUPTS
+ */
+static uint32_t _u32EnterCritical( void ) ;
+
+/**
+ * @fn 		: _vExitCritical(uint32_t)
+ * @brief 	: THIS FUNCTION RESTORES THE INTERRUPTS MASK SAVED BY _u32EnterCritical
+ *
+ * @param 	: Copy_u32PriMask	=> VALUE RETURNED BY _u32EnterCritical
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vExitCritical( uint32_t Copy_u32PriMask ) ;
+
+/**
+ * @fn 		: _vRun(I2C_t)
+ * @brief 	: THIS FUNCTION STARTS THE CURRENT REQUEST OF A BUS , REQUESTS THAT FAIL TO START ARE ENDED & THE NEXT ONE IS TRIED
+ *
+ * @param 	: I2CNumber	=> BUS NUMBER
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vRun( I2C_t I2CNumber ) ;
+
+/**
+ * @fn 		: _pNext(I2C_t)
+ * @brief 	: THIS FUNCTION MOVES THE HEAD OF THE QUEUE TO BE THE CURRENT REQUEST
+ *
+ * @param 	: I2CNumber	=> BUS NUMBER
+ * @return	: NEW CURRENT REQUEST , NULL IF THE QUEUE IS EMPTY
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY , MUST BE CALLED INSIDE A CRITICAL SECTION
+ */
+static I2CBUS_Request_t * _pNext( I2C_t I2CNumber ) ;
+
+/**
+ * @fn 		: _vTransferDone(I2C_t)
+ * @brief 	: THIS FUNCTION STARTS THE NEXT REQUEST OF A BUS THEN INVOKES THE CALL BACK OF THE FINISHED ONE
+ *
+ * @param 	: I2CNumber	=> BUS NUMBER
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY , CALLED FROM THE I2C DRIVER TRANSFER CALL BACK
+ */
+static void _vTransferDone( I2C_t I2CNumber ) ;
+
+/* I2C DRIVER TRANSFER CALL BACKS , ONE PER BUS */
+static void _vBus1Done( void ) ;
+static void _vBus2Done( void ) ;
+
+#endif /* I2CBUS_INC_I2CBUS_PRV_H_ */
@@ -0,0 +1,342 @@
+/*
+ ******************************************************************************
+ * @file           : I2CBUS_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SHARED I2C BUS TRANSACTION SCHEDULER MAIN PROGRAM FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/* ======================================================================
+ * INCLUDES SECTION
+ * ====================================================================== */
+
+#include <stdint.h>
+
+#include "../../../LIB/ErrType.h"
+#include "../../../LIB/STM32F446xx.h"
+
+#include "../../../MCAL/I2C/Inc/I2C_Interface.h"
+
+#include "../Inc/I2CBUS_Interface.h"
+#include "../Inc/I2CBUS_Prv.h"
+
+/* ======================================================================
+ * GLOBALS SECTION
+ * ====================================================================== */
+
+/* BUSES STATE */
+static I2CBUS_Bus_t I2CBUS_Bus[ I2CBUS_MAX_NUMBER ] ;
+
+/* TRANSFER CALL BACK GIVEN TO THE I2C DRIVER FOR EACH BUS */
+static void ( * const I2CBUS_DoneCallBack[ I2CBUS_MAX_NUMBER ] )( void ) = { _vBus1Done , _vBus2Done } ;
+
+/* ======================================================================
+ * IMPLEMENTATION SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: HI2CBUS_eInit(I2C_Config_t*)
+ * @brief 	: THIS FUNCTION INITIALIZES AN I2C PERIPHERAL & ITS EMPTY REQUESTS QUEUE
+ *
+ * @param 	: I2CConfig	=> POINTER TO STRUCTURE HOLDING I2C CONFIGURATION INFO , MUST STAY VALID
+ * @return	: ERROR STATUS
+ * @note	: I2C EV & ER IRQs ( AND I2C DMA STREAMS IRQs FOR DMA REQUESTS ) MUST BE ENABLED IN THE NVIC
+ * 			  CALLING IT AGAIN WITH THE SAME CONFIGURATION ( ONE CALL PER DEVICE DRIVER ON THE BUS ) DOES NOTHING
+ */
+ERRORS_t HI2CBUS_eInit( I2C_Config_t * I2CConfig )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	if( NULL == I2CConfig )
+	{
+		return NULL_POINTER ;
+	}
+
+	if( I2CConfig->I2CNumber >= I2CBUS_MAX_NUMBER )
+	{
+		return NOK ;
+	}
+
+	/* ANOTHER DEVICE ON THE SAME BUS ALREADY INITIALIZED IT , KEEP ITS QUEUE */
+	if( I2CBUS_Bus[ I2CConfig->I2CNumber ].I2CConfig == I2CConfig )
+	{
+		return OK ;
+	}
+
+	/* INITIALIZE I2C */
+	Local_ErrorStatus = MI2C_eInit( I2CConfig ) ;
+
+	if( Local_ErrorStatus == OK )
+	{
+		I2CBUS_Bus[ I2CConfig->I2CNumber ].I2CConfig = I2CConfig ;
+		I2CBUS_Bus[ I2CConfig->I2CNumber ].Current = NULL ;
+		I2CBUS_Bus[ I2CConfig->I2CNumber ].Head = NULL ;
+	}
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn 		: HI2CBUS_eSubmit(I2C_t, I2CBUS_Request_t*)
+ * @brief 	: THIS FUNCTION QUEUES A REQUEST ON A BUS & STARTS IT RIGHT AWAY IF THE BUS IS IDLE
+ *
+ * @param 	: I2CNumber	=> BUS TO USE , CHECK @I2C_t
+ * @param 	: Request	=> POINTER TO THE REQUEST , CHECK @I2CBUS_Request_t
+ * @return	: ERROR STATUS , NOK IF THE BUS IS NOT INITIALIZED , THE REQUEST IS INVALID OR STILL PENDING
+ * @note	: CAN BE CALLED FROM A CALL BACK TO CHAIN TRANSACTIONS
+ */
+ERRORS_t HI2CBUS_eSubmit( I2C_t I2CNumber , I2CBUS_Request_t * Request )
+{
+	I2CBUS_Bus_t * Local_pBus = NULL ;
+
+	I2CBUS_Request_t ** Local_ppLink = NULL ;
+
+	uint32_t Local_u32PriMask = 0 ;
+
+	uint8_t Local_u8Start = 0 ;
+
+	if( NULL == Request )
+	{
+		return NULL_POINTER ;
+	}
+
+	if( ( I2CNumber >= I2CBUS_MAX_NUMBER ) || ( NULL == I2CBUS_Bus[ I2CNumber ].I2CConfig ) ||
+			( Request->Priority > I2CBUS_PRIORITY_VERY_HIGH ) || ( Request->Mode > I2CBUS_MODE_DMA ) ||
+			( ( Request->Transfer.TxSize == 0 ) && ( Request->Transfer.RxSize == 0 ) ) ||
+			( ( Request->Transfer.TxSize != 0 ) && ( NULL == Request->Transfer.TxBuffer ) ) ||
+			( ( Request->Transfer.RxSize != 0 ) && ( NULL == Request->Transfer.RxBuffer ) ) )
+	{
+		return NOK ;
+	}
+
+	Local_pBus = &I2CBUS_Bus[ I2CNumber ] ;
+
+	Local_u32PriMask = _u32EnterCritical() ;
+
+	/* REQUEST ALREADY QUEUED OR RUNNING */
+	if( Request->Transfer.Status == I2C_TRANSFER_BUSY )
+	{
+		_vExitCritical( Local_u32PriMask ) ;
+
+		return NOK ;
+	}
+
+	Request->Transfer.CallBack = I2CBUS_DoneCallBack[ I2CNumber ] ;
+	Request->Transfer.Status = I2C_TRANSFER_BUSY ;
+
+	/* INSERT AFTER ALL REQUESTS OF SAME OR HIGHER PRIORITY */
+	Local_ppLink = (I2CBUS_Request_t **)&Local_pBus->Head ;
+
+	while( ( NULL != *Local_ppLink ) && ( ( *Local_ppLink )->Priority >= Request->Priority ) )
+	{
+		Local_ppLink = &( ( *Local_ppLink )->Next ) ;
+	}
+
+	Request->Next = *Local_ppLink ;
+	*Local_ppLink = Request ;
+
+	/* IDLE BUS , THIS CALLER STARTS IT */
+	if( NULL == Local_pBus->Current )
+	{
+		_pNext( I2CNumber ) ;
+
+		Local_u8Start = 1 ;
+	}
+
+	_vExitCritical( Local_u32PriMask ) ;
+
+	if( Local_u8Start )
+	{
+		_vRun( I2CNumber ) ;
+	}
+
+	return OK ;
+}
+
+/**
+ * @fn 			: HI2CBUS_eIsIdle(I2C_t, uint8_t*)
+ * @brief 		: THIS FUNCTION TELLS IF A BUS HAS NO RUNNING OR QUEUED REQUESTS
+ *
+ * @param[in] 	: I2CNumber		=> BUS TO CHECK , CHECK @I2C_t
+ * @param[out] 	: Copy_pu8Idle	=> RETURN , 1 IF IDLE , 0 OTHERWISE
+ * @return		: ERROR STATUS
+ * @note		: ALSO ENDS A RUNNING REQUEST PAST ITS DEADLINE WITH I2C_TRANSFER_TIMEOUT ( MI2C_eCheckTimeout ) , SO POLLING IT KEEPS THE BUS MOVING
+ */
+ERRORS_t HI2CBUS_eIsIdle( I2C_t I2CNumber , uint8_t * Copy_pu8Idle )
+{
+	if( NULL == Copy_pu8Idle )
+	{
+		return NULL_POINTER ;
+	}
+
+	if( I2CNumber >= I2CBUS_MAX_NUMBER )
+	{
+		return NOK ;
+	}
+
+	/* A STUCK TRANSFER IS RECOVERED & ENDED HERE , ITS COMPLETION STARTS THE NEXT REQUEST */
+	MI2C_eCheckTimeout( I2CNumber ) ;
+
+	/* HEAD IS NEVER SET WHILE CURRENT IS NULL , SO CURRENT ALONE TELLS */
+	*Copy_pu8Idle = ( NULL == I2CBUS_Bus[ I2CNumber ].Current ) ? 1 : 0 ;
+
+	return OK ;
+}
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: _u32EnterCritical(void)
+ * @brief 	: THIS FUNCTION MASKS INTERRUPTS & RETURNS THE PREVIOUS MASK ( PRIMASK )
+ *
+ * @return	: PREVIOUS PRIMASK VALUE TO PASS TO _vExitCritical
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY , KEEPS QUEUE UPDATES ATOMIC AGAINST COMPLETION INTERRUPTS
+ */
+static uint32_t _u32EnterCritical( void )
+{
+	uint32_t Local_u32PriMask = 0 ;
+
+	__asm volatile( "MRS %0, PRIMASK \n\t CPSID I" : "=r" ( Local_u32PriMask ) : : "memory" ) ;
+
+	return Local_u32PriMask ;
+}
+
+/**
+ * @fn 		: _vExitCritical(uint32_t)
+ * @brief 	: THIS FUNCTION RESTORES THE INTERRUPTS MASK SAVED BY _u32EnterCritical
+ *
+ * @param 	: Copy_u32PriMask	=> VALUE RETURNED BY _u32EnterCritical
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vExitCritical( uint32_t Copy_u32PriMask )
+{
+	__asm volatile( "MSR PRIMASK, %0" : : "r" ( Copy_u32PriMask ) : "memory" ) ;
+}
+
+/**
+ * @fn 		: _vRun(I2C_t)
+ * @brief 	: THIS FUNCTION STARTS THE CURRENT REQUEST OF A BUS , REQUESTS THAT FAIL TO START ARE ENDED & THE NEXT ONE IS TRIED
+ *
+ * @param 	: I2CNumber	=> BUS NUMBER
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vRun( I2C_t I2CNumber )
+{
+	I2CBUS_Bus_t * Local_pBus = &I2CBUS_Bus[ I2CNumber ] ;
+
+	I2CBUS_Request_t * Local_pFailed = NULL ;
+
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	uint32_t Local_u32PriMask = 0 ;
+
+	while( NULL != Local_pBus->Current )
+	{
+		if( Local_pBus->Current->Mode == I2CBUS_MODE_DMA )
+		{
+			Local_ErrorStatus = MI2C_eMasterTransfer_DMA( Local_pBus->I2CConfig , &Local_pBus->Current->Transfer ) ;
+		}
+		else
+		{
+			Local_ErrorStatus = MI2C_eMasterTransfer_IT( Local_pBus->I2CConfig , &Local_pBus->Current->Transfer ) ;
+		}
+
+		/* RUNNING , THE COMPLETION INTERRUPT TAKES IT FROM HERE */
+		if( Local_ErrorStatus == OK )
+		{
+			break ;
+		}
+
+		/* REJECTED BY THE DRIVER OR BUS NOT RELEASED WITHIN THE DRIVER BOUNDED WAIT , END IT & TRY THE NEXT ONE */
+		Local_pFailed = Local_pBus->Current ;
+
+		Local_u32PriMask = _u32EnterCritical() ;
+
+		_pNext( I2CNumber ) ;
+
+		_vExitCritical( Local_u32PriMask ) ;
+
+		Local_pFailed->Transfer.Status = I2C_TRANSFER_BUS_ERROR ;
+
+		if( NULL != Local_pFailed->CallBack )
+		{
+			Local_pFailed->CallBack() ;
+		}
+	}
+}
+
+/**
+ * @fn 		: _pNext(I2C_t)
+ * @brief 	: THIS FUNCTION MOVES THE HEAD OF THE QUEUE TO BE THE CURRENT REQUEST
+ *
+ * @param 	: I2CNumber	=> BUS NUMBER
+ * @return	: NEW CURRENT REQUEST , NULL IF THE QUEUE IS EMPTY
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY , MUST BE CALLED INSIDE A CRITICAL SECTION
+ */
+static I2CBUS_Request_t * _pNext( I2C_t I2CNumber )
+{
+	I2CBUS_Bus_t * Local_pBus = &I2CBUS_Bus[ I2CNumber ] ;
+
+	Local_pBus->Current = Local_pBus->Head ;
+
+	if( NULL != Local_pBus->Current )
+	{
+		Local_pBus->Head = Local_pBus->Current->Next ;
+
+		Local_pBus->Current->Next = NULL ;
+	}
+
+	return Local_pBus->Current ;
+}
+
+/**
+ * @fn 		: _vTransferDone(I2C_t)
+ * @brief 	: THIS FUNCTION STARTS THE NEXT REQUEST OF A BUS THEN INVOKES THE CALL BACK OF THE FINISHED ONE
+ *
+ * @param 	: I2CNumber	=> BUS NUMBER
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY , CALLED FROM THE I2C DRIVER TRANSFER CALL BACK
+ */
+static void _vTransferDone( I2C_t I2CNumber )
+{
+	I2CBUS_Request_t * Local_pDone = I2CBUS_Bus[ I2CNumber ].Current ;
+
+	uint32_t Local_u32PriMask = _u32EnterCritical() ;
+
+	I2CBUS_Request_t * Local_pNext = _pNext( I2CNumber ) ;
+
+	_vExitCritical( Local_u32PriMask ) ;
+
+	/* KEEP THE BUS BUSY BEFORE RUNNING ANY USER CODE */
+	if( NULL != Local_pNext )
+	{
+		_vRun( I2CNumber ) ;
+	}
+
+	if( ( NULL != Local_pDone ) && ( NULL != Local_pDone->CallBack ) )
+	{
+		Local_pDone->CallBack() ;
+	}
+}
+
+/* ======================================================================
+ * I2C DRIVER CALL BACKS SECTION
+ * ====================================================================== */
+
+static void _vBus1Done( void )
+{
+	_vTransferDone( I2C_1 ) ;
+}
+
+static void _vBus2Done( void )
+{
+	_vTransferDone( I2C_2 ) ;
+}
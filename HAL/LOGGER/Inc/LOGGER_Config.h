@@ -0,0 +1,27 @@
+/*
+ ******************************************************************************
+ * @file           : LOGGER_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : BINARY LOGGER CONFIGURATION FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LOGGER_INC_LOGGER_CONFIG_H_
+#define LOGGER_INC_LOGGER_CONFIG_H_
+
+/* NUMBER OF SINGLE PRODUCER CHANNELS ( 1 -> 16 ) */
+#define LOGGER_CHANNELS_NUM		2U
+
+/* RING SIZE OF EACH CHANNEL IN BYTES ( MUST BE A POWER OF 2 , MAXIMUM 32768 ) */
+#define LOGGER_RING_SIZE		512U
+
+/* MAXIMUM NUMBER OF ARGUMENTS IN A SINGLE RECORD ( 0 -> 15 ) */
+#define LOGGER_MAX_ARGS			4U
+
+#endif /* LOGGER_INC_LOGGER_CONFIG_H_ */
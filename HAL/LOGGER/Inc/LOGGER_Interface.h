@@ -0,0 +1,81 @@
+/*
+ ******************************************************************************
+ * @file           : LOGGER_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : BINARY LOGGER INTERFACE FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LOGGER_INC_LOGGER_INTERFACE_H_
+#define LOGGER_INC_LOGGER_INTERFACE_H_
+
+/* ======================================================================
+ * PLEASE READ THE FOLLOWING SPECIFICATIONS
+ * ====================================================================== */
+/**
+ *   @IDEA              : LOG CALLS STORE A LOG ID & RAW 32-BIT ARGUMENTS ONLY , TEXT IS NEVER FORMATTED ON TARGET
+ *                        THE HOST REBUILDS THE TEXT USING A TABLE ( LOG ID -> FORMAT STRING )
+ *   @CHANNELS          : EACH CHANNEL IS A SINGLE PRODUCER RING ( e.g. MAIN LOOP , ONE ISR PRIORITY LEVEL ) SO NO LOCKS ARE NEEDED
+ *                        DIFFERENT CONTEXTS THAT CAN PREEMPT EACH OTHER MUST USE DIFFERENT CHANNELS
+ *   @RECORD_FORMAT     : BYTE 0       -> LOGGER_SYNC_BYTE ( 0xA5 )
+ *                        BYTE 1 , 2   -> LOG ID ( LITTLE ENDIAN )
+ *                        BYTE 3       -> ( CHANNEL << 4 ) | ARGUMENTS COUNT
+ *                        BYTE 4 , 5.. -> ARGUMENTS , 4 BYTES EACH ( LITTLE ENDIAN )
+ *   @DRAIN             : RECORDS ARE STREAMED USING USART DMA , A WHOLE CHANNEL BACKLOG IS SENT BEFORE MOVING TO THE NEXT ONE
+ *                        SO RECORDS ARE NEVER INTERLEAVED ON THE LINE
+ *   @HOST_DECODER      : HAL/LOGGER/Tools/LOGGER_Decoder.c REBUILDS THE TEXT ON LINUX FROM A CAPTURE FILE OR A SERIAL DEVICE
+ *                        USING A MESSAGES TABLE ( SEE HAL/LOGGER/Tools/LOGGER_Messages.txt )
+ */
+
+/* ======================================================================
+ * PROTOTYPES SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: HLOGGER_eInit(USART_Config_t*)
+ * @brief 	: THIS FUNCTION INITIALIZES THE LOGGER RINGS & THE USART USED TO STREAM THEM
+ *
+ * @param 	: USARTConfig	=> POINTER TO STRUCTURE HOLDING USART CONFIGURATION INFO
+ * @return	: ERROR STATUS
+ * @note	: THE DMA STREAM IRQ OF THE USART TX STREAM MUST BE ENABLED IN THE NVIC
+ */
+ERRORS_t HLOGGER_eInit( USART_Config_t * USARTConfig ) ;
+
+/**
+ * @fn 		: HLOGGER_eLog(uint8_t, uint16_t, const uint32_t*, uint8_t)
+ * @brief 	: THIS FUNCTION RECORDS A LOG ID & ITS RAW ARGUMENTS IN A CHANNEL RING WITHOUT FORMATTING OR BLOCKING
+ *
+ * @param 	: Copy_u8Channel	=> CHANNEL OF THE CALLING CONTEXT 0 -> ( LOGGER_CHANNELS_NUM - 1 )
+ * @param 	: Copy_u16LogID		=> ID OF THE MESSAGE IN THE HOST TABLE
+ * @param 	: Copy_pu32Args		=> ARGUMENTS OF THE MESSAGE ( CAN BE NULL IF ARGUMENTS COUNT IS 0 )
+ * @param 	: Copy_u8ArgsCount	=> NUMBER OF ARGUMENTS 0 -> LOGGER_MAX_ARGS
+ * @return	: ERROR STATUS
+ * @note	: IF THE CHANNEL RING IS FULL THE RECORD IS DROPPED & COUNTED , CHECK HLOGGER_eGetDropped
+ */
+ERRORS_t HLOGGER_eLog( uint8_t Copy_u8Channel , uint16_t Copy_u16LogID , const uint32_t * Copy_pu32Args , uint8_t Copy_u8ArgsCount ) ;
+
+/**
+ * @fn 		: HLOGGER_vFlush(void)
+ * @brief 	: THIS FUNCTION STARTS STREAMING THE PENDING RECORDS IF THE USART DMA IS IDLE
+ *
+ * @note	: CALL IT PERIODICALLY FROM THE MAIN LOOP , ONCE STARTED THE DMA KEEPS DRAINING ALL CHANNELS BY ITSELF
+ */
+void HLOGGER_vFlush( void ) ;
+
+/**
+ * @fn 			: HLOGGER_eGetDropped(uint8_t, uint32_t*)
+ * @brief 		: THIS FUNCTION RETURNS THE NUMBER OF RECORDS DROPPED ON A CHANNEL BECAUSE ITS RING WAS FULL
+ *
+ * @param[in] 	: Copy_u8Channel	=> CHANNEL NUMBER 0 -> ( LOGGER_CHANNELS_NUM - 1 )
+ * @param[out] 	: Copy_pu32Dropped	=> RETURN FOR NUMBER OF DROPPED RECORDS
+ * @return		: ERROR STATUS
+ */
+ERRORS_t HLOGGER_eGetDropped( uint8_t Copy_u8Channel , uint32_t * Copy_pu32Dropped ) ;
+
+#endif /* LOGGER_INC_LOGGER_INTERFACE_H_ */
@@ -0,0 +1,73 @@
+/*
+ ******************************************************************************
+ * @file           : LOGGER_Prv.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : BINARY LOGGER PRIVATE FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LOGGER_INC_LOGGER_PRV_H_
+#define LOGGER_INC_LOGGER_PRV_H_
+
+/*==============================================================================================================================================
+ * PRIVATE DEFINES
+ *==============================================================================================================================================*/
+
+#define LOGGER_SYNC_BYTE		0xA5
+
+#define LOGGER_HEADER_SIZE		4U
+
+#define LOGGER_ARG_SIZE			4U
+
+#define LOGGER_RING_MASK		( LOGGER_RING_SIZE - 1U )
+
+#define LOGGER_DRAIN_IDLE		0U
+#define LOGGER_DRAIN_BUSY		1U
+
+/**
+ * @struct	: @LOGGER_Ring_t
+ * @brief 	: HOLDS A SINGLE PRODUCER SINGLE CONSUMER CHANNEL RING , HEAD IS WRITTEN BY THE PRODUCER ONLY & TAIL BY THE DRAIN ONLY
+ */
+typedef struct
+{
+	volatile uint8_t  Buffer[ LOGGER_RING_SIZE ] ;	/*!< RING STORAGE !>*/
+	volatile uint16_t Head ;						/*!< FREE RUNNING WRITE INDEX !>*/
+	volatile uint16_t Tail ;						/*!< FREE RUNNING READ INDEX !>*/
+	volatile uint32_t Dropped ;						/*!< RECORDS DROPPED WHILE THE RING WAS FULL !>*/
+}LOGGER_Ring_t;
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS
+ *==============================================================================================================================================*/
+
+/**
+ * @fn 		: _vDrainNext(void)
+ * @brief 	: THIS FUNCTION STARTS THE NEXT USART DMA CHUNK OF THE CHANNEL BEING DRAINED OR PICKS THE NEXT CHANNEL HAVING RECORDS
+ *
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vDrainNext( void ) ;
+
+/**
+ * @fn 		: _vDrainDone(void)
+ * @brief 	: USART DMA COMPLETION CALL BACK , RELEASES THE SENT BYTES & CONTINUES DRAINING
+ *
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vDrainDone( void ) ;
+
+/**
+ * @fn 		: _vDrainError(void)
+ * @brief 	: USART DMA ERROR CALL BACK , STOPS DRAINING SO THE NEXT FLUSH RETRIES THE SAME CHUNK
+ *
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vDrainError( void ) ;
+
+#endif /* LOGGER_INC_LOGGER_PRV_H_ */
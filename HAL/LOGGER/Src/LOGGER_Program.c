@@ -0,0 +1,301 @@
+/*
+ ******************************************************************************
+ * @file           : LOGGER_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : BINARY LOGGER MAIN PROGRAM FILE
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/* ======================================================================
+ * INCLUDES SECTION
+ * ====================================================================== */
+
+#include <stdint.h>
+
+#include "../../../LIB/ErrType.h"
+#include "../../../LIB/STM32F446xx.h"
+
+#include "../../../MCAL/USART/Inc/USART_Interface.h"
+
+#include "../Inc/LOGGER_Interface.h"
+#include "../Inc/LOGGER_Config.h"
+#include "../Inc/LOGGER_Prv.h"
+
+/* ======================================================================
+ * GLOBALS SECTION
+ * ====================================================================== */
+
+/* CHANNELS RINGS */
+static LOGGER_Ring_t LOGGER_Rings[ LOGGER_CHANNELS_NUM ] ;
+
+/* USART USED TO STREAM THE RECORDS */
+static USART_Config_t * LOGGER_USART = NULL ;
+
+/* DRAIN STATE , CHANNEL BEING DRAINED , ITS HEAD WHEN IT WAS PICKED & LENGTH OF THE CHUNK IN FLIGHT */
+static volatile uint8_t LOGGER_DrainState = LOGGER_DRAIN_IDLE ;
+static uint8_t  LOGGER_DrainChannel = 0 ;
+static uint16_t LOGGER_DrainEnd = 0 ;
+static uint16_t LOGGER_ChunkLength = 0 ;
+
+/* ======================================================================
+ * IMPLEMENTATION SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: HLOGGER_eInit(USART_Config_t*)
+ * @brief 	: THIS FUNCTION INITIALIZES THE LOGGER RINGS & THE USART USED TO STREAM THEM
+ *
+ * @param 	: USARTConfig	=> POINTER TO STRUCTURE HOLDING USART CONFIGURATION INFO
+ * @return	: ERROR STATUS
+ * @note	: THE DMA STREAM IRQ OF THE USART TX STREAM MUST BE ENABLED IN THE NVIC
+ */
+ERRORS_t HLOGGER_eInit( USART_Config_t * USARTConfig )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	uint8_t Local_u8Channel ;
+
+	if( USARTConfig == NULL )
+	{
+		return NULL_POINTER ;
+	}
+
+	/* INITIALIZE USART */
+	if( USART_OK != USART_Init( USARTConfig ) )
+	{
+		return NOK ;
+	}
+
+	/* EMPTY ALL CHANNELS */
+	for( Local_u8Channel = 0 ; Local_u8Channel < LOGGER_CHANNELS_NUM ; Local_u8Channel++ )
+	{
+		LOGGER_Rings[ Local_u8Channel ].Head = 0 ;
+		LOGGER_Rings[ Local_u8Channel ].Tail = 0 ;
+		LOGGER_Rings[ Local_u8Channel ].Dropped = 0 ;
+	}
+
+	LOGGER_DrainChannel = 0 ;
+	LOGGER_DrainEnd = 0 ;
+	LOGGER_DrainState = LOGGER_DRAIN_IDLE ;
+
+	/* INITIALIZE POINTER TO STRUCT GLOBALLY */
+	LOGGER_USART = USARTConfig ;
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn 		: HLOGGER_eLog(uint8_t, uint16_t, const uint32_t*, uint8_t)
+ * @brief 	: THIS FUNCTION RECORDS A LOG ID & ITS RAW ARGUMENTS IN A CHANNEL RING WITHOUT FORMATTING OR BLOCKING
+ *
+ * @param 	: Copy_u8Channel	=> CHANNEL OF THE CALLING CONTEXT 0 -> ( LOGGER_CHANNELS_NUM - 1 )
+ * @param 	: Copy_u16LogID		=> ID OF THE MESSAGE IN THE HOST TABLE
+ * @param 	: Copy_pu32Args		=> ARGUMENTS OF THE MESSAGE ( CAN BE NULL IF ARGUMENTS COUNT IS 0 )
+ * @param 	: Copy_u8ArgsCount	=> NUMBER OF ARGUMENTS 0 -> LOGGER_MAX_ARGS
+ * @return	: ERROR STATUS
+ * @note	: IF THE CHANNEL RING IS FULL THE RECORD IS DROPPED & COUNTED , CHECK HLOGGER_eGetDropped
+ */
+ERRORS_t HLOGGER_eLog( uint8_t Copy_u8Channel , uint16_t Copy_u16LogID , const uint32_t * Copy_pu32Args , uint8_t Copy_u8ArgsCount )
+{
+	LOGGER_Ring_t * Local_pRing ;
+
+	uint16_t Local_u16Head ;
+
+	uint16_t Local_u16RecordSize ;
+
+	uint8_t Local_u8ArgCounter ;
+
+	if( Copy_u8Channel >= LOGGER_CHANNELS_NUM || Copy_u8ArgsCount > LOGGER_MAX_ARGS )
+	{
+		return NOK ;
+	}
+
+	if( Copy_u8ArgsCount != 0 && Copy_pu32Args == NULL )
+	{
+		return NULL_POINTER ;
+	}
+
+	Local_pRing = &LOGGER_Rings[ Copy_u8Channel ] ;
+
+	Local_u16RecordSize = (uint16_t)( LOGGER_HEADER_SIZE + ( Copy_u8ArgsCount * LOGGER_ARG_SIZE ) ) ;
+
+	/* PRODUCER OWNS HEAD , TAIL IS READ ONCE */
+	Local_u16Head = Local_pRing->Head ;
+
+	if( Local_u16RecordSize > (uint16_t)( LOGGER_RING_SIZE - (uint16_t)( Local_u16Head - Local_pRing->Tail ) ) )
+	{
+		/* RING IS FULL , DROP THE RECORD */
+		Local_pRing->Dropped++ ;
+
+		return NOK ;
+	}
+
+	/* WRITE HEADER */
+	Local_pRing->Buffer[ ( Local_u16Head++ ) & LOGGER_RING_MASK ] = LOGGER_SYNC_BYTE ;
+	Local_pRing->Buffer[ ( Local_u16Head++ ) & LOGGER_RING_MASK ] = (uint8_t)( Copy_u16LogID ) ;
+	Local_pRing->Buffer[ ( Local_u16Head++ ) & LOGGER_RING_MASK ] = (uint8_t)( Copy_u16LogID >> 8 ) ;
+	Local_pRing->Buffer[ ( Local_u16Head++ ) & LOGGER_RING_MASK ] = (uint8_t)( ( Copy_u8Channel << 4 ) | Copy_u8ArgsCount ) ;
+
+	/* WRITE RAW ARGUMENTS ( LITTLE ENDIAN ) */
+	for( Local_u8ArgCounter = 0 ; Local_u8ArgCounter < Copy_u8ArgsCount ; Local_u8ArgCounter++ )
+	{
+		Local_pRing->Buffer[ ( Local_u16Head++ ) & LOGGER_RING_MASK ] = (uint8_t)( Copy_pu32Args[ Local_u8ArgCounter ] ) ;
+		Local_pRing->Buffer[ ( Local_u16Head++ ) & LOGGER_RING_MASK ] = (uint8_t)( Copy_pu32Args[ Local_u8ArgCounter ] >> 8 ) ;
+		Local_pRing->Buffer[ ( Local_u16Head++ ) & LOGGER_RING_MASK ] = (uint8_t)( Copy_pu32Args[ Local_u8ArgCounter ] >> 16 ) ;
+		Local_pRing->Buffer[ ( Local_u16Head++ ) & LOGGER_RING_MASK ] = (uint8_t)( Copy_pu32Args[ Local_u8ArgCounter ] >> 24 ) ;
+	}
+
+	/* PUBLISH THE WHOLE RECORD AT ONCE */
+	Local_pRing->Head = Local_u16Head ;
+
+	return OK ;
+}
+
+/**
+ * @fn 		: HLOGGER_vFlush(void)
+ * @brief 	: THIS FUNCTION STARTS STREAMING THE PENDING RECORDS IF THE USART DMA IS IDLE
+ *
+ * @note	: CALL IT PERIODICALLY FROM THE MAIN LOOP , ONCE STARTED THE DMA KEEPS DRAINING ALL CHANNELS BY ITSELF
+ */
+void HLOGGER_vFlush( void )
+{
+	/* DMA CALL BACKS RUN ONLY WHILE BUSY , SO NO CALL BACK CAN RACE THIS CHECK */
+	if( LOGGER_USART != NULL && LOGGER_DrainState == LOGGER_DRAIN_IDLE )
+	{
+		LOGGER_DrainState = LOGGER_DRAIN_BUSY ;
+
+		_vDrainNext() ;
+	}
+}
+
+/**
+ * @fn 			: HLOGGER_eGetDropped(uint8_t, uint32_t*)
+ * @brief 		: THIS FUNCTION RETURNS THE NUMBER OF RECORDS DROPPED ON A CHANNEL BECAUSE ITS RING WAS FULL
+ *
+ * @param[in] 	: Copy_u8Channel	=> CHANNEL NUMBER 0 -> ( LOGGER_CHANNELS_NUM - 1 )
+ * @param[out] 	: Copy_pu32Dropped	=> RETURN FOR NUMBER OF DROPPED RECORDS
+ * @return		: ERROR STATUS
+ */
+ERRORS_t HLOGGER_eGetDropped( uint8_t Copy_u8Channel , uint32_t * Copy_pu32Dropped )
+{
+	if( Copy_pu32Dropped == NULL )
+	{
+		return NULL_POINTER ;
+	}
+
+	if( Copy_u8Channel >= LOGGER_CHANNELS_NUM )
+	{
+		return NOK ;
+	}
+
+	*Copy_pu32Dropped = LOGGER_Rings[ Copy_u8Channel ].Dropped ;
+
+	return OK ;
+}
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: _vDrainNext(void)
+ * @brief 	: THIS FUNCTION STARTS THE NEXT USART DMA CHUNK OF THE CHANNEL BEING DRAINED OR PICKS THE NEXT CHANNEL HAVING RECORDS
+ *
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vDrainNext( void )
+{
+	LOGGER_Ring_t * Local_pRing = &LOGGER_Rings[ LOGGER_DrainChannel ] ;
+
+	uint8_t Local_u8Counter ;
+
+	uint16_t Local_u16Tail ;
+
+	uint16_t Local_u16ToRingEnd ;
+
+	/* CURRENT CHANNEL BACKLOG IS SENT , LOOK FOR THE NEXT CHANNEL HAVING RECORDS ( ROUND ROBIN ) */
+	if( Local_pRing->Tail == LOGGER_DrainEnd )
+	{
+		for( Local_u8Counter = 1 ; Local_u8Counter <= LOGGER_CHANNELS_NUM ; Local_u8Counter++ )
+		{
+			Local_pRing = &LOGGER_Rings[ ( LOGGER_DrainChannel + Local_u8Counter ) % LOGGER_CHANNELS_NUM ] ;
+
+			if( Local_pRing->Head != Local_pRing->Tail )
+			{
+				break ;
+			}
+		}
+
+		if( Local_u8Counter > LOGGER_CHANNELS_NUM )
+		{
+			/* NOTHING TO SEND */
+			LOGGER_DrainState = LOGGER_DRAIN_IDLE ;
+
+			return ;
+		}
+
+		/* SNAPSHOT OF HEAD HOLDS WHOLE RECORDS ONLY , DRAIN UP TO IT BEFORE SWITCHING CHANNELS */
+		LOGGER_DrainChannel = (uint8_t)( ( LOGGER_DrainChannel + Local_u8Counter ) % LOGGER_CHANNELS_NUM ) ;
+		LOGGER_DrainEnd = Local_pRing->Head ;
+	}
+
+	/* CHUNK ENDS AT THE BACKLOG END OR AT THE RING END ( DMA NEEDS CONTIGUOUS MEMORY ) */
+	Local_u16Tail = Local_pRing->Tail ;
+
+	Local_u16ToRingEnd = (uint16_t)( LOGGER_RING_SIZE - ( Local_u16Tail & LOGGER_RING_MASK ) ) ;
+
+	LOGGER_ChunkLength = (uint16_t)( LOGGER_DrainEnd - Local_u16Tail ) ;
+
+	if( LOGGER_ChunkLength > Local_u16ToRingEnd )
+	{
+		LOGGER_ChunkLength = Local_u16ToRingEnd ;
+	}
+
+	if( USART_OK != USART_SendBuffer_DMA( LOGGER_USART , (uint8_t *)&Local_pRing->Buffer[ Local_u16Tail & LOGGER_RING_MASK ] , LOGGER_ChunkLength , _vDrainDone , _vDrainError ) )
+	{
+		/* USART DMA IS USED BY SOMEONE ELSE , NEXT FLUSH RETRIES */
+		LOGGER_ChunkLength = 0 ;
+
+		LOGGER_DrainState = LOGGER_DRAIN_IDLE ;
+	}
+}
+
+/**
+ * @fn 		: _vDrainDone(void)
+ * @brief 	: USART DMA COMPLETION CALL BACK , RELEASES THE SENT BYTES & CONTINUES DRAINING
+ *
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vDrainDone( void )
+{
+	/* RELEASE ONLY A CHUNK STILL IN FLIGHT , A REPEATED COMPLETION MUST NOT MOVE TAIL PAST HEAD */
+	if( LOGGER_DrainState == LOGGER_DRAIN_BUSY && LOGGER_ChunkLength != 0 )
+	{
+		/* DRAIN OWNS TAIL */
+		LOGGER_Rings[ LOGGER_DrainChannel ].Tail += LOGGER_ChunkLength ;
+
+		LOGGER_ChunkLength = 0 ;
+
+		_vDrainNext() ;
+	}
+}
+
+/**
+ * @fn 		: _vDrainError(void)
+ * @brief 	: USART DMA ERROR CALL BACK , STOPS DRAINING SO THE NEXT FLUSH RETRIES THE SAME CHUNK
+ *
+ * @note	: PRIVATE FUNCTION FOR PROVIDER USE ONLY
+ */
+static void _vDrainError( void )
+{
+	LOGGER_ChunkLength = 0 ;
+
+	LOGGER_DrainState = LOGGER_DRAIN_IDLE ;
+}
@@ -0,0 +1,408 @@
+/*
+ ******************************************************************************
+ * @file           : LOGGER_Decoder.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : BINARY LOGGER HOST DECODER ( LINUX )
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/* ======================================================================
+ * PLEASE READ THE FOLLOWING SPECIFICATIONS
+ * ====================================================================== */
+/**
+ *   @BUILD             : gcc -O2 -Wall -o logger_decode LOGGER_Decoder.c
+ *   @USAGE             : ./logger_decode <MESSAGES TABLE> [ CAPTURE FILE | SERIAL DEVICE | - ]
+ *                        WITHOUT A SECOND ARGUMENT ( OR WITH - ) RECORDS ARE READ FROM STDIN
+ *                        A SERIAL DEVICE MUST BE SET TO RAW MODE FIRST , e.g. stty -F /dev/ttyUSB0 115200 raw -echo
+ *   @TABLE_FORMAT      : ONE MESSAGE PER LINE -> <LOG ID> <PRINTF FORMAT STRING>
+ *                        LOG ID IS DECIMAL OR 0x HEX , EMPTY LINES & LINES STARTING WITH # ARE IGNORED
+ *                        SEE LOGGER_Messages.txt
+ *   @CONVERSIONS       : %d %i %u %x %X %o %c TAKE ONE 32-BIT ARGUMENT , %f %e %g TAKE THE ARGUMENT BITS AS A FLOAT
+ *                        FLAGS , WIDTH & PRECISION ARE PASSED THROUGH , %% PRINTS %
+ *   @OUTPUT            : ONE LINE PER RECORD -> [CHANNEL] TEXT
+ *                        UNKNOWN IDS ARE PRINTED WITH THEIR RAW ARGUMENTS , BYTES BEFORE A SYNC BYTE ARE SKIPPED & COUNTED
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ======================================================================
+ * MACROS SECTION ( MUST MATCH LOGGER_Interface.h RECORD FORMAT )
+ * ====================================================================== */
+
+#define LOGGER_SYNC_BYTE			0xA5U
+
+#define LOGGER_HEADER_SIZE			4U
+
+#define LOGGER_ARG_SIZE				4U
+
+/* ARGUMENTS COUNT FIELD IS 4 BITS WIDE */
+#define LOGGER_MAX_ARGS_FIELD		15U
+
+#define DECODER_MAX_MESSAGES		1024U
+
+#define DECODER_MAX_LINE			512U
+
+#define DECODER_MAX_SPEC			32U
+
+/* ======================================================================
+ * TYPES SECTION
+ * ====================================================================== */
+
+typedef struct
+{
+	uint16_t LogID ;
+
+	char * Format ;
+
+}DECODER_Message_t ;
+
+/* ======================================================================
+ * GLOBAL VARIABLES SECTION
+ * ====================================================================== */
+
+static DECODER_Message_t DECODER_Table[ DECODER_MAX_MESSAGES ] ;
+
+static uint32_t DECODER_TableSize = 0 ;
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS SECTION
+ * ====================================================================== */
+
+/**
+ * @fn 		: _iLoadTable(const char*)
+ * @brief 	: LOADS THE LOG ID -> FORMAT STRING TABLE
+ *
+ * @param 	: Copy_pcPath	=> PATH OF THE MESSAGES TABLE
+ * @return	: 0 ON SUCCESS , -1 ON FAILURE
+ */
+static int _iLoadTable( const char * Copy_pcPath )
+{
+	FILE * Local_pFile = fopen( Copy_pcPath , "r" ) ;
+
+	char Local_acLine[ DECODER_MAX_LINE ] ;
+
+	uint32_t Local_u32LineNumber = 0 ;
+
+	if( NULL == Local_pFile )
+	{
+		perror( Copy_pcPath ) ;
+
+		return -1 ;
+	}
+
+	while( NULL != fgets( Local_acLine , sizeof( Local_acLine ) , Local_pFile ) )
+	{
+		char * Local_pcCursor = Local_acLine ;
+		char * Local_pcEnd ;
+		unsigned long Local_ulLogID ;
+		size_t Local_Length ;
+
+		Local_u32LineNumber++ ;
+
+		/* STRIP LINE ENDING */
+		Local_Length = strlen( Local_acLine ) ;
+
+		while( Local_Length > 0 && ( '\n' == Local_acLine[ Local_Length - 1 ] || '\r' == Local_acLine[ Local_Length - 1 ] ) )
+		{
+			Local_acLine[ --Local_Length ] = '\0' ;
+		}
+
+		while( ' ' == *Local_pcCursor || '\t' == *Local_pcCursor )
+		{
+			Local_pcCursor++ ;
+		}
+
+		if( '\0' == *Local_pcCursor || '#' == *Local_pcCursor )
+		{
+			continue ;
+		}
+
+		Local_ulLogID = strtoul( Local_pcCursor , &Local_pcEnd , 0 ) ;
+
+		if( Local_pcEnd == Local_pcCursor || Local_ulLogID > 0xFFFFUL )
+		{
+			fprintf( stderr , "%s:%u: INVALID LOG ID\n" , Copy_pcPath , Local_u32LineNumber ) ;
+
+			fclose( Local_pFile ) ;
+
+			return -1 ;
+		}
+
+		if( DECODER_TableSize >= DECODER_MAX_MESSAGES )
+		{
+			fprintf( stderr , "%s:%u: TOO MANY MESSAGES ( MAXIMUM %u )\n" , Copy_pcPath , Local_u32LineNumber , DECODER_MAX_MESSAGES ) ;
+
+			fclose( Local_pFile ) ;
+
+			return -1 ;
+		}
+
+		/* FORMAT STRING STARTS AFTER THE SEPARATING WHITE SPACE */
+		while( ' ' == *Local_pcEnd || '\t' == *Local_pcEnd )
+		{
+			Local_pcEnd++ ;
+		}
+
+		DECODER_Table[ DECODER_TableSize ].LogID = (uint16_t)Local_ulLogID ;
+		DECODER_Table[ DECODER_TableSize ].Format = strdup( Local_pcEnd ) ;
+
+		if( NULL == DECODER_Table[ DECODER_TableSize ].Format )
+		{
+			fclose( Local_pFile ) ;
+
+			return -1 ;
+		}
+
+		DECODER_TableSize++ ;
+	}
+
+	fclose( Local_pFile ) ;
+
+	return 0 ;
+}
+
+/**
+ * @fn 		: _pcFindFormat(uint16_t)
+ * @brief 	: RETURNS THE FORMAT STRING OF A LOG ID OR NULL IF IT IS NOT IN THE TABLE
+ */
+static const char * _pcFindFormat( uint16_t Copy_u16LogID )
+{
+	uint32_t Local_u32Counter ;
+
+	for( Local_u32Counter = 0 ; Local_u32Counter < DECODER_TableSize ; Local_u32Counter++ )
+	{
+		if( DECODER_Table[ Local_u32Counter ].LogID == Copy_u16LogID )
+		{
+			return DECODER_Table[ Local_u32Counter ].Format ;
+		}
+	}
+
+	return NULL ;
+}
+
+/**
+ * @fn 		: _vPrintRecord(uint8_t, uint16_t, const uint32_t*, uint8_t)
+ * @brief 	: REBUILDS THE TEXT OF A SINGLE RECORD FROM ITS FORMAT STRING & RAW ARGUMENTS
+ */
+static void _vPrintRecord( uint8_t Copy_u8Channel , uint16_t Copy_u16LogID , const uint32_t * Copy_pu32Args , uint8_t Copy_u8ArgsCount )
+{
+	const char * Local_pcFormat = _pcFindFormat( Copy_u16LogID ) ;
+
+	uint8_t Local_u8ArgIndex = 0 ;
+
+	printf( "[%u] " , Copy_u8Channel ) ;
+
+	if( NULL == Local_pcFormat )
+	{
+		printf( "<UNKNOWN ID %u>" , Copy_u16LogID ) ;
+
+		for( Local_u8ArgIndex = 0 ; Local_u8ArgIndex < Copy_u8ArgsCount ; Local_u8ArgIndex++ )
+		{
+			printf( " 0x%08X" , Copy_pu32Args[ Local_u8ArgIndex ] ) ;
+		}
+
+		printf( "\n" ) ;
+
+		return ;
+	}
+
+	while( '\0' != *Local_pcFormat )
+	{
+		char Local_acSpec[ DECODER_MAX_SPEC ] ;
+		size_t Local_SpecLength = 0 ;
+		uint32_t Local_u32Arg ;
+		float Local_fArg ;
+		char Local_cConversion ;
+
+		if( '%' != *Local_pcFormat )
+		{
+			putchar( *Local_pcFormat++ ) ;
+
+			continue ;
+		}
+
+		if( '%' == Local_pcFormat[ 1 ] )
+		{
+			putchar( '%' ) ;
+
+			Local_pcFormat += 2 ;
+
+			continue ;
+		}
+
+		/* COPY % , FLAGS , WIDTH & PRECISION , LENGTH MODIFIERS ARE DROPPED ( ARGUMENTS ARE ALWAYS 32-BIT ) */
+		Local_acSpec[ Local_SpecLength++ ] = *Local_pcFormat++ ;
+
+		while( '\0' != *Local_pcFormat && NULL != strchr( "-+ #0123456789.hlLjzt" , *Local_pcFormat ) )
+		{
+			if( NULL == strchr( "hlLjzt" , *Local_pcFormat ) && Local_SpecLength < DECODER_MAX_SPEC - 2 )
+			{
+				Local_acSpec[ Local_SpecLength++ ] = *Local_pcFormat ;
+			}
+
+			Local_pcFormat++ ;
+		}
+
+		Local_cConversion = *Local_pcFormat ;
+
+		if( '\0' == Local_cConversion )
+		{
+			break ;
+		}
+
+		Local_pcFormat++ ;
+
+		Local_acSpec[ Local_SpecLength++ ] = Local_cConversion ;
+		Local_acSpec[ Local_SpecLength ] = '\0' ;
+
+		if( Local_u8ArgIndex >= Copy_u8ArgsCount )
+		{
+			printf( "<MISSING>" ) ;
+
+			continue ;
+		}
+
+		Local_u32Arg = Copy_pu32Args[ Local_u8ArgIndex++ ] ;
+
+		switch( Local_cConversion )
+		{
+			case 'd' :
+			case 'i' : printf( Local_acSpec , (int32_t)Local_u32Arg ) ; break ;
+
+			case 'u' :
+			case 'x' :
+			case 'X' :
+			case 'o' : printf( Local_acSpec , Local_u32Arg ) ; break ;
+
+			case 'c' : printf( Local_acSpec , (int)( Local_u32Arg & 0xFFU ) ) ; break ;
+
+			case 'f' :
+			case 'F' :
+			case 'e' :
+			case 'E' :
+			case 'g' :
+			case 'G' :
+				memcpy( &Local_fArg , &Local_u32Arg , sizeof( Local_fArg ) ) ;
+				printf( Local_acSpec , (double)Local_fArg ) ;
+				break ;
+
+			default : printf( "<BAD %%%c>" , Local_cConversion ) ; break ;
+		}
+	}
+
+	/* TARGET SENT MORE ARGUMENTS THAN THE FORMAT CONSUMES , TABLE IS LIKELY OUT OF DATE */
+	if( Local_u8ArgIndex < Copy_u8ArgsCount )
+	{
+		printf( " <%u EXTRA ARGS>" , (unsigned)( Copy_u8ArgsCount - Local_u8ArgIndex ) ) ;
+	}
+
+	printf( "\n" ) ;
+}
+
+/* ======================================================================
+ * MAIN
+ * ====================================================================== */
+
+int main( int argc , char * argv[] )
+{
+	FILE * Local_pInput = stdin ;
+
+	uint8_t Local_au8Header[ LOGGER_HEADER_SIZE ] ;
+	uint8_t Local_au8Args[ LOGGER_MAX_ARGS_FIELD * LOGGER_ARG_SIZE ] ;
+	uint32_t Local_au32Args[ LOGGER_MAX_ARGS_FIELD ] ;
+
+	unsigned long Local_ulSkipped = 0 ;
+	unsigned long Local_ulRecords = 0 ;
+
+	int Local_iByte ;
+
+	if( argc < 2 || argc > 3 )
+	{
+		fprintf( stderr , "USAGE: %s <MESSAGES TABLE> [ CAPTURE FILE | SERIAL DEVICE | - ]\n" , argv[ 0 ] ) ;
+
+		return 2 ;
+	}
+
+	if( 0 != _iLoadTable( argv[ 1 ] ) )
+	{
+		return 1 ;
+	}
+
+	if( 3 == argc && 0 != strcmp( argv[ 2 ] , "-" ) )
+	{
+		Local_pInput = fopen( argv[ 2 ] , "rb" ) ;
+
+		if( NULL == Local_pInput )
+		{
+			perror( argv[ 2 ] ) ;
+
+			return 1 ;
+		}
+	}
+
+	/* LINE OUTPUT FOR LIVE SERIAL CAPTURES */
+	setvbuf( stdout , NULL , _IOLBF , 0 ) ;
+
+	while( EOF != ( Local_iByte = fgetc( Local_pInput ) ) )
+	{
+		uint8_t Local_u8Channel ;
+		uint8_t Local_u8ArgsCount ;
+		uint8_t Local_u8Counter ;
+
+		/* RESYNC ON THE SYNC BYTE , e.g. CAPTURE STARTED IN THE MIDDLE OF A RECORD */
+		if( LOGGER_SYNC_BYTE != (uint8_t)Local_iByte )
+		{
+			Local_ulSkipped++ ;
+
+			continue ;
+		}
+
+		Local_au8Header[ 0 ] = (uint8_t)Local_iByte ;
+
+		if( LOGGER_HEADER_SIZE - 1 != fread( &Local_au8Header[ 1 ] , 1 , LOGGER_HEADER_SIZE - 1 , Local_pInput ) )
+		{
+			break ;
+		}
+
+		Local_u8Channel = (uint8_t)( Local_au8Header[ 3 ] >> 4 ) ;
+		Local_u8ArgsCount = (uint8_t)( Local_au8Header[ 3 ] & 0x0FU ) ;
+
+		if( (size_t)Local_u8ArgsCount * LOGGER_ARG_SIZE != fread( Local_au8Args , 1 , (size_t)Local_u8ArgsCount * LOGGER_ARG_SIZE , Local_pInput ) )
+		{
+			break ;
+		}
+
+		for( Local_u8Counter = 0 ; Local_u8Counter < Local_u8ArgsCount ; Local_u8Counter++ )
+		{
+			const uint8_t * Local_pu8Arg = &Local_au8Args[ Local_u8Counter * LOGGER_ARG_SIZE ] ;
+
+			Local_au32Args[ Local_u8Counter ] = (uint32_t)Local_pu8Arg[ 0 ]
+											  | ( (uint32_t)Local_pu8Arg[ 1 ] << 8 )
+											  | ( (uint32_t)Local_pu8Arg[ 2 ] << 16 )
+											  | ( (uint32_t)Local_pu8Arg[ 3 ] << 24 ) ;
+		}
+
+		_vPrintRecord( Local_u8Channel , (uint16_t)( Local_au8Header[ 1 ] | ( Local_au8Header[ 2 ] << 8 ) ) , Local_au32Args , Local_u8ArgsCount ) ;
+
+		Local_ulRecords++ ;
+	}
+
+	fprintf( stderr , "%lu RECORDS DECODED , %lu BYTES SKIPPED\n" , Local_ulRecords , Local_ulSkipped ) ;
+
+	if( stdin != Local_pInput )
+	{
+		fclose( Local_pInput ) ;
+	}
+
+	return 0 ;
+}
@@ -60,18 +60,22 @@ typedef enum
 	DMA_OK,
 	DMA_NOK,
 	DMA_WRONG_CONFIGURATION,
+	DMA_STREAM_BUSY,
 	/*==============
 	 * USART ERRORS
 	 *==============*/
 	USART_OK,
 	USART_NOK,
 	USART_WRONG_CONFIGURATION,
+	USART_RX_OVERRUN,
 	/*==============
 	 * SPI ERRORS
 	 *==============*/
 	SPI_OK,
 	SPI_NOK,
 	SPI_INVALID_CONFIG,
+	SPI_CRC_ERROR,
+	SPI_RING_OVERRUN,
 
 } ERRORS_t;
 
@@ -97,6 +97,8 @@
 #define SYSTICK_BASE_ADDRESS 0xE000E010UL
 #define NVIC_BASE_ADDRESS 0xE000E100UL
 #define SCB_BASE_ADDRESS 0xE000E008UL
+#define DWT_BASE_ADDRESS 0xE0001000UL
+#define DEMCR_ADDRESS 0xE000EDFCUL
 
 /* -------------------------------------------------------------------------------------------------- */
 /* ------------------------------- RCC REGISTERS Definition Structure ------------------------------- */
@@ -297,6 +299,33 @@ typedef struct
 /* ----------------------------------------------------------------------------------------- */
 #define SCB ((SCB_RegDef_t *)SCB_BASE_ADDRESS)
 
+/* ------------------------------------------------------------------------------------------------- */
+/* ------------------------------- DWT REGISTERS Definition Structure ------------------------------ */
+/* ------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	volatile uint32_t CTRL;	  /* Control Register */
+	volatile uint32_t CYCCNT; /* Cycle Count Register , Counts Core ( HCLK ) Cycles While CYCCNTENA is Set */
+} DWT_RegDef_t;
+
+/* ----------------------------------------------------------------------------------------- */
+/* ------------------------------- DWT Peripheral Definition ------------------------------- */
+/* ----------------------------------------------------------------------------------------- */
+#define DWT ((DWT_RegDef_t *)DWT_BASE_ADDRESS)
+
+/* Debug Exception and Monitor Control Register , TRCENA Must be Set Before DWT Can Count */
+#define DEMCR (*(volatile uint32_t *)DEMCR_ADDRESS)
+
+/* ---------------------------------------------------------------------------------- */
+/* ------------------------------- DWT REGISTERS Bits ------------------------------- */
+/* ---------------------------------------------------------------------------------- */
+
+/* DWT_CTRL */
+#define DWT_CTRL_CYCCNTENA 0
+
+/* DEMCR */
+#define DEMCR_TRCENA 24
+
 /* ---------------------------------------------------------------------------------------------------- */
 /* ------------------------------- SYSCFG REGISTERS Definition Structure ------------------------------ */
 /* ---------------------------------------------------------------------------------------------------- */
@@ -619,6 +648,7 @@ typedef struct
 typedef enum
 {
 	I2C_CR1_BIT_SWRST		= 15 ,     /*!< SOFTWARE RESET >!*/
+	I2C_CR1_BIT_POS			= 11 ,     /*!< ACKNOWLEDGE / PEC POSITION >!*/
 	I2C_CR1_BIT_ACK			= 10 ,     /*!< ACKNOWLEDGE ENABLE >!*/
 	I2C_CR1_BIT_STOP		=  9 ,     /*!< STOP GENERATION >!*/
 	I2C_CR1_BIT_START		=  8 ,     /*!< START GENERATION >!*/
@@ -630,6 +660,7 @@ typedef enum
 }I2C_CR1_BIT_t;
 
 #define I2C_CCR_BIT_F_S        15
+#define I2C_CCR_BIT_DUTY       14
 
 typedef enum
 {
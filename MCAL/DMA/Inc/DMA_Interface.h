@@ -354,7 +354,10 @@ ERRORS_t DMA_SetStreamPriority(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t Str
  *           13- EnableIT        => Struct To Enable or Disable Multilple Interrupts -> Check For Options ( @DMA_INT_ENABLE_STRUCT_t )
  *           14- FIFOMode        => To Specify FIFO Mode if Enabled or NOT -> Check For Options ( @DMA_FIFO_MODE_t )
  *           15- FIFOThreshold   => To Specify FIFO Threshold Level  -> Check For Options ( @DMA_FIFO_THRESHOLD_t )
- * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note  : Streams Are Shared Between Peripherals ( e.g. DMA2 Stream2 = SPI1 RX / USART1 RX ) , an Enabled Stream Belongs to Its Current
+ *          Owner Until Its Transfer Ends or It is Disabled , So it is Never Reconfigured Here
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly ( DMA_OK ) or Not ( DMA_WRONG_CONFIGURATION )
+ *          or ( DMA_STREAM_BUSY ) if The Stream is Still Enabled
  */
 ERRORS_t DMA_Init(DMA_INIT_STRUCT_t *Init);
 
@@ -383,7 +386,7 @@ ERRORS_t DMA_DisableStream(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamNumbe
  * @param  : SrcAddress  => Pointer to a Variable that holds the Source Address
  * @param  : DestAddress => Pointer to a Variable that holds the Destination Address
  * @param  : DataLength  => Variable that holds the Number of Data Transfers
- * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly , ( DMA_STREAM_BUSY ) if The Stream is Already Enabled
  */
 ERRORS_t DMA_StartTransfer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *SrcAddress, uint32_t *DestAddress, uint16_t DataLength);
 
@@ -397,6 +400,17 @@ ERRORS_t DMA_StartTransfer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *SrcAddress,
  */
 ERRORS_t DMA_SetCallBack(DMA_INIT_STRUCT_t *InitConfig, DMA_CALLBACK_ID_t CallBackID, void (*Copy_pvCallBack)(void));
 
+/**
+ * @brief  : This Function Reads The Number of Data Items Remaining to Be Transferred in a Certain Stream ( NDTR )
+ * @fn     : DMA_GetRemainingDataCount
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param  : RemainingCount => Pointer to a Variable that holds the Number of Remaining Data Items
+ * @note   : In Circular Mode The Counter is Reloaded Automatically , So Transferred Items = DataLength - RemainingCount
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+ERRORS_t DMA_GetRemainingDataCount(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint16_t *RemainingCount);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
 /* ---------------------------------------------------------------------------------------------- */
@@ -200,18 +200,30 @@ ERRORS_t DMA_SetStreamPriority(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t Str
  *           13- EnableIT        => Struct To Enable or Disable Multilple Interrupts -> Check For Options ( @DMA_INT_ENABLE_STRUCT_t )
  *           14- FIFOMode        => To Specify FIFO Mode if Enabled or NOT -> Check For Options ( @DMA_FIFO_MODE_t )
  *           15- FIFOThreshold   => To Specify FIFO Threshold Level  -> Check For Options ( @DMA_FIFO_THRESHOLD_t )
- * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note  : Streams Are Shared Between Peripherals ( e.g. DMA2 Stream2 = SPI1 RX / USART1 RX ) , an Enabled Stream Belongs to Its Current
+ *          Owner Until Its Transfer Ends or It is Disabled , So it is Never Reconfigured Here
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly ( DMA_OK ) or Not ( DMA_WRONG_CONFIGURATION )
+ *          or ( DMA_STREAM_BUSY ) if The Stream is Still Enabled
  */
 ERRORS_t DMA_Init(DMA_INIT_STRUCT_t *Init)
 {
-    ERRORS_t Local_u8ErrorStatus = OK;
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
 
-    if (DMA_NOK != DMA_CheckInitConfig(Init))
+    if (DMA_NOK == DMA_CheckInitConfig(Init))
     {
-        /* Configuration Are OK */
+        /* Configuration Are NOK */
 
-        /* Make Sure that Stream is Disabled Before Doing Any Configurations */
-        DMA_DisableStream(Init->DMAController, Init->StreamNumber);
+        Local_u8ErrorStatus = DMA_WRONG_CONFIGURATION;
+    }
+    else if (((DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR >> EN) & 1))
+    {
+        /* Stream is Shared Between Several Peripherals & is Still Moving Data For Its Current Owner , Do NOT Steal It */
+
+        Local_u8ErrorStatus = DMA_STREAM_BUSY;
+    }
+    else
+    {
+        /* Configuration Are OK */
 
         /* Set Channel */
         DMA_SetChannel(Init->DMAController, Init->StreamNumber, Init->ChannelNumber);
@@ -233,7 +245,7 @@ ERRORS_t DMA_Init(DMA_INIT_STRUCT_t *Init)
 
         /* Set Peripheral Data Size */
         DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_PSIZE_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->PeriphDataWidth << MSIZE);
+        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->PeriphDataWidth << PSIZE);
 
         /* Data Transfer Direction */
         DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_DIR_MASK);
@@ -267,12 +279,6 @@ ERRORS_t DMA_Init(DMA_INIT_STRUCT_t *Init)
         DMA[Init->DMAController]->STREAM[Init->StreamNumber].FCR &= (DMA_FTH_MASK);
         DMA[Init->DMAController]->STREAM[Init->StreamNumber].FCR |= (Init->FIFOThreshold << FTH);
     }
-    else
-    {
-        /* Configuration Are NOK */
-
-        Local_u8ErrorStatus = DMA_WRONG_CONFIGURATION;
-    }
     return Local_u8ErrorStatus;
 }
 
@@ -358,13 +364,23 @@ ERRORS_t DMA_DisableStream(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamNumbe
  * @param  : SrcAddress  => Pointer to a Variable that holds the Source Address
  * @param  : DestAddress => Pointer to a Variable that holds the Destination Address
  * @param  : DataLength  => Variable that holds the Number of Data Transfers
- * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly , ( DMA_STREAM_BUSY ) if The Stream is Already Enabled
  */
 ERRORS_t DMA_StartTransfer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *SrcAddress, uint32_t *DestAddress, uint16_t DataLength)
 {
     ERRORS_t Local_u8ErrorStatus = DMA_OK;
 
-    if (DMA_NOK != DMA_CheckInitConfig(InitConfig))
+    if (DMA_NOK == DMA_CheckInitConfig(InitConfig))
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else if (((DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].CR >> EN) & 1))
+    {
+        /* Stream Already Moving Data For Another Owner */
+
+        Local_u8ErrorStatus = DMA_STREAM_BUSY;
+    }
+    else
     {
         /* Set Number of Data Transfers */
         DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].NDTR = DataLength;
@@ -394,10 +410,6 @@ ERRORS_t DMA_StartTransfer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *SrcAddress,
         /* Enable Stream */
         DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].CR |= (1 << EN);
     }
-    else
-    {
-        Local_u8ErrorStatus = DMA_NOK;
-    }
     return Local_u8ErrorStatus;
 }
 
@@ -440,6 +452,30 @@ ERRORS_t DMA_SetCallBack(DMA_INIT_STRUCT_t *InitConfig, DMA_CALLBACK_ID_t CallBa
     return Local_u8ErrorStatus;
 }
 
+/**
+ * @brief  : This Function Reads The Number of Data Items Remaining to Be Transferred in a Certain Stream ( NDTR )
+ * @fn     : DMA_GetRemainingDataCount
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param  : RemainingCount => Pointer to a Variable that holds the Number of Remaining Data Items
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+ERRORS_t DMA_GetRemainingDataCount(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint16_t *RemainingCount)
+{
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
+
+    if (DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER ||
+        StreamNumber < DMA_STREAM0 || StreamNumber > DMA_STREAM7 || RemainingCount == NULL)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        *RemainingCount = (uint16_t)DMA[DMAController]->STREAM[StreamNumber].NDTR;
+    }
+    return Local_u8ErrorStatus;
+}
+
 /**
  * @brief : This Function Checks on the Configuration Structure of the DMA to Check if it's Valid or Not
  *
@@ -496,6 +532,10 @@ static ERRORS_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamN
     {
         DMA_Interrupt_Flag_Status_t FlagStatus = DMA_FLAG_RESET;
 
+        /* Flags Are Set by Hardware Even When Their Interrupts Are Disabled , Only Enabled Ones Invoke Call Backs */
+        uint32_t Local_u32StreamCR = DMA[DMANumber]->STREAM[StreamNumber].CR;
+        uint32_t Local_u32StreamFCR = DMA[DMANumber]->STREAM[StreamNumber].FCR;
+
         DMA_ReadInterruptFlag(DMANumber, StreamNumber, TRANSFER_COMPLETE_IT_FLAG, &FlagStatus);
 
         if (FlagStatus == DMA_FLAG_SET)
@@ -504,11 +544,11 @@ static ERRORS_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamN
 
             DMA_ClearInterruptFlag(DMANumber, StreamNumber, TRANSFER_COMPLETE_IT_FLAG);
 
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
+            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER && ((Local_u32StreamCR >> TCIE) & 1))
             {
                 DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK]();
             }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
+            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER && ((Local_u32StreamCR >> TCIE) & 1))
             {
                 DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK]();
             }
@@ -522,11 +562,11 @@ static ERRORS_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamN
 
             DMA_ClearInterruptFlag(DMANumber, StreamNumber, HALF_TRANSFER_IT_FLAG);
 
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
+            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER && ((Local_u32StreamCR >> HTIE) & 1))
             {
                 DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK]();
             }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
+            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER && ((Local_u32StreamCR >> HTIE) & 1))
             {
                 DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK]();
             }
@@ -540,11 +580,11 @@ static ERRORS_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamN
 
             DMA_ClearInterruptFlag(DMANumber, StreamNumber, TRANSFER_ERROR_IT_FLAG);
 
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
+            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER && ((Local_u32StreamCR >> TEIE) & 1))
             {
                 DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK]();
             }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
+            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER && ((Local_u32StreamCR >> TEIE) & 1))
             {
                 DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK]();
             }
@@ -557,11 +597,11 @@ static ERRORS_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamN
 
             DMA_ClearInterruptFlag(DMANumber, StreamNumber, DIRECT_MODE_ERROR_IT_FLAG);
 
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
+            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER && ((Local_u32StreamCR >> DMEIE) & 1))
             {
                 DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK]();
             }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
+            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER && ((Local_u32StreamCR >> DMEIE) & 1))
             {
                 DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK]();
             }
@@ -575,11 +615,11 @@ static ERRORS_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamN
 
             DMA_ClearInterruptFlag(DMANumber, StreamNumber, FIFO_ERROR_IT_FLAG);
 
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
+            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER && ((Local_u32StreamFCR >> FEIE) & 1))
             {
                 DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK]();
             }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
+            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER && ((Local_u32StreamFCR >> FEIE) & 1))
             {
                 DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK]();
             }
@@ -604,6 +644,10 @@ void DMA1_Stream1_IRQHandler(void)
 {
     DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM1);
 }
+void DMA1_Stream2_IRQHandler(void)
+{
+    DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM2);
+}
 void DMA1_Stream3_IRQHandler(void)
 {
     DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM3);
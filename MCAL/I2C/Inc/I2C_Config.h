@@ -19,6 +19,32 @@
 #ifndef I2C_INC_I2C_CONFIG_H_
 #define I2C_INC_I2C_CONFIG_H_
 
+/*==============================================================================================================================================
+ * DMA STREAMS SELECTION ( RM0390 DMA1 REQUEST MAPPING , ALL I2C REQUESTS ARE ON DMA1 )
+ * STREAMS ARE SHARED ( e.g. STREAM 0 = I2C1 RX / SPI3 RX / UART5 RX ) , A TRANSFER WHOSE STREAM IS STILL ENABLED FOR ANOTHER
+ * PERIPHERAL ENDS WITH I2C_TRANSFER_DMA_ERROR , PICK THE ALTERNATIVE STREAM WHEN BOTH PERIPHERALS RUN TOGETHER
+ *==============================================================================================================================================*/
 
+/* I2C1 : RX => STREAM 0 OR STREAM 5 , TX => STREAM 6 OR STREAM 7 , BOTH ON CHANNEL 1 */
+#define I2C1_DMA_RX_STREAM		DMA_STREAM0
+#define I2C1_DMA_TX_STREAM		DMA_STREAM6
+
+/* I2C2 : RX => STREAM 2 OR STREAM 3 , TX => STREAM 7 , BOTH ON CHANNEL 7 */
+#define I2C2_DMA_RX_STREAM		DMA_STREAM2
+#define I2C2_DMA_TX_STREAM		DMA_STREAM7
+
+/*==============================================================================================================================================
+ * BLOCKING FUNCTIONS TIMEOUTS & BUS RECOVERY
+ *==============================================================================================================================================*/
+
+/* CORE ( HCLK ) FREQUENCY IN MHz , DEADLINES & RECOVERY DELAYS ARE COUNTED IN DWT CYCCNT CYCLES SO SYSTICK STAYS FREE FOR THE APPLICATION */
+#define I2C_CORE_CLOCK_MHZ			16UL
+
+/* FIXED PART OF EVERY BLOCKING CALL DEADLINE IN MICROSECONDS ( START , ADDRESS , SLAVE CLOCK STRETCHING ) ,
+ * TWICE THE BYTES TIME AT THE ACHIEVED SCL FREQUENCY IS ADDED ON TOP */
+#define I2C_TIMEOUT_US				1000UL
+
+/* HALF PERIOD OF THE SCL PULSES GENERATED BY GPIO DURING BUS RECOVERY IN MICROSECONDS ( 5us -> 100KHz ) */
+#define I2C_RECOVERY_HALF_PERIOD_US	5UL
 
 #endif /* I2C_INC_I2C_CONFIG_H_ */
@@ -99,8 +99,8 @@ typedef struct
 	uint8_t             AddressingMode     ; /*!< CONFIGURE DEVICE ADDRESSING MODE ,
 												  CHECK AVAILABLE OPTIONS @I2C_ADD_MODE_t >!*/
 
-	uint8_t  			SCLFrequencyKHz    ; /*!< CONFIGURE SPEED OF COMMUNICATION IN KHz ,
-												FOR SM : MAX 100KHz , FOR FM : MAX 400KHZ >!*/
+	uint16_t  			SCLFrequencyKHz    ; /*!< CONFIGURE SPEED OF COMMUNICATION IN KHz ,
+												FOR SM : MAX 100KHz , FOR FM : MAX 400KHZ ( FM NEEDS APB1 >= 4MHz ) >!*/
 
 	I2C_CLK_STRETCH_t	CLKStretch		   ; /*!< CONFIGURE CLOCK STRETCHING OPTIONS ,
 												CHECK AVAILABLE OPTIONS @I2C_CLK_STRETCH_t >!*/
@@ -108,6 +108,75 @@ typedef struct
 
 }I2C_Config_t;
 
+/**
+ * @enum  : @I2C_DUTY_t
+ * @brief : SPECIFIES FAST MODE SCL DUTY CYCLE ( LOW TIME / HIGH TIME ) , STANDARD MODE IS ALWAYS 1 : 1
+ *
+ */
+typedef enum
+{
+	I2C_DUTY_2 = 0 ,   /**< TLOW / THIGH = 2 */
+	I2C_DUTY_16_9      /**< TLOW / THIGH = 16 / 9 */
+
+}I2C_DUTY_t;
+
+/**
+ * @struct : @I2C_TimingInfo_t
+ * @brief  : HOLDS THE RESULT OF AN SCL TIMING CALCULATION
+ */
+typedef struct
+{
+	uint16_t			CCR			  ; /*!< CLOCK CONTROL REGISTER VALUE ( 12 BITS ) >!*/
+
+	I2C_DUTY_t			Duty		  ; /*!< SELECTED FAST MODE DUTY , CHECK @I2C_DUTY_t >!*/
+
+	uint8_t				TRISE		  ; /*!< MAXIMUM RISE TIME REGISTER VALUE >!*/
+
+	uint32_t			AchievedSCLHz ; /*!< REAL SCL FREQUENCY IN Hz , NEVER ABOVE THE REQUESTED ONE >!*/
+
+}I2C_TimingInfo_t;
+
+/**
+ * @enum  : @I2C_TransferStatus_t
+ * @brief : SPECIFIES STATUS OF AN INTERRUPT DRIVEN TRANSFER
+ *
+ */
+typedef enum
+{
+	I2C_TRANSFER_DONE = 0 ,   /**< TRANSFER COMPLETED , STOP SENT */
+	I2C_TRANSFER_BUSY ,       /**< TRANSFER STILL IN PROGRESS */
+	I2C_TRANSFER_NACK ,       /**< SLAVE DID NOT ACKNOWLEDGE ADDRESS OR DATA */
+	I2C_TRANSFER_ARB_LOST ,   /**< ANOTHER MASTER WON THE BUS */
+	I2C_TRANSFER_BUS_ERROR ,  /**< MISPLACED START OR STOP ON THE BUS */
+	I2C_TRANSFER_OVERRUN ,    /**< DATA LOST ( CLOCK STRETCHING DISABLED ) */
+	I2C_TRANSFER_TIMEOUT ,    /**< TRANSFER DID NOT COMPLETE IN TIME */
+	I2C_TRANSFER_DMA_ERROR    /**< DMA STREAM COULD NOT BE STARTED OR STOPPED BEFORE MOVING ALL BYTES */
+
+}I2C_TransferStatus_t;
+
+/**
+ * @struct : @I2C_Transfer_t
+ * @brief  : DESCRIBES A MASTER TRANSFER : WRITE ONLY ( RxSize = 0 ) , READ ONLY ( TxSize = 0 ) OR
+ * 			 WRITE THEN READ WITH REPEATED START ( BOTH NON ZERO )
+ */
+typedef struct
+{
+	uint16_t  		    SlaveAddress ; /*!< 7 BIT SLAVE ADDRESS >!*/
+
+	uint8_t * 			TxBuffer	 ; /*!< BYTES TO WRITE FIRST >!*/
+
+	uint16_t  			TxSize		 ; /*!< NUMBER OF BYTES TO WRITE >!*/
+
+	uint8_t * 			RxBuffer	 ; /*!< BUFFER FOR THE BYTES READ AFTER WRITING >!*/
+
+	uint16_t  			RxSize		 ; /*!< NUMBER OF BYTES TO READ >!*/
+
+	void ( * CallBack )( void )	 	 ; /*!< INVOKED FROM INTERRUPT CONTEXT ONCE THE TRANSFER ENDS , CHECK Status >!*/
+
+	volatile I2C_TransferStatus_t Status ; /*!< SET BY THE DRIVER , CHECK @I2C_TransferStatus_t >!*/
+
+}I2C_Transfer_t;
+
 
 /*==============================================================================================================================================
  * PROTOTYPES SECTION
@@ -121,6 +190,25 @@ typedef struct
  */
 ERRORS_t MI2C_eInit( I2C_Config_t * I2CConfig ) ;
 
+/**
+ * @fn     : MI2C_eCalculateTiming(I2C_Config_t*, I2C_TimingInfo_t*)
+ * @brief  : FUNCTION THAT CALCULATES CCR , DUTY & TRISE FOR THE SPEED MODE , APB1 CLOCK & SCL FREQUENCY IN CONFIGURATION
+ * @param  : I2CConfig => POINTER TO STRUCT THAT CONTAINS I2C PERIPHERAL CONFIGURATION
+ * @param  : Timing    => RETURN FOR REGISTERS VALUES & ACHIEVED SCL FREQUENCY , CHECK @I2C_TimingInfo_t
+ * @return : ERROR STATUS , NOK IF THE SCL FREQUENCY CAN NOT BE REACHED WITHIN THE SPEED MODE LIMITS
+ * @note   : NOTHING IS WRITTEN TO THE PERIPHERAL , USE IT TO CHECK A CONFIGURATION BEFORE MI2C_eInit
+ */
+ERRORS_t MI2C_eCalculateTiming( I2C_Config_t * I2CConfig , I2C_TimingInfo_t * Timing ) ;
+
+/**
+ * @fn     : MI2C_eGetTimingInfo(I2C_t, I2C_TimingInfo_t*)
+ * @brief  : FUNCTION THAT RETURNS THE SCL TIMING PROGRAMMED BY THE LAST SUCCESSFUL MI2C_eInit
+ * @param  : I2CNumber => I2C NUMBER , CHECK @I2C_t
+ * @param  : Timing    => RETURN FOR REGISTERS VALUES & ACHIEVED SCL FREQUENCY , CHECK @I2C_TimingInfo_t
+ * @return : ERROR STATUS
+ */
+ERRORS_t MI2C_eGetTimingInfo( I2C_t I2CNumber , I2C_TimingInfo_t * Timing ) ;
+
 /**
  * @fn 		: MI2C_eSendStartCondition
  * @brief 	: THIS FUNCTION SENDS START CONDITION FOLLOWED BY SLAVE ADDRESS FOLLOWED BY RW BIT
@@ -128,8 +216,10 @@ ERRORS_t MI2C_eInit( I2C_Config_t * I2CConfig ) ;
  * @param   : I2CConfig				=> A POINTER TO STRUCTURE THAT CARRIES I2C CONFIGURATION INFO
  * @param 	: Copy_u16SlaveAddress 	=> SLAVE ADDRESS ON THE BUS TO COMMUNICATE WITH
  * @param 	: Copy_u8RWBit			=> RW BIT FOLLOWED BY SLAVE ADDRESS , CHECK @I2C_RW_BIT_t
- * @return	: ERROR  STATUS TO INDICATE FOR MALFUNCTION
- * @note    : 10 BIT SLAVE ADDRESS NOT SUPPORTED YET
+ * @return	: ERROR  STATUS TO INDICATE FOR MALFUNCTION , NOK IF THE SLAVE DID NOT ACKNOWLEDGE ,
+ * 			  TIME_OUT_ERROR IF THE DEADLINE PASSED ( BUS IS RECOVERED BEFORE RETURNING )
+ * @note    : 10 BIT SLAVE ADDRESS NOT SUPPORTED YET , ALL BLOCKING FUNCTIONS COUNT THEIR DEADLINES ON THE DWT CYCLE COUNTER
+ * 			  ALL BLOCKING FUNCTIONS RETURN NOK WITHOUT TOUCHING THE BUS WHILE AN INTERRUPT OR DMA TRANSFER IS RUNNING ON THE SAME I2C
  */
 ERRORS_t MI2C_eSendStartCondition( I2C_Config_t * I2CConfig , uint16_t Copy_u16SlaveAddress , I2C_RW_BIT_t Copy_u8RWBit ) ;
 
@@ -174,5 +264,65 @@ ERRORS_t MI2C_eReadData( I2C_Config_t * I2CConfig , uint8_t* Copy_u8DataBuffer ,
  */
 ERRORS_t MI2C_eSendRepeatedStart( I2C_Config_t * I2CConfig , uint16_t Copy_u16SlaveAddress , I2C_RW_BIT_t Copy_u8RWBit ) ;
 
+/**
+ * @fn 		: MI2C_eSetRecoveryPins
+ * @brief 	: THIS FUNCTION SETS THE GPIO PINS OF AN I2C SO BUS RECOVERY CAN CLOCK OUT A SLAVE HOLDING SDA LOW
+ * @param 	: I2CNumber		=> I2C NUMBER , CHECK @I2C_t
+ * @param 	: Copy_u8SCLPort=> SCL PIN PORT , CHECK @Port_t
+ * @param 	: Copy_u8SCLPin	=> SCL PIN NUMBER , CHECK @Pin_t
+ * @param 	: Copy_u8SDAPort=> SDA PIN PORT , CHECK @Port_t
+ * @param 	: Copy_u8SDAPin	=> SDA PIN NUMBER , CHECK @Pin_t
+ * @param 	: Copy_u8AltFunc=> I2C ALTERNATE FUNCTION OF THE PINS ( AF4 ON MOST PINS ) , CHECK @AltFunc_t
+ * @return	: ERROR STATUS
+ * @note    : WITHOUT RECOVERY PINS , BUS RECOVERY ONLY RESETS & REINITIALIZES THE PERIPHERAL
+ */
+ERRORS_t MI2C_eSetRecoveryPins( I2C_t I2CNumber , uint8_t Copy_u8SCLPort , uint8_t Copy_u8SCLPin , uint8_t Copy_u8SDAPort , uint8_t Copy_u8SDAPin , uint8_t Copy_u8AltFunc ) ;
+
+/**
+ * @fn 		: MI2C_eRecoverBus
+ * @brief 	: THIS FUNCTION FREES A STUCK BUS : UP TO 9 SCL PULSES UNTIL SDA IS RELEASED , A STOP CONDITION , THEN A PERIPHERAL
+ * 			  SOFTWARE RESET & REINITIALIZATION , A RUNNING INTERRUPT OR DMA TRANSFER IS ENDED WITH I2C_TRANSFER_TIMEOUT
+ * @param 	: I2CConfig	=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @return	: ERROR STATUS , NOK IF SDA IS STILL HELD LOW AFTER RECOVERY
+ * @note    : CALLED AUTOMATICALLY WHEN A BLOCKING FUNCTION OR A BACKGROUND TRANSFER MISSES ITS DEADLINE , DELAYS USE THE DWT CYCLE COUNTER
+ */
+ERRORS_t MI2C_eRecoverBus( I2C_Config_t * I2CConfig ) ;
+
+/**
+ * @fn 		: MI2C_eMasterTransfer_IT
+ * @brief 	: THIS FUNCTION STARTS A MASTER TRANSFER THAT RUNS IN THE BACKGROUND ON I2C EVENT & ERROR INTERRUPTS
+ * @param 	: I2CConfig	=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @param 	: Transfer	=> A POINTER TO THE TRANSFER DESCRIPTOR , CHECK @I2C_Transfer_t
+ * @return	: ERROR STATUS , NOK IF A TRANSFER IS ALREADY RUNNING ON THE SAME I2C ,
+ * 			  BUS_ERROR IF THE BUS IS STILL HELD ( STOP PENDING OR BUSY FLAG SET ) I2C_BUS_RELEASE_SCL_PERIODS SCL PERIODS LATER , NOTHING IS STARTED
+ * @note    : DESCRIPTOR & BUFFERS MUST STAY VALID UNTIL THE CALL BACK , I2C EV & ER IRQs MUST BE ENABLED IN THE NVIC
+ * 			  CALL MI2C_eCheckTimeout PERIODICALLY SO A TRANSFER THAT STOPS INTERRUPTING STILL ENDS
+ */
+ERRORS_t MI2C_eMasterTransfer_IT( I2C_Config_t * I2CConfig , I2C_Transfer_t * Transfer ) ;
+
+/**
+ * @fn 		: MI2C_eMasterTransfer_DMA
+ * @brief 	: THIS FUNCTION STARTS A MASTER TRANSFER WHOSE DATA BYTES ARE MOVED BY DMA , ONLY START , ADDRESS & END OF
+ * 			  TRANSFER EVENTS INTERRUPT THE CPU , NACK & STOP AFTER THE LAST RECEIVED BYTE ARE HANDLED BY HARDWARE ( LAST BIT )
+ * @param 	: I2CConfig	=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @param 	: Transfer	=> A POINTER TO THE TRANSFER DESCRIPTOR , CHECK @I2C_Transfer_t
+ * @return	: ERROR STATUS , NOK IF A TRANSFER IS ALREADY RUNNING ON THE SAME I2C ,
+ * 			  BUS_ERROR IF THE BUS IS STILL HELD ( STOP PENDING OR BUSY FLAG SET ) I2C_BUS_RELEASE_SCL_PERIODS SCL PERIODS LATER , NOTHING IS STARTED
+ * @note    : I2C EV & ER IRQs AND THE I2C DMA STREAMS IRQs MUST BE ENABLED IN THE NVIC , STREAMS ARE SELECTED IN I2C_Config.h
+ * 			  CALL MI2C_eCheckTimeout PERIODICALLY SO A TRANSFER THAT STOPS INTERRUPTING STILL ENDS
+ */
+ERRORS_t MI2C_eMasterTransfer_DMA( I2C_Config_t * I2CConfig , I2C_Transfer_t * Transfer ) ;
+
+/**
+ * @fn 		: MI2C_eCheckTimeout
+ * @brief 	: THIS FUNCTION ENDS AN INTERRUPT OR DMA TRANSFER THAT OUTLIVED ITS DEADLINE : THE BUS IS RECOVERED ( MI2C_eRecoverBus )
+ * 			  & THE TRANSFER ENDS WITH I2C_TRANSFER_TIMEOUT
+ * @param 	: I2CNumber	=> I2C NUMBER USED , CHECK @I2C_t
+ * @return	: ERROR STATUS , TIME_OUT_ERROR IF A TRANSFER WAS ABORTED , NOK IF I2CNumber IS WRONG
+ * @note    : A TRANSFER THAT STOPS INTERRUPTING ( SLAVE HOLDING SCL , LOST EVENT ) IS ONLY CAUGHT HERE , CALL IT PERIODICALLY
+ * 			  ( SUPER LOOP OR TIMER ) WHILE A TRANSFER RUNS , THE DEADLINE IS THE ONE OF A BLOCKING CALL MOVING THE SAME BYTES
+ */
+ERRORS_t MI2C_eCheckTimeout( I2C_t I2CNumber ) ;
+
 
 #endif /* I2C_INC_I2C_INTERFACE_H_ */
@@ -25,20 +25,138 @@
 
 #define MAX_DELAY                   ( 0xFFFF )
 
+/* SCL TIMING LIMITS ( RM0390 I2C_CCR & I2C_TRISE , I2C SPECIFICATION MAXIMUM RISE TIMES ) */
+#define I2C_SM_MAX_SCL_KHZ			( 100U )
+#define I2C_FM_MAX_SCL_KHZ			( 400U )
+
+#define I2C_FM_MIN_FREQ_MHZ			( 4U )
+
+#define I2C_CCR_SM_MIN				( 4U )
+#define I2C_CCR_FM_MIN				( 1U )
+#define I2C_CCR_MAX					( 0x0FFFU )
+
+#define I2C_SM_MAX_RISE_NS			( 1000U )
+#define I2C_FM_MAX_RISE_NS			( 300U )
+
+/* SCL PERIOD IN PCLK1 CYCLES PER CCR UNIT : SM ( 1 + 1 ) , FM DUTY 2 ( 1 + 2 ) , FM DUTY 16/9 ( 9 + 16 ) */
+#define I2C_SM_PERIOD_UNITS			( 2U )
+#define I2C_FM_DUTY_2_PERIOD_UNITS	( 3U )
+#define I2C_FM_DUTY_16_9_PERIOD_UNITS ( 25U )
+
+#define I2C_STATE_IDLE				( 0 )
+#define I2C_STATE_BUSY				( 1 )
+
+#define I2C_PHASE_TX				( 0 )
+#define I2C_PHASE_RX				( 1 )
+/* WRITE THEN READ : REPEATED START REQUESTED , WAITING FOR SB BEFORE RECEIVING */
+#define I2C_PHASE_RESTART			( 2 )
+
+#define I2C_MODE_IT					( 0 )
+#define I2C_MODE_DMA				( 1 )
+
+#define I2C_SR1_ERRORS_MASK			( ( 1 << I2C_SR1_BERR ) | ( 1 << I2C_SR1_ARLO ) | ( 1 << I2C_SR1_AF ) | ( 1 << I2C_SR1_OVR ) | ( 1 << I2C_SR1_TIMEOUT ) )
+
+#define I2C_CR2_IT_MASK				( ( 1 << I2C_CR2_BIT_ITEVTEN ) | ( 1 << I2C_CR2_BIT_ITBUFEN ) | ( 1 << I2C_CR2_BIT_ITERREN ) )
+
+#define I2C_RECOVERY_PINS_UNSET		( 0 )
+#define I2C_RECOVERY_PINS_SET		( 1 )
+
+/* SCL PULSES NEEDED TO CLOCK OUT A BYTE & ITS ACK FROM A STUCK SLAVE */
+#define I2C_RECOVERY_PULSES			( 9U )
+
+/* SCL PERIODS A TRANSFER START WAITS FOR THE PREVIOUS STOP TO LEAVE THE BUS ( THE STOP ITSELF TAKES ABOUT ONE ) */
+#define I2C_BUS_RELEASE_SCL_PERIODS	( 4UL )
+
+/* SCL FREQUENCY ASSUMED FOR DEADLINES BEFORE THE FIRST MI2C_eInit */
+#define I2C_DEFAULT_SCL_HZ			( 100000UL )
+
+/*==============================================================================================================================================
+ * PRIVATE TYPES SECTION
+ *==============================================================================================================================================*/
+
+/**
+ * @struct : @I2C_RecoveryPins_t
+ * @brief  : HOLDS THE GPIO PINS USED TO RECOVER A STUCK BUS
+ */
+typedef struct
+{
+	uint8_t			   State	 ; /*!< I2C_RECOVERY_PINS_UNSET / I2C_RECOVERY_PINS_SET >!*/
+
+	uint8_t			   SCLPort	 ;
+
+	uint8_t			   SCLPin	 ;
+
+	uint8_t			   SDAPort	 ;
+
+	uint8_t			   SDAPin	 ;
+
+	uint8_t			   AltFunc	 ;
+
+}I2C_RecoveryPins_t;
+
+/**
+ * @struct : @I2C_Handle_t
+ * @brief  : HOLDS THE PROGRESS OF THE INTERRUPT DRIVEN TRANSFER OF ONE I2C PERIPHERAL
+ */
+typedef struct
+{
+	I2C_Transfer_t *   Transfer  ; /*!< TRANSFER IN PROGRESS >!*/
+
+	I2C_Config_t *	   Config	 ; /*!< CONFIGURATION OF THE RUNNING TRANSFER , USED TO RECOVER THE BUS ON ITS DEADLINE >!*/
+
+	volatile uint8_t   State     ; /*!< I2C_STATE_IDLE / I2C_STATE_BUSY >!*/
+
+	uint8_t			   Phase	 ; /*!< I2C_PHASE_TX / I2C_PHASE_RX / I2C_PHASE_RESTART >!*/
+
+	uint16_t		   Index	 ; /*!< NEXT BYTE TO WRITE OR READ >!*/
+
+	uint8_t			   Mode		 ; /*!< I2C_MODE_IT / I2C_MODE_DMA >!*/
+
+}I2C_Handle_t;
+
+/**
+ * @struct : @I2C_Deadline_t
+ * @brief  : HOLDS A DEADLINE COUNTED ON THE DWT CYCLE COUNTER , WRAP AROUND SAFE AS ONLY THE ELAPSED CYCLES ARE COMPARED
+ */
+typedef struct
+{
+	uint32_t		   StartCycles ; /*!< CYCCNT WHEN THE DEADLINE WAS STARTED >!*/
+
+	uint32_t		   Cycles	 ; /*!< CYCLES ALLOWED BEFORE EXPIRY >!*/
+
+}I2C_Deadline_t;
+
+/**
+ * @struct : @I2C_DMA_MAP_t
+ * @brief  : HOLDS THE DMA STREAMS & CHANNEL CONNECTED TO AN I2C PERIPHERAL
+ */
+typedef struct
+{
+	DMA_STREAMS_t	   RxStream	 	 ;
+
+	DMA_STREAMS_t	   TxStream	 	 ;
+
+	DMA_CHANNEL_t	   ChannelNumber ;
+
+}I2C_DMA_MAP_t;
+
 
 /*==============================================================================================================================================
  * PRIVATE FUNCTIONS
  *==============================================================================================================================================*/
 
 /**
- * @fn    : _u16CalculateCCR
- * @brief : Calculates CCR Value From SCL Frequency & PCLK1 Provided in Configurations
+ * @fn    : _u32CalculateCCR
+ * @brief : Calculates The Smallest CCR Value Giving an SCL Frequency Not Above The Requested One
  *
- * @param : I2CConfig => Pointer to Structure that holds I2C Configuration Parameters
- * @retval: CCR Value
+ * @param : Copy_u32PCLKHz    => PCLK1 Frequency in Hz
+ * @param : Copy_u32SCLHz     => Requested SCL Frequency in Hz
+ * @param : Copy_u8PeriodUnits=> SCL Period in PCLK1 Cycles per CCR Unit ( I2C_SM_PERIOD_UNITS , I2C_FM_DUTY_xx_PERIOD_UNITS )
+ * @param : Copy_u16MinCCR    => Smallest CCR Allowed in The Speed Mode
+ * @retval: CCR Value , May Exceed I2C_CCR_MAX if The SCL Frequency is Too Low
  * @note  : Private Function For Provider Use ONLY
  */
-static uint16_t _u16CalculateCCR( I2C_Config_t * I2CConfig ) ;
+static uint32_t _u32CalculateCCR( uint32_t Copy_u32PCLKHz , uint32_t Copy_u32SCLHz , uint8_t Copy_u8PeriodUnits , uint16_t Copy_u16MinCCR ) ;
 
 /**
  * @fn 		: MI2C_vEnableACK
@@ -70,6 +188,16 @@ static void MI2C_vDisableACK( I2C_Config_t * I2CConfig  ) ;
  */
 static ERRORS_t _eI2CCheckConfig( I2C_Config_t * I2CConfig ) ;
 
+/**
+ * @fn		: _eCheckBlockingCall(I2C_Config_t*)
+ * @brief 	: THIS FUNCTION CHECKS THAT A BLOCKING CALL MAY DRIVE THE BUS : VALID CONFIGURATION & NO INTERRUPT OR DMA TRANSFER RUNNING
+ *
+ * @param 	: I2CConfig => A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @return	: OK , NOK IF THE CONFIGURATION IS WRONG OR THE I2C IS BOOKED BY A BACKGROUND TRANSFER
+ * @note 	: PRIVATE FUNCTION
+ */
+static ERRORS_t _eCheckBlockingCall( I2C_Config_t * I2CConfig ) ;
+
 /**
  * @fn 		:  _vClearADDR(I2C_t)
  * @brief 	: THIS FUNCTION CLEARS ADDR FLAG IN SR1 REGISTER
@@ -80,4 +208,147 @@ static ERRORS_t _eI2CCheckConfig( I2C_Config_t * I2CConfig ) ;
  */
 static uint16_t _vClearADDR( I2C_t I2CNumber ) ;
 
+/**
+ * @fn 		: _vStartDeadline(I2C_t, uint16_t)
+ * @brief 	: THIS FUNCTION STARTS THE DEADLINE OF A BLOCKING CALL OR BACKGROUND TRANSFER : I2C_TIMEOUT_US + TWICE THE TIME OF THE BYTES AT THE ACHIEVED SCL
+ *
+ * @param 	: I2CNumber		=> I2C NUMBER USED
+ * @param 	: Copy_u16Bytes	=> NUMBER OF BYTES THE CALL MOVES ( ADDRESS BYTE INCLUDED )
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vStartDeadline( I2C_t I2CNumber , uint16_t Copy_u16Bytes ) ;
+
+/**
+ * @fn 		: _u32EnterCritical(void)
+ * @brief 	: THIS FUNCTION MASKS INTERRUPTS & RETURNS THE PREVIOUS MASK ( PRIMASK )
+ *
+ * @return	: PREVIOUS PRIMASK VALUE TO PASS TO _vExitCritical
+ * @note	: PRIVATE FUNCTION , KEEPS A TIMEOUT CHECK FROM RACING THE COMPLETION INTERRUPTS
+ */
+static uint32_t _u32EnterCritical( void ) ;
+
+/**
+ * @fn 		: _vExitCritical(uint32_t)
+ * @brief 	: THIS FUNCTION RESTORES THE INTERRUPTS MASK SAVED BY _u32EnterCritical
+ *
+ * @param 	: Copy_u32PriMask	=> VALUE RETURNED BY _u32EnterCritical
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vExitCritical( uint32_t Copy_u32PriMask ) ;
+
+/**
+ * @fn 		: _u8IsDeadlineExpired(I2C_t)
+ * @brief 	: THIS FUNCTION TELLS IF THE DEADLINE STARTED BY _vStartDeadline ON AN I2C HAS PASSED
+ *
+ * @param 	: I2CNumber	=> I2C NUMBER USED
+ * @return	: 1 IF EXPIRED , 0 OTHERWISE
+ * @note	: PRIVATE FUNCTION
+ */
+static uint8_t _u8IsDeadlineExpired( I2C_t I2CNumber ) ;
+
+/**
+ * @fn 		: _vDelayus(uint32_t)
+ * @brief 	: THIS FUNCTION BUSY WAITS ON THE DWT CYCLE COUNTER
+ *
+ * @param 	: Copy_u32TimeUs	=> TIME TO WAIT IN MICROSECONDS
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vDelayus( uint32_t Copy_u32TimeUs ) ;
+
+/**
+ * @fn 		: _eWaitBusRelease(I2C_t)
+ * @brief 	: THIS FUNCTION WAITS AT MOST I2C_BUS_RELEASE_SCL_PERIODS SCL PERIODS FOR A PENDING STOP & THE BUSY FLAG TO CLEAR
+ *
+ * @param 	: I2CNumber	=> I2C NUMBER USED
+ * @return	: OK IF THE BUS IS RELEASED , BUS_ERROR OTHERWISE
+ * @note	: PRIVATE FUNCTION , SHORT ENOUGH TO RUN FROM A COMPLETION INTERRUPT THAT CHAINS THE NEXT TRANSFER
+ */
+static ERRORS_t _eWaitBusRelease( I2C_t I2CNumber ) ;
+
+/**
+ * @fn 		: _eWaitSR1(I2C_Config_t*, uint8_t)
+ * @brief 	: THIS FUNCTION WAITS FOR AN SR1 FLAG UNTIL THE RUNNING DEADLINE , RECOVERING THE BUS IF IT PASSES
+ *
+ * @param 	: I2CConfig		=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @param 	: Copy_u8Flag	=> SR1 FLAG BIT ( I2C_SR1_SB , I2C_SR1_ADDR , I2C_SR1_TXE , ... )
+ * @return	: OK IF SET , NOK IF THE SLAVE DID NOT ACKNOWLEDGE ( STOP SENT ) , TIME_OUT_ERROR IF THE DEADLINE PASSED
+ * @note	: PRIVATE FUNCTION
+ */
+static ERRORS_t _eWaitSR1( I2C_Config_t * I2CConfig , uint8_t Copy_u8Flag ) ;
+
+/**
+ * @fn 		: _vClockOutBus(I2C_t)
+ * @brief 	: THIS FUNCTION DRIVES SCL BY GPIO UNTIL THE SLAVE RELEASES SDA ( 9 PULSES AT MOST ) THEN GENERATES A STOP CONDITION
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @note	: PRIVATE FUNCTION , PINS ARE GIVEN BACK TO THE I2C AFTERWARDS
+ */
+static void _vClockOutBus( I2C_t I2CNumber ) ;
+
+/**
+ * @fn 		: _eStartTransfer(I2C_Config_t*, I2C_Transfer_t*, uint8_t)
+ * @brief 	: THIS FUNCTION CHECKS A TRANSFER DESCRIPTOR , BOOKS THE I2C & SENDS THE START CONDITION
+ *
+ * @param 	: I2CConfig	=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @param 	: Transfer	=> A POINTER TO THE TRANSFER DESCRIPTOR
+ * @param 	: Mode		=> I2C_MODE_IT / I2C_MODE_DMA
+ * @return	: ERROR STATUS
+ * @note	: PRIVATE FUNCTION
+ */
+static ERRORS_t _eStartTransfer( I2C_Config_t * I2CConfig , I2C_Transfer_t * Transfer , uint8_t Mode ) ;
+
+/**
+ * @fn 		: _eStartDMA(I2C_t)
+ * @brief 	: THIS FUNCTION STARTS THE DMA STREAM OF THE CURRENT PHASE & ENABLES I2C DMA REQUESTS , CALLED ON ADDR BEFORE CLEARING IT
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @return	: OK , NOK IF THE STREAM COULD NOT BE CONFIGURED OR STARTED ( I2C DMA REQUESTS STAY DISABLED )
+ * @note	: PRIVATE FUNCTION
+ */
+static ERRORS_t _eStartDMA( I2C_t I2CNumber ) ;
+
+/**
+ * @fn 		: _vDMAHandler(I2C_t, uint8_t)
+ * @brief 	: THIS FUNCTION HANDLES THE END OF AN I2C DMA STREAM ( TRANSFER COMPLETE OR TRANSFER ERROR )
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @param 	: Direction => I2C_PHASE_TX / I2C_PHASE_RX
+ * @note	: PRIVATE FUNCTION , CALLED FROM THE DMA STREAM CALL BACKS
+ */
+static void _vDMAHandler( I2C_t I2CNumber , uint8_t Direction ) ;
+
+/* DMA STREAM CALL BACKS REGISTERED IN THE DMA DRIVER */
+static void _vI2C1_DMATxHandler( void ) ;
+static void _vI2C1_DMARxHandler( void ) ;
+static void _vI2C2_DMATxHandler( void ) ;
+static void _vI2C2_DMARxHandler( void ) ;
+
+/**
+ * @fn 		: _vEventHandler(I2C_t)
+ * @brief 	: THIS FUNCTION MOVES THE INTERRUPT DRIVEN TRANSFER ON I2C EVENTS ( SB , ADDR , TXE , RXNE , BTF )
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vEventHandler( I2C_t I2CNumber ) ;
+
+/**
+ * @fn 		: _vErrorHandler(I2C_t)
+ * @brief 	: THIS FUNCTION ENDS THE INTERRUPT DRIVEN TRANSFER ON I2C ERRORS ( BERR , ARLO , AF , OVR , TIMEOUT )
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vErrorHandler( I2C_t I2CNumber ) ;
+
+/**
+ * @fn 		: _vEndTransfer(I2C_t, I2C_TransferStatus_t)
+ * @brief 	: THIS FUNCTION DISABLES I2C INTERRUPTS , RELEASES THE PERIPHERAL & INVOKES THE TRANSFER CALL BACK
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @param 	: Status	=> TRANSFER RESULT , CHECK @I2C_TransferStatus_t
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vEndTransfer( I2C_t I2CNumber , I2C_TransferStatus_t Status ) ;
+
 #endif /* I2C_INC_I2C_PRV_H_ */
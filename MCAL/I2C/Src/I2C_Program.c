@@ -21,7 +21,11 @@
 #include "../../../LIB/ErrType.h"
 #include "../../../LIB/STM32F446xx.h"
 
+#include "../../DMA/Inc/DMA_Interface.h"
+#include "../../GPIO/Inc/GPIO_Interface.h"
+
 #include "../Inc/I2C_Interface.h"
+#include "../Inc/I2C_Config.h"
 #include "../Inc/I2C_Prv.h"
 
 /*==============================================================================================================================================
@@ -30,6 +34,35 @@
 
 I2C_RegDef_t * I2C[ I2C_MAX_NUMBER ] = { I2C1 , I2C2 , I2C3 } ;
 
+/* SCL TIMING PROGRAMMED BY MI2C_eInit , ONE PER I2C */
+static I2C_TimingInfo_t I2C_Timing[ I2C_MAX_NUMBER ] ;
+
+/* GPIO PINS USED FOR BUS RECOVERY , ONE PER I2C */
+static I2C_RecoveryPins_t I2C_RecoveryPins[ I2C_MAX_NUMBER ] ;
+
+/* DEADLINES ON THE DWT CYCLE COUNTER , ONE PER I2C */
+static I2C_Deadline_t I2C_Deadline[ I2C_MAX_NUMBER ] ;
+
+/* INTERRUPT DRIVEN TRANSFERS PROGRESS , ONE PER I2C */
+static I2C_Handle_t I2C_Handle[ I2C_MAX_NUMBER ] ;
+
+/* I2C DMA REQUEST MAPPING ON DMA1 , I2C3 NOT SUPPORTED YET ( CHECK @I2C_t ) */
+static const I2C_DMA_MAP_t I2C_DMA_MAP[ I2C_MAX_NUMBER ] =
+{
+	{ I2C1_DMA_RX_STREAM , I2C1_DMA_TX_STREAM , DMA_CHANNEL1 } , /* I2C1 */
+	{ I2C2_DMA_RX_STREAM , I2C2_DMA_TX_STREAM , DMA_CHANNEL7 }   /* I2C2 */
+} ;
+
+/* I2C DMA STREAMS CONFIGURATIONS [ I2C_PHASE_TX / I2C_PHASE_RX ] */
+static DMA_INIT_STRUCT_t I2C_DMAConfig[ I2C_MAX_NUMBER ][ 2 ] ;
+
+/* DMA STREAM CALL BACKS OF EACH I2C [ I2C_PHASE_TX / I2C_PHASE_RX ] */
+static void ( * const I2C_DMA_Handler[ I2C_MAX_NUMBER ][ 2 ] )( void ) =
+{
+	{ _vI2C1_DMATxHandler , _vI2C1_DMARxHandler } ,
+	{ _vI2C2_DMATxHandler , _vI2C2_DMARxHandler }
+} ;
+
 /*==============================================================================================================================================
  * IMPLEMENTATIONS SECTION
  *==============================================================================================================================================*/
@@ -44,10 +77,18 @@ ERRORS_t MI2C_eInit( I2C_Config_t * I2CConfig )
 {
 	ERRORS_t Local_ErrorStatus  = OK ;
 
-	if( NOK != _eI2CCheckConfig(I2CConfig) )
+	I2C_TimingInfo_t Local_Timing ;
+
+	if( ( NOK != _eI2CCheckConfig(I2CConfig) ) && ( OK == MI2C_eCalculateTiming( I2CConfig , &Local_Timing ) ) )
 	{
 		/* RIGHT CONFIGURATIONS */
-		uint16_t Local_u16CCRValue ;
+
+		/* DEADLINES & RECOVERY DELAYS RUN ON THE DWT CYCLE COUNTER , FREE RUNNING SO OTHER USERS ARE NOT DISTURBED */
+		DEMCR |= ( 1UL << DEMCR_TRCENA ) ;
+		DWT->CTRL |= ( 1UL << DWT_CTRL_CYCCNTENA ) ;
+
+		/* PERIPHERAL DISABLE , CCR & TRISE CAN ONLY BE PROGRAMMED WHILE PE IS CLEARED */
+		I2C[ I2CConfig->I2CNumber ]-> I2C_CR1 &= ( ~ ( 1 << I2C_CR1_BIT_PE ) ) ;
 
 		/* SETTING ADDRESS & ADDRESSING MODE */
 		if( I2CConfig->AddressingMode == I2C_ADD_MODE_7BIT )
@@ -76,9 +117,10 @@ ERRORS_t MI2C_eInit( I2C_Config_t * I2CConfig )
 			I2C[ I2CConfig->I2CNumber ]->I2C_CR1 &= ( ~ ( 1<<I2C_CR1_BIT_NOSTRETCH ) ) ;
 		}
 
-		/* SETTING SPEED MODE */
+		/* SETTING SPEED MODE & DUTY */
 		I2C[ I2CConfig->I2CNumber ]->I2C_CCR &= ( I2C_CCR_MASK ) ;
 		I2C[ I2CConfig->I2CNumber ]->I2C_CCR |= ( I2CConfig->SpeedMode << I2C_CCR_BIT_F_S ) ;
+		I2C[ I2CConfig->I2CNumber ]->I2C_CCR |= ( Local_Timing.Duty << I2C_CCR_BIT_DUTY ) ;
 
 
 		/* SETTING FREQUENCY */
@@ -87,8 +129,12 @@ ERRORS_t MI2C_eInit( I2C_Config_t * I2CConfig )
 
 
 		/* SETTING CCR */
-		Local_u16CCRValue = _u16CalculateCCR(I2CConfig) ;
-		I2C[ I2CConfig->I2CNumber ]->I2C_CCR |= ( Local_u16CCRValue ) ;
+		I2C[ I2CConfig->I2CNumber ]->I2C_CCR |= ( Local_Timing.CCR ) ;
+
+		/* SETTING MAXIMUM RISE TIME */
+		I2C[ I2CConfig->I2CNumber ]->I2C_TRISE = Local_Timing.TRISE ;
+
+		I2C_Timing[ I2CConfig->I2CNumber ] = Local_Timing ;
 
 		/* PERIPHERAL ENABLE */
 		I2C[ I2CConfig->I2CNumber ]-> I2C_CR1 |= ( 1 << I2C_CR1_BIT_PE ) ;
@@ -101,6 +147,110 @@ ERRORS_t MI2C_eInit( I2C_Config_t * I2CConfig )
 	return Local_ErrorStatus ;
 }
 
+/**
+ * @fn     : MI2C_eCalculateTiming(I2C_Config_t*, I2C_TimingInfo_t*)
+ * @brief  : FUNCTION THAT CALCULATES CCR , DUTY & TRISE FOR THE SPEED MODE , APB1 CLOCK & SCL FREQUENCY IN CONFIGURATION
+ * @param  : I2CConfig => POINTER TO STRUCT THAT CONTAINS I2C PERIPHERAL CONFIGURATION
+ * @param  : Timing    => RETURN FOR REGISTERS VALUES & ACHIEVED SCL FREQUENCY , CHECK @I2C_TimingInfo_t
+ * @return : ERROR STATUS , NOK IF THE SCL FREQUENCY CAN NOT BE REACHED WITHIN THE SPEED MODE LIMITS
+ * @note   : NOTHING IS WRITTEN TO THE PERIPHERAL , USE IT TO CHECK A CONFIGURATION BEFORE MI2C_eInit
+ */
+ERRORS_t MI2C_eCalculateTiming( I2C_Config_t * I2CConfig , I2C_TimingInfo_t * Timing )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	if( ( NULL == I2CConfig ) || ( NULL == Timing ) )
+	{
+		Local_ErrorStatus = NULL_POINTER ;
+	}
+	else if( ( I2CConfig->APB1ClockFrequencyMhz < I2C_FREQ_2MHz ) || ( I2CConfig->APB1ClockFrequencyMhz > I2C_FREQ_50MHz ) ||
+			( I2CConfig->SCLFrequencyKHz == 0 ) ||
+			( ( I2CConfig->SpeedMode == I2C_SPEED_MODE_STANDARD ) && ( I2CConfig->SCLFrequencyKHz > I2C_SM_MAX_SCL_KHZ ) ) ||
+			( ( I2CConfig->SpeedMode == I2C_SPEED_MODE_FAST ) && ( ( I2CConfig->SCLFrequencyKHz > I2C_FM_MAX_SCL_KHZ ) ||
+			( I2CConfig->APB1ClockFrequencyMhz < I2C_FM_MIN_FREQ_MHZ ) ) ) ||
+			( I2CConfig->SpeedMode > I2C_SPEED_MODE_FAST ) )
+	{
+		Local_ErrorStatus = NOK ;
+	}
+	else
+	{
+		uint32_t Local_u32PCLKHz = (uint32_t)I2CConfig->APB1ClockFrequencyMhz * 1000000UL ;
+		uint32_t Local_u32SCLHz  = (uint32_t)I2CConfig->SCLFrequencyKHz * 1000UL ;
+
+		uint32_t Local_u32CCR = 0 ;
+		uint32_t Local_u32CCR169 = 0 ;
+
+		if( I2CConfig->SpeedMode == I2C_SPEED_MODE_STANDARD )
+		{
+			/* THIGH = TLOW = CCR * TPCLK1 */
+			Local_u32CCR = _u32CalculateCCR( Local_u32PCLKHz , Local_u32SCLHz , I2C_SM_PERIOD_UNITS , I2C_CCR_SM_MIN ) ;
+
+			Timing->Duty = I2C_DUTY_2 ;
+			Timing->AchievedSCLHz = Local_u32PCLKHz / ( I2C_SM_PERIOD_UNITS * Local_u32CCR ) ;
+			Timing->TRISE = (uint8_t)( ( ( I2CConfig->APB1ClockFrequencyMhz * I2C_SM_MAX_RISE_NS ) / 1000U ) + 1U ) ;
+		}
+		else
+		{
+			/* TRY BOTH DUTIES & KEEP THE ONE GETTING CLOSER TO THE REQUESTED FREQUENCY ( DUTY 2 ON A TIE ) */
+			Local_u32CCR = _u32CalculateCCR( Local_u32PCLKHz , Local_u32SCLHz , I2C_FM_DUTY_2_PERIOD_UNITS , I2C_CCR_FM_MIN ) ;
+			Local_u32CCR169 = _u32CalculateCCR( Local_u32PCLKHz , Local_u32SCLHz , I2C_FM_DUTY_16_9_PERIOD_UNITS , I2C_CCR_FM_MIN ) ;
+
+			Timing->Duty = I2C_DUTY_2 ;
+			Timing->AchievedSCLHz = Local_u32PCLKHz / ( I2C_FM_DUTY_2_PERIOD_UNITS * Local_u32CCR ) ;
+
+			if( ( Local_u32CCR169 <= I2C_CCR_MAX ) &&
+					( ( Local_u32CCR > I2C_CCR_MAX ) || ( ( Local_u32PCLKHz / ( I2C_FM_DUTY_16_9_PERIOD_UNITS * Local_u32CCR169 ) ) > Timing->AchievedSCLHz ) ) )
+			{
+				Local_u32CCR = Local_u32CCR169 ;
+
+				Timing->Duty = I2C_DUTY_16_9 ;
+				Timing->AchievedSCLHz = Local_u32PCLKHz / ( I2C_FM_DUTY_16_9_PERIOD_UNITS * Local_u32CCR ) ;
+			}
+
+			Timing->TRISE = (uint8_t)( ( ( I2CConfig->APB1ClockFrequencyMhz * I2C_FM_MAX_RISE_NS ) / 1000U ) + 1U ) ;
+		}
+
+		/* SCL TOO SLOW FOR THIS APB1 CLOCK */
+		if( Local_u32CCR > I2C_CCR_MAX )
+		{
+			Local_ErrorStatus = NOK ;
+		}
+		else
+		{
+			Timing->CCR = (uint16_t)Local_u32CCR ;
+		}
+	}
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn     : MI2C_eGetTimingInfo(I2C_t, I2C_TimingInfo_t*)
+ * @brief  : FUNCTION THAT RETURNS THE SCL TIMING PROGRAMMED BY THE LAST SUCCESSFUL MI2C_eInit
+ * @param  : I2CNumber => I2C NUMBER , CHECK @I2C_t
+ * @param  : Timing    => RETURN FOR REGISTERS VALUES & ACHIEVED SCL FREQUENCY , CHECK @I2C_TimingInfo_t
+ * @return : ERROR STATUS
+ */
+ERRORS_t MI2C_eGetTimingInfo( I2C_t I2CNumber , I2C_TimingInfo_t * Timing )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	if( NULL == Timing )
+	{
+		Local_ErrorStatus = NULL_POINTER ;
+	}
+	else if( ( I2CNumber < I2C_1 ) || ( I2CNumber > I2C_2 ) )
+	{
+		Local_ErrorStatus = NOK ;
+	}
+	else
+	{
+		*Timing = I2C_Timing[ I2CNumber ] ;
+	}
+
+	return Local_ErrorStatus ;
+}
+
 /**
  * @fn 		: MI2C_eSendStartCondition
  * @brief 	: THIS FUNCTION SENDS START CONDITION FOLLOWED BY SLAVE ADDRESS FOLLOWED BY RW BIT
@@ -108,46 +258,50 @@ ERRORS_t MI2C_eInit( I2C_Config_t * I2CConfig )
  * @param   : I2CConfig				=> A POINTER TO STRUCTURE THAT CARRIES I2C CONFIGURATION INFO
  * @param 	: Copy_u16SlaveAddress 	=> SLAVE ADDRESS ON THE BUS TO COMMUNICATE WITH
  * @param 	: Copy_u8RWBit			=> RW BIT FOLLOWED BY SLAVE ADDRESS , CHECK @I2C_RW_BIT_t
- * @return	: ERROR  STATUS TO INDICATE FOR MALFUNCTION
- * @note    : 10 BIT SLAVE ADDRESS NOT SUPPORTED YET
+ * @return	: ERROR  STATUS TO INDICATE FOR MALFUNCTION , NOK IF THE SLAVE DID NOT ACKNOWLEDGE ,
+ * 			  TIME_OUT_ERROR IF THE DEADLINE PASSED ( BUS IS RECOVERED BEFORE RETURNING )
+ * @note    : 10 BIT SLAVE ADDRESS NOT SUPPORTED YET , ALL BLOCKING FUNCTIONS COUNT THEIR DEADLINES ON THE DWT CYCLE COUNTER
+ * 			  ALL BLOCKING FUNCTIONS RETURN NOK WITHOUT TOUCHING THE BUS WHILE AN INTERRUPT OR DMA TRANSFER IS RUNNING ON THE SAME I2C
  */
 ERRORS_t MI2C_eSendStartCondition( I2C_Config_t * I2CConfig , uint16_t Copy_u16SlaveAddress , I2C_RW_BIT_t Copy_u8RWBit )
 {
 	ERRORS_t local_ErrorStatus = OK ;
 
-	if( NOK != _eI2CCheckConfig(I2CConfig) )
+	if( NOK != _eCheckBlockingCall(I2CConfig) )
 	{
 		/* RIGHT CONFIGURATIONS */
-		uint16_t Local_u16TimeoutVar = 0 ;
+		_vStartDeadline( I2CConfig->I2CNumber , 1 ) ;
 
 		/* Wait Until Bus is Free */
-		while( ( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR2 >> I2C_SR2_BUSY ) & 1U ) && ( Local_u16TimeoutVar != MAX_DELAY ) )
-		{
-			Local_u16TimeoutVar++;
-		}
+		while( ( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR2 >> I2C_SR2_BUSY ) & 1U ) && ( 0 == _u8IsDeadlineExpired( I2CConfig->I2CNumber ) ) ) ;
 
 		/* IF BUSY FLAG IS STUCK */
-		if( Local_u16TimeoutVar == MAX_DELAY )
+		if( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR2 >> I2C_SR2_BUSY ) & 1U )
 		{
-			/* Reset Peripheral */
-			I2C[ I2CConfig->I2CNumber ]-> I2C_CR1 |= ( 1 << I2C_CR1_BIT_SWRST ) ;
-			I2C[ I2CConfig->I2CNumber ]-> I2C_CR1 &= (~(1<<I2C_CR1_BIT_SWRST)) ;
+			/* Free The Bus , Reset & ReInitialize the Peripheral */
+			MI2C_eRecoverBus(I2CConfig) ;
 
-			/* ReInitialize the Peripheral */
-			MI2C_eInit(I2CConfig) ;
+			_vStartDeadline( I2CConfig->I2CNumber , 1 ) ;
 		}
 
-		/* ENABLE ACKNOWLEDGE */
-		MI2C_vEnableACK(I2CConfig) ;
+		if( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR2 >> I2C_SR2_BUSY ) & 1U )
+		{
+			local_ErrorStatus = TIME_OUT_ERROR ;
+		}
+		else
+		{
+			/* ENABLE ACKNOWLEDGE */
+			MI2C_vEnableACK(I2CConfig) ;
 
-		/* Send Start Condition */
-		I2C[ I2CConfig->I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_START ) ;
+			/* Send Start Condition */
+			I2C[ I2CConfig->I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_START ) ;
 
-		/* Wait Until SB Bit is Set */
-		while( !( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR1 >> I2C_SR1_SB ) & 1U ) ) ;
+			/* Wait Until SB Bit is Set */
+			local_ErrorStatus = _eWaitSR1( I2CConfig , I2C_SR1_SB ) ;
+		}
 
 		/* Send Slave Address */
-		if( I2CConfig->AddressingMode == I2C_ADD_MODE_7BIT )
+		if( ( local_ErrorStatus == OK ) && ( I2CConfig->AddressingMode == I2C_ADD_MODE_7BIT ) )
 		{
 			/* CHECK ON SLAVE ADDRESS */
 			if( Copy_u16SlaveAddress <= 255 )
@@ -162,17 +316,13 @@ ERRORS_t MI2C_eSendStartCondition( I2C_Config_t * I2CConfig , uint16_t Copy_u16S
 				I2C[ I2CConfig->I2CNumber ]->I2C_DR = Local_u8SlaveAddressWithRWBit ;
 
 				/* Wait Until Flag is Set */
-				/* RESET TIMEOUT VARIABLE */
-				Local_u16TimeoutVar = 0 ;
+				local_ErrorStatus = _eWaitSR1( I2CConfig , I2C_SR1_ADDR ) ;
 
-				while( ( !( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR1 >> I2C_SR1_ADDR ) & 1U ) ) && ( Local_u16TimeoutVar != MAX_DELAY ) )
+				if( local_ErrorStatus == OK )
 				{
-					Local_u16TimeoutVar ++ ;
+					/* CLEAR ADDR FLAG */
+					_vClearADDR(I2CConfig->I2CNumber);
 				}
-
-				/* CLEAR ADDR FLAG */
-				_vClearADDR(I2CConfig->I2CNumber);
-
 			}
 			else
 			{
@@ -195,7 +345,8 @@ ERRORS_t MI2C_eSendStartCondition( I2C_Config_t * I2CConfig , uint16_t Copy_u16S
  * @param   : I2CConfig			=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
  * @param 	: Copy_pu8DataBuffer=> POINTER TO DATA BUFFER TO SEND VIA I2C BUS LANE ( SDA )
  * @param 	: Copy_u8BufferSize => SIZE OF DATA TO SEND TO LOOP ON
- * @return 	: ERROR STATUS
+ * @return 	: ERROR STATUS , NOK ON NACK , TIME_OUT_ERROR IF THE DEADLINE PASSED ( BUS IS RECOVERED BEFORE RETURNING )
+ * @note    : RETURNS ONCE THE LAST BYTE IS ON THE BUS ( BTF ) SO A STOP CAN FOLLOW RIGHT AWAY
  */
 ERRORS_t MI2C_eMasterWriteData( I2C_Config_t * I2CConfig , uint8_t * Copy_pu8DataBuffer , uint8_t Copy_u8BufferSize )
 {
@@ -203,13 +354,30 @@ ERRORS_t MI2C_eMasterWriteData( I2C_Config_t * I2CConfig , uint8_t * Copy_pu8Dat
 
 	uint8_t Local_u8LoopCounter = 0 ;
 
-	for( Local_u8LoopCounter = 0 ; Local_u8LoopCounter < Copy_u8BufferSize ; Local_u8LoopCounter++ )
+	/* NO BYTE IS MOVED WHILE A BACKGROUND TRANSFER OWNS THE PERIPHERAL */
+	Local_ErrorStatus = _eCheckBlockingCall(I2CConfig) ;
+
+	/* THE DEADLINE TIMER IS ONLY TAKEN BY A CALL ALLOWED TO RUN , A REJECTED ONE LEAVES THE RUNNING TRANSFER ITS TIME BASE */
+	if( Local_ErrorStatus == OK )
+	{
+		_vStartDeadline( I2CConfig->I2CNumber , Copy_u8BufferSize ) ;
+	}
+
+	for( Local_u8LoopCounter = 0 ; ( Local_u8LoopCounter < Copy_u8BufferSize ) && ( Local_ErrorStatus == OK ) ; Local_u8LoopCounter++ )
 	{
 		/* Wait Untill Transmit Register Empty Flag is Set */
-		while( !( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR1 >> I2C_SR1_TXE ) & 1U ) ) ;
+		Local_ErrorStatus = _eWaitSR1( I2CConfig , I2C_SR1_TXE ) ;
 
-		I2C[ I2CConfig->I2CNumber ]->I2C_DR = Copy_pu8DataBuffer[ Local_u8LoopCounter ] ;
+		if( Local_ErrorStatus == OK )
+		{
+			I2C[ I2CConfig->I2CNumber ]->I2C_DR = Copy_pu8DataBuffer[ Local_u8LoopCounter ] ;
+		}
+	}
 
+	/* Wait Until Last Byte is Transferred */
+	if( ( Local_ErrorStatus == OK ) && ( Copy_u8BufferSize != 0 ) )
+	{
+		Local_ErrorStatus = _eWaitSR1( I2CConfig , I2C_SR1_BTF ) ;
 	}
 
 	return Local_ErrorStatus ;
@@ -220,12 +388,16 @@ ERRORS_t MI2C_eMasterWriteData( I2C_Config_t * I2CConfig , uint8_t * Copy_pu8Dat
  * @brief 	: THIS FUNCTION SEND STOP CONDITION ON COMMUNICATION BUS
  * @param 	: I2CConfig => A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
  * @retval  : VOID
+ * @note    : NOTHING IS SENT WHILE AN INTERRUPT OR DMA TRANSFER IS RUNNING ON THE SAME I2C
  */
 void MI2C_vSendStopCondition( I2C_Config_t * I2CConfig )
 {
-	/* Send Stop Condition */
-	I2C[ I2CConfig->I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
-
+	/* A STOP NOW WOULD CUT A BACKGROUND TRANSFER , IT SENDS ITS OWN */
+	if( NOK != _eCheckBlockingCall(I2CConfig) )
+	{
+		/* Send Stop Condition */
+		I2C[ I2CConfig->I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+	}
 }
 
 /**
@@ -261,7 +433,7 @@ static void MI2C_vDisableACK( I2C_Config_t * I2CConfig  )
  * @param   : I2CConfig			=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
  * @param 	: Copy_u8DataBuffer	=> POINTER TO THE DATA TO BE READ FROM I2C BUS LANE ( SDA )
  * @param 	: Copy_u8BufferSize	=> BUFFER SIZE OF DATA TO READ FROM COM BUS
- * @return	: ERROR STATUS
+ * @return	: ERROR STATUS , TIME_OUT_ERROR IF THE DEADLINE PASSED ( BUS IS RECOVERED BEFORE RETURNING )
  */
 ERRORS_t MI2C_eReadData( I2C_Config_t * I2CConfig , uint8_t* Copy_u8DataBuffer , uint8_t Copy_u8BufferSize )
 {
@@ -269,19 +441,22 @@ ERRORS_t MI2C_eReadData( I2C_Config_t * I2CConfig , uint8_t* Copy_u8DataBuffer ,
 
 	uint8_t Local_u8LoopCounter = 0 ;
 
-	uint16_t Local_u16TimeoutVar = 0 ;
+	/* NO BYTE IS MOVED WHILE A BACKGROUND TRANSFER OWNS THE PERIPHERAL */
+	Local_ErrorStatus = _eCheckBlockingCall(I2CConfig) ;
 
-	for( Local_u8LoopCounter = 0 ; Local_u8LoopCounter < Copy_u8BufferSize ; Local_u8LoopCounter++ )
+	/* THE DEADLINE TIMER IS ONLY TAKEN BY A CALL ALLOWED TO RUN , A REJECTED ONE LEAVES THE RUNNING TRANSFER ITS TIME BASE */
+	if( Local_ErrorStatus == OK )
+	{
+		_vStartDeadline( I2CConfig->I2CNumber , Copy_u8BufferSize ) ;
+	}
+
+	for( Local_u8LoopCounter = 0 ; ( Local_u8LoopCounter < Copy_u8BufferSize ) && ( Local_ErrorStatus == OK ) ; Local_u8LoopCounter++ )
 	{
 		/* Wait Untill Flag is Set */
-		while( ( !( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR1  >> I2C_SR1_RXNE ) & 1U ) ) && ( Local_u16TimeoutVar != MAX_DELAY ) )
-		{
-			Local_u16TimeoutVar++ ;
-		}
+		Local_ErrorStatus = _eWaitSR1( I2CConfig , I2C_SR1_RXNE ) ;
 
-		if( Local_u16TimeoutVar == MAX_DELAY )
+		if( Local_ErrorStatus != OK )
 		{
-			Local_u16TimeoutVar = TIME_OUT_ERROR ;
 			break ;
 		}
 
@@ -312,25 +487,25 @@ ERRORS_t MI2C_eSendRepeatedStart( I2C_Config_t * I2CConfig , uint16_t Copy_u16Sl
 {
 	ERRORS_t local_ErrorStatus = OK ;
 
-	if( NOK != _eI2CCheckConfig(I2CConfig) )
+	if( NOK != _eCheckBlockingCall(I2CConfig) )
 	{
 		/* RIGHT CONFIGURATIONS */
+		_vStartDeadline( I2CConfig->I2CNumber , 1 ) ;
 
 		/* Send Repeated Start Condition */
 		I2C[ I2CConfig->I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_START ) ;
 
 		/* Wait Until SB Bit is Set */
-		while( !( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR1 >> I2C_SR1_SB ) & 1U ) ) ;
+		local_ErrorStatus = _eWaitSR1( I2CConfig , I2C_SR1_SB ) ;
 
 		/* ENABLE ACKNOWLEDGE */
 		MI2C_vEnableACK(I2CConfig) ;
 
 		/* Send Slave Address */
-		if( I2CConfig->AddressingMode == I2C_ADD_MODE_7BIT )
+		if( ( local_ErrorStatus == OK ) && ( I2CConfig->AddressingMode == I2C_ADD_MODE_7BIT ) )
 		{
 			if( Copy_u16SlaveAddress <= 255 )
 			{
-				uint16_t Local_u16TimeoutVar = 0 ;
 				/* Variable that Carry Slave Address with RW Bit */
 				uint8_t Local_u8SlaveAddressWithRWBit = (uint8_t)( Copy_u16SlaveAddress << 1 ) ;
 
@@ -341,14 +516,13 @@ ERRORS_t MI2C_eSendRepeatedStart( I2C_Config_t * I2CConfig , uint16_t Copy_u16Sl
 				I2C[ I2CConfig->I2CNumber ]->I2C_DR = Local_u8SlaveAddressWithRWBit ;
 
 				/* Wait Until Flag is Set */
-				while( ( !( ( I2C[ I2CConfig->I2CNumber ]->I2C_SR1 >> I2C_SR1_ADDR ) & 1U ) ) &&( Local_u16TimeoutVar != MAX_DELAY )  )
+				local_ErrorStatus = _eWaitSR1( I2CConfig , I2C_SR1_ADDR ) ;
+
+				if( local_ErrorStatus == OK )
 				{
-					Local_u16TimeoutVar++;
+					/* CLEAR ADDR FLAG */
+					_vClearADDR(I2CConfig->I2CNumber);
 				}
-
-				/* CLEAR ADDR FLAG */
-				_vClearADDR(I2CConfig->I2CNumber);
-
 			}
 			else
 			{
@@ -367,26 +541,196 @@ ERRORS_t MI2C_eSendRepeatedStart( I2C_Config_t * I2CConfig , uint16_t Copy_u16Sl
 	return local_ErrorStatus ;
 }
 
+/**
+ * @fn 		: MI2C_eSetRecoveryPins
+ * @brief 	: THIS FUNCTION SETS THE GPIO PINS OF AN I2C SO BUS RECOVERY CAN CLOCK OUT A SLAVE HOLDING SDA LOW
+ * @param 	: I2CNumber		=> I2C NUMBER , CHECK @I2C_t
+ * @param 	: Copy_u8SCLPort=> SCL PIN PORT , CHECK @Port_t
+ * @param 	: Copy_u8SCLPin	=> SCL PIN NUMBER , CHECK @Pin_t
+ * @param 	: Copy_u8SDAPort=> SDA PIN PORT , CHECK @Port_t
+ * @param 	: Copy_u8SDAPin	=> SDA PIN NUMBER , CHECK @Pin_t
+ * @param 	: Copy_u8AltFunc=> I2C ALTERNATE FUNCTION OF THE PINS ( AF4 ON MOST PINS ) , CHECK @AltFunc_t
+ * @return	: ERROR STATUS
+ * @note    : WITHOUT RECOVERY PINS , BUS RECOVERY ONLY RESETS & REINITIALIZES THE PERIPHERAL
+ */
+ERRORS_t MI2C_eSetRecoveryPins( I2C_t I2CNumber , uint8_t Copy_u8SCLPort , uint8_t Copy_u8SCLPin , uint8_t Copy_u8SDAPort , uint8_t Copy_u8SDAPin , uint8_t Copy_u8AltFunc )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	if( ( I2CNumber < I2C_1 ) || ( I2CNumber > I2C_2 ) || ( Copy_u8SCLPort > PORTH ) || ( Copy_u8SCLPin > PIN15 ) ||
+			( Copy_u8SDAPort > PORTH ) || ( Copy_u8SDAPin > PIN15 ) || ( Copy_u8AltFunc > AF15 ) )
+	{
+		Local_ErrorStatus = NOK ;
+	}
+	else
+	{
+		I2C_RecoveryPins[ I2CNumber ].SCLPort = Copy_u8SCLPort ;
+		I2C_RecoveryPins[ I2CNumber ].SCLPin = Copy_u8SCLPin ;
+		I2C_RecoveryPins[ I2CNumber ].SDAPort = Copy_u8SDAPort ;
+		I2C_RecoveryPins[ I2CNumber ].SDAPin = Copy_u8SDAPin ;
+		I2C_RecoveryPins[ I2CNumber ].AltFunc = Copy_u8AltFunc ;
+		I2C_RecoveryPins[ I2CNumber ].State = I2C_RECOVERY_PINS_SET ;
+	}
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn 		: MI2C_eRecoverBus
+ * @brief 	: THIS FUNCTION FREES A STUCK BUS : UP TO 9 SCL PULSES UNTIL SDA IS RELEASED , A STOP CONDITION , THEN A PERIPHERAL
+ * 			  SOFTWARE RESET & REINITIALIZATION , A RUNNING INTERRUPT OR DMA TRANSFER IS ENDED WITH I2C_TRANSFER_TIMEOUT
+ * @param 	: I2CConfig	=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @return	: ERROR STATUS , NOK IF SDA IS STILL HELD LOW AFTER RECOVERY
+ * @note    : CALLED AUTOMATICALLY WHEN A BLOCKING FUNCTION OR A BACKGROUND TRANSFER MISSES ITS DEADLINE , DELAYS USE THE DWT CYCLE COUNTER
+ */
+ERRORS_t MI2C_eRecoverBus( I2C_Config_t * I2CConfig )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	if( NULL == I2CConfig )
+	{
+		Local_ErrorStatus = NULL_POINTER ;
+	}
+	else if( NOK == _eI2CCheckConfig(I2CConfig) )
+	{
+		Local_ErrorStatus = NOK ;
+	}
+	else
+	{
+		PinValue_t Local_SDAValue = PIN_HIGH ;
+
+		/* STOP INTERRUPTS & DMA REQUESTS OF A RUNNING TRANSFER WHILE THE BUS IS DRIVEN BY HAND */
+		I2C[ I2CConfig->I2CNumber ]->I2C_CR2 &= ( ~ ( I2C_CR2_IT_MASK | ( 1 << I2C_CR2_BIT_DMAEN ) ) ) ;
+
+		if( I2C_RecoveryPins[ I2CConfig->I2CNumber ].State == I2C_RECOVERY_PINS_SET )
+		{
+			_vClockOutBus( I2CConfig->I2CNumber ) ;
+		}
+
+		/* Reset Peripheral , Clears a BUSY Flag Left Stuck by a Glitch */
+		I2C[ I2CConfig->I2CNumber ]-> I2C_CR1 |= ( 1 << I2C_CR1_BIT_SWRST ) ;
+		I2C[ I2CConfig->I2CNumber ]-> I2C_CR1 &= (~(1<<I2C_CR1_BIT_SWRST)) ;
+
+		/* ReInitialize the Peripheral */
+		Local_ErrorStatus = MI2C_eInit(I2CConfig) ;
+
+		/* REPORT THE ABORTED TRANSFER , ITS CALL BACK MAY START THE NEXT ONE ON THE FRESH PERIPHERAL */
+		if( I2C_Handle[ I2CConfig->I2CNumber ].State == I2C_STATE_BUSY )
+		{
+			_vEndTransfer( I2CConfig->I2CNumber , I2C_TRANSFER_TIMEOUT ) ;
+		}
+
+		if( I2C_RecoveryPins[ I2CConfig->I2CNumber ].State == I2C_RECOVERY_PINS_SET )
+		{
+			GPIO_u8ReadPinValue( (Port_t)I2C_RecoveryPins[ I2CConfig->I2CNumber ].SDAPort , (Pin_t)I2C_RecoveryPins[ I2CConfig->I2CNumber ].SDAPin , &Local_SDAValue ) ;
+
+			if( Local_SDAValue == PIN_LOW )
+			{
+				Local_ErrorStatus = NOK ;
+			}
+		}
+	}
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn 		: MI2C_eMasterTransfer_IT
+ * @brief 	: THIS FUNCTION STARTS A MASTER TRANSFER THAT RUNS IN THE BACKGROUND ON I2C EVENT & ERROR INTERRUPTS
+ * @param 	: I2CConfig	=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @param 	: Transfer	=> A POINTER TO THE TRANSFER DESCRIPTOR , CHECK @I2C_Transfer_t
+ * @return	: ERROR STATUS , NOK IF A TRANSFER IS ALREADY RUNNING ON THE SAME I2C ,
+ * 			  BUS_ERROR IF THE BUS IS STILL HELD ( STOP PENDING OR BUSY FLAG SET ) I2C_BUS_RELEASE_SCL_PERIODS SCL PERIODS LATER , NOTHING IS STARTED
+ * @note    : DESCRIPTOR & BUFFERS MUST STAY VALID UNTIL THE CALL BACK , I2C EV & ER IRQs MUST BE ENABLED IN THE NVIC
+ * 			  CALL MI2C_eCheckTimeout PERIODICALLY SO A TRANSFER THAT STOPS INTERRUPTING STILL ENDS
+ */
+ERRORS_t MI2C_eMasterTransfer_IT( I2C_Config_t * I2CConfig , I2C_Transfer_t * Transfer )
+{
+	return _eStartTransfer( I2CConfig , Transfer , I2C_MODE_IT ) ;
+}
+
+/**
+ * @fn 		: MI2C_eMasterTransfer_DMA
+ * @brief 	: THIS FUNCTION STARTS A MASTER TRANSFER WHOSE DATA BYTES ARE MOVED BY DMA , ONLY START , ADDRESS & END OF
+ * 			  TRANSFER EVENTS INTERRUPT THE CPU , NACK & STOP AFTER THE LAST RECEIVED BYTE ARE HANDLED BY HARDWARE ( LAST BIT )
+ * @param 	: I2CConfig	=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @param 	: Transfer	=> A POINTER TO THE TRANSFER DESCRIPTOR , CHECK @I2C_Transfer_t
+ * @return	: ERROR STATUS , NOK IF A TRANSFER IS ALREADY RUNNING ON THE SAME I2C ,
+ * 			  BUS_ERROR IF THE BUS IS STILL HELD ( STOP PENDING OR BUSY FLAG SET ) I2C_BUS_RELEASE_SCL_PERIODS SCL PERIODS LATER , NOTHING IS STARTED
+ * @note    : I2C EV & ER IRQs AND THE I2C DMA STREAMS IRQs MUST BE ENABLED IN THE NVIC , STREAMS ARE SELECTED IN I2C_Config.h
+ * 			  CALL MI2C_eCheckTimeout PERIODICALLY SO A TRANSFER THAT STOPS INTERRUPTING STILL ENDS
+ */
+ERRORS_t MI2C_eMasterTransfer_DMA( I2C_Config_t * I2CConfig , I2C_Transfer_t * Transfer )
+{
+	return _eStartTransfer( I2CConfig , Transfer , I2C_MODE_DMA ) ;
+}
+
+/**
+ * @fn 		: MI2C_eCheckTimeout
+ * @brief 	: THIS FUNCTION ENDS AN INTERRUPT OR DMA TRANSFER THAT OUTLIVED ITS DEADLINE : THE BUS IS RECOVERED ( MI2C_eRecoverBus )
+ * 			  & THE TRANSFER ENDS WITH I2C_TRANSFER_TIMEOUT
+ * @param 	: I2CNumber	=> I2C NUMBER USED , CHECK @I2C_t
+ * @return	: ERROR STATUS , TIME_OUT_ERROR IF A TRANSFER WAS ABORTED , NOK IF I2CNumber IS WRONG
+ * @note    : A TRANSFER THAT STOPS INTERRUPTING ( SLAVE HOLDING SCL , LOST EVENT ) IS ONLY CAUGHT HERE , CALL IT PERIODICALLY
+ * 			  ( SUPER LOOP OR TIMER ) WHILE A TRANSFER RUNS , THE DEADLINE IS THE ONE OF A BLOCKING CALL MOVING THE SAME BYTES
+ */
+ERRORS_t MI2C_eCheckTimeout( I2C_t I2CNumber )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	uint32_t Local_u32PriMask = 0 ;
+
+	if( I2CNumber >= I2C_MAX_NUMBER )
+	{
+		Local_ErrorStatus = NOK ;
+	}
+	else
+	{
+		/* NO COMPLETION INTERRUPT MAY END THIS TRANSFER & START THE NEXT ONE BETWEEN THE CHECK & THE RECOVERY */
+		Local_u32PriMask = _u32EnterCritical( ) ;
+
+		if( ( I2C_Handle[ I2CNumber ].State == I2C_STATE_BUSY ) && ( 1 == _u8IsDeadlineExpired( I2CNumber ) ) )
+		{
+			MI2C_eRecoverBus( I2C_Handle[ I2CNumber ].Config ) ;
+
+			Local_ErrorStatus = TIME_OUT_ERROR ;
+		}
+
+		_vExitCritical( Local_u32PriMask ) ;
+	}
+
+	return Local_ErrorStatus ;
+}
+
 
 /*==============================================================================================================================================
  * PRIVATE FUNCTIONS SECTION
  *==============================================================================================================================================*/
 
 /**
- * @fn    : _u16CalculateCCR
- * @brief : Calculates CCR Value From SCL Frequency & PCLK1 Provided in Configurations
+ * @fn    : _u32CalculateCCR
+ * @brief : Calculates The Smallest CCR Value Giving an SCL Frequency Not Above The Requested One
  *
- * @param : I2CConfig => Pointer to Structure that holds I2C Configuration Parameters
- * @retval: CCR Value
+ * @param : Copy_u32PCLKHz    => PCLK1 Frequency in Hz
+ * @param : Copy_u32SCLHz     => Requested SCL Frequency in Hz
+ * @param : Copy_u8PeriodUnits=> SCL Period in PCLK1 Cycles per CCR Unit ( I2C_SM_PERIOD_UNITS , I2C_FM_DUTY_xx_PERIOD_UNITS )
+ * @param : Copy_u16MinCCR    => Smallest CCR Allowed in The Speed Mode
+ * @retval: CCR Value , May Exceed I2C_CCR_MAX if The SCL Frequency is Too Low
  * @note  : Private Function For Provider Use ONLY
  */
-static uint16_t _u16CalculateCCR( I2C_Config_t * I2CConfig )
+static uint32_t _u32CalculateCCR( uint32_t Copy_u32PCLKHz , uint32_t Copy_u32SCLHz , uint8_t Copy_u8PeriodUnits , uint16_t Copy_u16MinCCR )
 {
-	uint32_t Local_u32CCRValue = ( I2CConfig->APB1ClockFrequencyMhz * 1000000 ) / ( I2CConfig->SCLFrequencyKHz * 1000 ); /* Convert the Units to KHz */
-	Local_u32CCRValue = Local_u32CCRValue / 2  ;
+	uint32_t Local_u32Divider = Copy_u32SCLHz * Copy_u8PeriodUnits ;
 
-	return (uint16_t)Local_u32CCRValue ;
+	/* ROUND UP SO THE BUS IS NEVER CLOCKED FASTER THAN REQUESTED */
+	uint32_t Local_u32CCRValue = ( Copy_u32PCLKHz + Local_u32Divider - 1U ) / Local_u32Divider ;
 
+	if( Local_u32CCRValue < Copy_u16MinCCR )
+	{
+		Local_u32CCRValue = Copy_u16MinCCR ;
+	}
+
+	return Local_u32CCRValue ;
 }
 
 /**
@@ -412,6 +756,26 @@ static ERRORS_t _eI2CCheckConfig( I2C_Config_t * I2CConfig )
 	return Local_ErrorStatus ;
 }
 
+/**
+ * @fn		: _eCheckBlockingCall(I2C_Config_t*)
+ * @brief 	: THIS FUNCTION CHECKS THAT A BLOCKING CALL MAY DRIVE THE BUS : VALID CONFIGURATION & NO INTERRUPT OR DMA TRANSFER RUNNING
+ *
+ * @param 	: I2CConfig => A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @return	: OK , NOK IF THE CONFIGURATION IS WRONG OR THE I2C IS BOOKED BY A BACKGROUND TRANSFER
+ * @note 	: PRIVATE FUNCTION
+ */
+static ERRORS_t _eCheckBlockingCall( I2C_Config_t * I2CConfig )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	if( ( NULL == I2CConfig ) || ( NOK == _eI2CCheckConfig(I2CConfig) ) ||
+			( I2C_Handle[ I2CConfig->I2CNumber ].State != I2C_STATE_IDLE ) )
+	{
+		Local_ErrorStatus = NOK ;
+	}
+	return Local_ErrorStatus ;
+}
+
 
 /**
  * @fn 		:  _vClearADDR(I2C_t)
@@ -430,4 +794,756 @@ static uint16_t _vClearADDR( I2C_t I2CNumber )
 	return Local_u16TempVar;
 }
 
+/**
+ * @fn 		: _vStartDeadline(I2C_t, uint16_t)
+ * @brief 	: THIS FUNCTION STARTS THE DEADLINE OF A BLOCKING CALL OR BACKGROUND TRANSFER : I2C_TIMEOUT_US + TWICE THE TIME OF THE BYTES AT THE ACHIEVED SCL
+ *
+ * @param 	: I2CNumber		=> I2C NUMBER USED
+ * @param 	: Copy_u16Bytes	=> NUMBER OF BYTES THE CALL MOVES ( ADDRESS BYTE INCLUDED )
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vStartDeadline( I2C_t I2CNumber , uint16_t Copy_u16Bytes )
+{
+	uint32_t Local_u32SCLHz = ( I2C_Timing[ I2CNumber ].AchievedSCLHz != 0 ) ? I2C_Timing[ I2CNumber ].AchievedSCLHz : I2C_DEFAULT_SCL_HZ ;
+
+	/* SCL IN kHz ( ROUNDED DOWN SO THE DEADLINE ONLY GROWS ) , KEEPS THE PRODUCT BELOW 2^32 FOR ANY 16-BIT BYTE COUNT */
+	uint32_t Local_u32SCLkHz = ( Local_u32SCLHz >= 1000UL ) ? ( Local_u32SCLHz / 1000UL ) : 1UL ;
+
+	/* 9 SCL CYCLES PER BYTE ( 8 DATA + ACK ) , DOUBLED FOR MARGIN */
+	uint32_t Local_u32BytesTimeus = ( (uint32_t)Copy_u16Bytes * 18000UL ) / Local_u32SCLkHz ;
+
+	uint32_t Local_u32TimeUs = I2C_TIMEOUT_US + Local_u32BytesTimeus ;
+
+	I2C_Deadline[ I2CNumber ].StartCycles = DWT->CYCCNT ;
+
+	/* CLAMPED TO THE LONGEST DEADLINE THE 32-BIT COUNTER CAN MEASURE */
+	I2C_Deadline[ I2CNumber ].Cycles = ( Local_u32TimeUs > ( 0xFFFFFFFFUL / I2C_CORE_CLOCK_MHZ ) ) ? 0xFFFFFFFFUL : ( Local_u32TimeUs * I2C_CORE_CLOCK_MHZ ) ;
+}
+
+/**
+ * @fn 		: _u32EnterCritical(void)
+ * @brief 	: THIS FUNCTION MASKS INTERRUPTS & RETURNS THE PREVIOUS MASK ( PRIMASK )
+ *
+ * @return	: PREVIOUS PRIMASK VALUE TO PASS TO _vExitCritical
+ * @note	: PRIVATE FUNCTION , KEEPS A TIMEOUT CHECK FROM RACING THE COMPLETION INTERRUPTS
+ */
+static uint32_t _u32EnterCritical( void )
+{
+	uint32_t Local_u32PriMask = 0 ;
+
+	__asm volatile( "MRS %0, PRIMASK \n\t CPSID I" : "=r" ( Local_u32PriMask ) : : "memory" ) ;
+
+	return Local_u32PriMask ;
+}
+
+/**
+ * @fn 		: _vExitCritical(uint32_t)
+ * @brief 	: THIS FUNCTION RESTORES THE INTERRUPTS MASK SAVED BY _u32EnterCritical
+ *
+ * @param 	: Copy_u32PriMask	=> VALUE RETURNED BY _u32EnterCritical
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vExitCritical( uint32_t Copy_u32PriMask )
+{
+	__asm volatile( "MSR PRIMASK, %0" : : "r" ( Copy_u32PriMask ) : "memory" ) ;
+}
+
+/**
+ * @fn 		: _u8IsDeadlineExpired(I2C_t)
+ * @brief 	: THIS FUNCTION TELLS IF THE DEADLINE STARTED BY _vStartDeadline ON AN I2C HAS PASSED
+ *
+ * @param 	: I2CNumber	=> I2C NUMBER USED
+ * @return	: 1 IF EXPIRED , 0 OTHERWISE
+ * @note	: PRIVATE FUNCTION
+ */
+static uint8_t _u8IsDeadlineExpired( I2C_t I2CNumber )
+{
+	/* UNSIGNED DIFFERENCE STAYS RIGHT ACROSS A COUNTER WRAP AROUND */
+	return ( ( DWT->CYCCNT - I2C_Deadline[ I2CNumber ].StartCycles ) >= I2C_Deadline[ I2CNumber ].Cycles ) ? 1 : 0 ;
+}
+
+/**
+ * @fn 		: _vDelayus(uint32_t)
+ * @brief 	: THIS FUNCTION BUSY WAITS ON THE DWT CYCLE COUNTER
+ *
+ * @param 	: Copy_u32TimeUs	=> TIME TO WAIT IN MICROSECONDS
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vDelayus( uint32_t Copy_u32TimeUs )
+{
+	uint32_t Local_u32StartCycles = DWT->CYCCNT ;
+
+	while( ( DWT->CYCCNT - Local_u32StartCycles ) < ( Copy_u32TimeUs * I2C_CORE_CLOCK_MHZ ) ) ;
+}
+
+/**
+ * @fn 		: _eWaitBusRelease(I2C_t)
+ * @brief 	: THIS FUNCTION WAITS AT MOST I2C_BUS_RELEASE_SCL_PERIODS SCL PERIODS FOR A PENDING STOP & THE BUSY FLAG TO CLEAR
+ *
+ * @param 	: I2CNumber	=> I2C NUMBER USED
+ * @return	: OK IF THE BUS IS RELEASED , BUS_ERROR OTHERWISE
+ * @note	: PRIVATE FUNCTION , SHORT ENOUGH TO RUN FROM A COMPLETION INTERRUPT THAT CHAINS THE NEXT TRANSFER
+ */
+static ERRORS_t _eWaitBusRelease( I2C_t I2CNumber )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	uint32_t Local_u32SCLHz = ( I2C_Timing[ I2CNumber ].AchievedSCLHz != 0 ) ? I2C_Timing[ I2CNumber ].AchievedSCLHz : I2C_DEFAULT_SCL_HZ ;
+
+	/* e.g. 4 PERIODS AT 100KHz = 40us = 640 CYCLES AT 16MHz , THE PRODUCT STAYS BELOW 2^32 UP TO 1GHz CORE CLOCK */
+	uint32_t Local_u32MaxCycles = ( I2C_BUS_RELEASE_SCL_PERIODS * I2C_CORE_CLOCK_MHZ * 1000000UL ) / Local_u32SCLHz ;
+
+	uint32_t Local_u32StartCycles = DWT->CYCCNT ;
+
+	while( ( ( ( I2C[ I2CNumber ]->I2C_CR1 >> I2C_CR1_BIT_STOP ) & 1U ) || ( ( I2C[ I2CNumber ]->I2C_SR2 >> I2C_SR2_BUSY ) & 1U ) ) &&
+			( ( DWT->CYCCNT - Local_u32StartCycles ) < Local_u32MaxCycles ) ) ;
 
+	if( ( ( I2C[ I2CNumber ]->I2C_CR1 >> I2C_CR1_BIT_STOP ) & 1U ) || ( ( I2C[ I2CNumber ]->I2C_SR2 >> I2C_SR2_BUSY ) & 1U ) )
+	{
+		Local_ErrorStatus = BUS_ERROR ;
+	}
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn 		: _eWaitSR1(I2C_Config_t*, uint8_t)
+ * @brief 	: THIS FUNCTION WAITS FOR AN SR1 FLAG UNTIL THE RUNNING DEADLINE , RECOVERING THE BUS IF IT PASSES
+ *
+ * @param 	: I2CConfig		=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @param 	: Copy_u8Flag	=> SR1 FLAG BIT ( I2C_SR1_SB , I2C_SR1_ADDR , I2C_SR1_TXE , ... )
+ * @return	: OK IF SET , NOK IF THE SLAVE DID NOT ACKNOWLEDGE ( STOP SENT ) , TIME_OUT_ERROR IF THE DEADLINE PASSED
+ * @note	: PRIVATE FUNCTION
+ */
+static ERRORS_t _eWaitSR1( I2C_Config_t * I2CConfig , uint8_t Copy_u8Flag )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	uint16_t Local_u16SR1 = I2C[ I2CConfig->I2CNumber ]->I2C_SR1 ;
+
+	while( !( ( Local_u16SR1 >> Copy_u8Flag ) & 1U ) )
+	{
+		if( ( Local_u16SR1 >> I2C_SR1_AF ) & 1U )
+		{
+			/* SLAVE DID NOT ACKNOWLEDGE , CLEAR AF ( WRITTEN BY ZERO ) & RELEASE THE BUS */
+			I2C[ I2CConfig->I2CNumber ]->I2C_SR1 = (uint16_t)( ~ ( 1 << I2C_SR1_AF ) ) ;
+			I2C[ I2CConfig->I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+
+			Local_ErrorStatus = NOK ;
+			break ;
+		}
+
+		if( _u8IsDeadlineExpired( I2CConfig->I2CNumber ) )
+		{
+			MI2C_eRecoverBus(I2CConfig) ;
+
+			Local_ErrorStatus = TIME_OUT_ERROR ;
+			break ;
+		}
+
+		Local_u16SR1 = I2C[ I2CConfig->I2CNumber ]->I2C_SR1 ;
+	}
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn 		: _vClockOutBus(I2C_t)
+ * @brief 	: THIS FUNCTION DRIVES SCL BY GPIO UNTIL THE SLAVE RELEASES SDA ( 9 PULSES AT MOST ) THEN GENERATES A STOP CONDITION
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @note	: PRIVATE FUNCTION , PINS ARE GIVEN BACK TO THE I2C AFTERWARDS
+ */
+static void _vClockOutBus( I2C_t I2CNumber )
+{
+	I2C_RecoveryPins_t * Local_pPins = &I2C_RecoveryPins[ I2CNumber ] ;
+
+	GPIO_PinConfig_t Local_Pin = { 0 } ;
+
+	PinValue_t Local_SDAValue = PIN_LOW ;
+
+	uint8_t Local_u8Pulse = 0 ;
+
+	/* RELEASED LEVEL FIRST SO SWITCHING TO GPIO MAKES NO EDGE */
+	GPIO_u8SetPinValue( (Port_t)Local_pPins->SCLPort , (Pin_t)Local_pPins->SCLPin , PIN_HIGH ) ;
+	GPIO_u8SetPinValue( (Port_t)Local_pPins->SDAPort , (Pin_t)Local_pPins->SDAPin , PIN_HIGH ) ;
+
+	Local_Pin.Mode = OUTPUT ;
+	Local_Pin.Speed = MEDIUM_SPEED ;
+	Local_Pin.OutputType = OPEN_DRAIN ;
+	Local_Pin.PullType = PULL_UP ;
+
+	Local_Pin.Port = (Port_t)Local_pPins->SCLPort ;
+	Local_Pin.PinNum = (Pin_t)Local_pPins->SCLPin ;
+	GPIO_u8PinInit( &Local_Pin ) ;
+
+	Local_Pin.Port = (Port_t)Local_pPins->SDAPort ;
+	Local_Pin.PinNum = (Pin_t)Local_pPins->SDAPin ;
+	GPIO_u8PinInit( &Local_Pin ) ;
+
+	_vDelayus( I2C_RECOVERY_HALF_PERIOD_US ) ;
+
+	/* CLOCK OUT THE BYTE THE SLAVE IS STILL SENDING UNTIL IT RELEASES SDA */
+	for( Local_u8Pulse = 0 ; Local_u8Pulse < I2C_RECOVERY_PULSES ; Local_u8Pulse++ )
+	{
+		GPIO_u8ReadPinValue( (Port_t)Local_pPins->SDAPort , (Pin_t)Local_pPins->SDAPin , &Local_SDAValue ) ;
+
+		if( Local_SDAValue == PIN_HIGH )
+		{
+			break ;
+		}
+
+		GPIO_u8SetPinValue( (Port_t)Local_pPins->SCLPort , (Pin_t)Local_pPins->SCLPin , PIN_LOW ) ;
+		_vDelayus( I2C_RECOVERY_HALF_PERIOD_US ) ;
+
+		GPIO_u8SetPinValue( (Port_t)Local_pPins->SCLPort , (Pin_t)Local_pPins->SCLPin , PIN_HIGH ) ;
+		_vDelayus( I2C_RECOVERY_HALF_PERIOD_US ) ;
+	}
+
+	/* STOP CONDITION : SDA RISES WHILE SCL IS HIGH */
+	GPIO_u8SetPinValue( (Port_t)Local_pPins->SCLPort , (Pin_t)Local_pPins->SCLPin , PIN_LOW ) ;
+	_vDelayus( I2C_RECOVERY_HALF_PERIOD_US ) ;
+
+	GPIO_u8SetPinValue( (Port_t)Local_pPins->SDAPort , (Pin_t)Local_pPins->SDAPin , PIN_LOW ) ;
+	_vDelayus( I2C_RECOVERY_HALF_PERIOD_US ) ;
+
+	GPIO_u8SetPinValue( (Port_t)Local_pPins->SCLPort , (Pin_t)Local_pPins->SCLPin , PIN_HIGH ) ;
+	_vDelayus( I2C_RECOVERY_HALF_PERIOD_US ) ;
+
+	GPIO_u8SetPinValue( (Port_t)Local_pPins->SDAPort , (Pin_t)Local_pPins->SDAPin , PIN_HIGH ) ;
+	_vDelayus( I2C_RECOVERY_HALF_PERIOD_US ) ;
+
+	/* GIVE THE PINS BACK TO THE I2C */
+	Local_Pin.Mode = ALTERNATE_FUNCTION ;
+	Local_Pin.AltFunc = (AltFunc_t)Local_pPins->AltFunc ;
+
+	Local_Pin.Port = (Port_t)Local_pPins->SCLPort ;
+	Local_Pin.PinNum = (Pin_t)Local_pPins->SCLPin ;
+	GPIO_u8PinInit( &Local_Pin ) ;
+
+	Local_Pin.Port = (Port_t)Local_pPins->SDAPort ;
+	Local_Pin.PinNum = (Pin_t)Local_pPins->SDAPin ;
+	GPIO_u8PinInit( &Local_Pin ) ;
+}
+
+/**
+ * @fn 		: _eStartTransfer(I2C_Config_t*, I2C_Transfer_t*, uint8_t)
+ * @brief 	: THIS FUNCTION CHECKS A TRANSFER DESCRIPTOR , BOOKS THE I2C & SENDS THE START CONDITION
+ *
+ * @param 	: I2CConfig	=> A POINTER TO STRUCTURE THAT HOLDS I2C CONFIGURATION INFO
+ * @param 	: Transfer	=> A POINTER TO THE TRANSFER DESCRIPTOR
+ * @param 	: Mode		=> I2C_MODE_IT / I2C_MODE_DMA
+ * @return	: ERROR STATUS
+ * @note	: PRIVATE FUNCTION
+ */
+static ERRORS_t _eStartTransfer( I2C_Config_t * I2CConfig , I2C_Transfer_t * Transfer , uint8_t Mode )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	if( ( NULL == I2CConfig ) || ( NULL == Transfer ) )
+	{
+		Local_ErrorStatus = NULL_POINTER ;
+	}
+	else if( ( NOK == _eI2CCheckConfig(I2CConfig) ) || ( I2CConfig->AddressingMode != I2C_ADD_MODE_7BIT ) ||
+			( Transfer->SlaveAddress > 0x7F ) || ( ( Transfer->TxSize == 0 ) && ( Transfer->RxSize == 0 ) ) ||
+			( ( Transfer->TxSize != 0 ) && ( NULL == Transfer->TxBuffer ) ) || ( ( Transfer->RxSize != 0 ) && ( NULL == Transfer->RxBuffer ) ) ||
+			( I2C_Handle[ I2CConfig->I2CNumber ].State != I2C_STATE_IDLE ) )
+	{
+		Local_ErrorStatus = NOK ;
+	}
+	else if( OK != _eWaitBusRelease( I2CConfig->I2CNumber ) )
+	{
+		/* A STOP LEAVES THE BUS WITHIN ABOUT ONE SCL PERIOD , STILL HELD MEANS A STUCK SLAVE OR ANOTHER MASTER */
+		Local_ErrorStatus = BUS_ERROR ;
+	}
+	else
+	{
+		/* ADDRESS BYTE ( TWO WITH A RESTART ) & DATA BYTES , SATURATED TO THE LONGEST DEADLINE */
+		uint32_t Local_u32Bytes = (uint32_t)Transfer->TxSize + (uint32_t)Transfer->RxSize + 2UL ;
+
+		I2C_Handle[ I2CConfig->I2CNumber ].Transfer = Transfer ;
+		I2C_Handle[ I2CConfig->I2CNumber ].Config = I2CConfig ;
+		I2C_Handle[ I2CConfig->I2CNumber ].Phase = ( Transfer->TxSize != 0 ) ? I2C_PHASE_TX : I2C_PHASE_RX ;
+		I2C_Handle[ I2CConfig->I2CNumber ].Index = 0 ;
+		I2C_Handle[ I2CConfig->I2CNumber ].Mode = Mode ;
+		I2C_Handle[ I2CConfig->I2CNumber ].State = I2C_STATE_BUSY ;
+
+		Transfer->Status = I2C_TRANSFER_BUSY ;
+
+		/* CHECKED BY MI2C_eCheckTimeout & ON EVERY EVENT INTERRUPT */
+		_vStartDeadline( I2CConfig->I2CNumber , ( Local_u32Bytes > 0xFFFFUL ) ? 0xFFFFU : (uint16_t)Local_u32Bytes ) ;
+
+		/* ENABLE ACKNOWLEDGE & CLEAR POS LEFT FROM A 2 BYTES READ */
+		I2C[ I2CConfig->I2CNumber ]->I2C_CR1 &= ( ~ ( 1 << I2C_CR1_BIT_POS ) ) ;
+		MI2C_vEnableACK(I2CConfig) ;
+
+		/* ENABLE EVENT & ERROR INTERRUPTS , BUFFER INTERRUPTS ONLY WHEN THE CPU MOVES THE BYTES */
+		I2C[ I2CConfig->I2CNumber ]->I2C_CR2 |= ( ( Mode == I2C_MODE_IT ) ? I2C_CR2_IT_MASK : I2C_CR2_IT_MASK & ( ~ ( 1 << I2C_CR2_BIT_ITBUFEN ) ) ) ;
+
+		/* SEND START CONDITION , THE REST HAPPENS IN THE EVENT INTERRUPT */
+		I2C[ I2CConfig->I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_START ) ;
+	}
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn 		: _eStartDMA(I2C_t)
+ * @brief 	: THIS FUNCTION STARTS THE DMA STREAM OF THE CURRENT PHASE & ENABLES I2C DMA REQUESTS , CALLED ON ADDR BEFORE CLEARING IT
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @return	: OK , NOK IF THE STREAM COULD NOT BE CONFIGURED OR STARTED ( I2C DMA REQUESTS STAY DISABLED )
+ * @note	: PRIVATE FUNCTION
+ */
+static ERRORS_t _eStartDMA( I2C_t I2CNumber )
+{
+	ERRORS_t Local_ErrorStatus = OK ;
+
+	I2C_Handle_t * Local_pHandle = &I2C_Handle[ I2CNumber ] ;
+
+	uint8_t Local_u8Direction = Local_pHandle->Phase ;
+
+	DMA_INIT_STRUCT_t * Local_pDMAConfig = &I2C_DMAConfig[ I2CNumber ][ Local_u8Direction ] ;
+
+	Local_pDMAConfig->DMAController = DMA1_CONTROLLER ;
+	Local_pDMAConfig->StreamNumber = ( Local_u8Direction == I2C_PHASE_TX ) ? I2C_DMA_MAP[ I2CNumber ].TxStream : I2C_DMA_MAP[ I2CNumber ].RxStream ;
+	Local_pDMAConfig->ChannelNumber = I2C_DMA_MAP[ I2CNumber ].ChannelNumber ;
+	Local_pDMAConfig->PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER ;
+	Local_pDMAConfig->MemBurst = DMA_MEM_SINGLE_TRANSFER ;
+	Local_pDMAConfig->Priority = DMA_HIGH_PRIORITY ;
+	Local_pDMAConfig->MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS ;
+	Local_pDMAConfig->PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS ;
+	Local_pDMAConfig->MemInc = DMA_MINC_ENABLE ;
+	Local_pDMAConfig->PeriphInc = DMA_PINC_DISABLE ;
+	Local_pDMAConfig->Mode = DMA_NORMAL ;
+	Local_pDMAConfig->DoubleBuffer = DMA_DOUBLE_BUFFER_DIS ;
+	Local_pDMAConfig->Direction = ( Local_u8Direction == I2C_PHASE_TX ) ? DMA_MEM_TO_PERIPH : DMA_PERIPH_TO_MEM ;
+	Local_pDMAConfig->EnableIT.FIFOErrorIT = DMA_INT_DISABLE ;
+	Local_pDMAConfig->EnableIT.DirectModeErrorIT = DMA_INT_DISABLE ;
+	Local_pDMAConfig->EnableIT.TransferErrorIT = DMA_INT_ENABLE ;
+	Local_pDMAConfig->EnableIT.HalfTransferIT = DMA_INT_DISABLE ;
+	Local_pDMAConfig->EnableIT.TransferCompleteIT = DMA_INT_ENABLE ;
+	Local_pDMAConfig->FIFOMode = DMA_FIFOMODE_DISABLE ;
+	Local_pDMAConfig->FIFOThreshold = DMA_FIFO_THRESHOLD_HALF_FULL ;
+
+	if( DMA_OK != DMA_Init( Local_pDMAConfig ) )
+	{
+		Local_ErrorStatus = NOK ;
+	}
+	else
+	{
+		DMA_SetCallBack( Local_pDMAConfig , DMA_TRANSFER_CMP_CALLBACK , I2C_DMA_Handler[ I2CNumber ][ Local_u8Direction ] ) ;
+		DMA_SetCallBack( Local_pDMAConfig , DMA_TRANSFER_ERROR_CALLBACK , I2C_DMA_Handler[ I2CNumber ][ Local_u8Direction ] ) ;
+
+		/* CLEAR FLAGS LEFT FROM PREVIOUS TRANSFERS BEFORE ENABLING THE STREAM */
+		DMA_ClearInterruptFlag( DMA1_CONTROLLER , Local_pDMAConfig->StreamNumber , TRANSFER_COMPLETE_IT_FLAG ) ;
+		DMA_ClearInterruptFlag( DMA1_CONTROLLER , Local_pDMAConfig->StreamNumber , TRANSFER_ERROR_IT_FLAG ) ;
+
+		if( Local_u8Direction == I2C_PHASE_TX )
+		{
+			if( DMA_OK != DMA_StartTransfer( Local_pDMAConfig , (uint32_t *)Local_pHandle->Transfer->TxBuffer , (uint32_t *)&( I2C[ I2CNumber ]->I2C_DR ) , Local_pHandle->Transfer->TxSize ) )
+			{
+				Local_ErrorStatus = NOK ;
+			}
+		}
+		else
+		{
+			if( DMA_OK != DMA_StartTransfer( Local_pDMAConfig , (uint32_t *)&( I2C[ I2CNumber ]->I2C_DR ) , (uint32_t *)Local_pHandle->Transfer->RxBuffer , Local_pHandle->Transfer->RxSize ) )
+			{
+				Local_ErrorStatus = NOK ;
+			}
+			/* HARDWARE NACKS THE BYTE THE DMA READS LAST */
+			else if( Local_pHandle->Transfer->RxSize > 1 )
+			{
+				I2C[ I2CNumber ]->I2C_CR2 |= ( 1 << I2C_CR2_BIT_LAST ) ;
+			}
+		}
+	}
+
+	/* NO DMA REQUESTS WITHOUT A RUNNING STREAM */
+	if( Local_ErrorStatus == OK )
+	{
+		I2C[ I2CNumber ]->I2C_CR2 |= ( 1 << I2C_CR2_BIT_DMAEN ) ;
+	}
+
+	return Local_ErrorStatus ;
+}
+
+/**
+ * @fn 		: _vDMAHandler(I2C_t, uint8_t)
+ * @brief 	: THIS FUNCTION HANDLES THE END OF AN I2C DMA STREAM ( TRANSFER COMPLETE OR TRANSFER ERROR )
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @param 	: Direction => I2C_PHASE_TX / I2C_PHASE_RX
+ * @note	: PRIVATE FUNCTION , CALLED FROM THE DMA STREAM CALL BACKS
+ */
+static void _vDMAHandler( I2C_t I2CNumber , uint8_t Direction )
+{
+	uint16_t Local_u16Remaining = 0 ;
+
+	DMA_GetRemainingDataCount( DMA1_CONTROLLER , I2C_DMAConfig[ I2CNumber ][ Direction ].StreamNumber , &Local_u16Remaining ) ;
+
+	if( ( I2C_Handle[ I2CNumber ].State != I2C_STATE_BUSY ) || ( I2C_Handle[ I2CNumber ].Phase != Direction ) )
+	{
+		/* TRANSFER ALREADY ENDED BY AN I2C ERROR , OR TX PHASE ALREADY ENDED ON BTF ( RESTART / RX ) */
+	}
+	else if( Local_u16Remaining != 0 )
+	{
+		/* STREAM STOPPED ON A DMA ERROR */
+		I2C[ I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+
+		_vEndTransfer( I2CNumber , I2C_TRANSFER_DMA_ERROR ) ;
+	}
+	else if( Direction == I2C_PHASE_RX )
+	{
+		/* ALL BYTES IN MEMORY , LAST ONE ALREADY NACKED BY HARDWARE ( STOP OF A SINGLE BYTE READ IS SENT ON ADDR ) */
+		if( I2C_Handle[ I2CNumber ].Transfer->RxSize > 1 )
+		{
+			I2C[ I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+		}
+
+		I2C_Handle[ I2CNumber ].Index = I2C_Handle[ I2CNumber ].Transfer->RxSize ;
+
+		_vEndTransfer( I2CNumber , I2C_TRANSFER_DONE ) ;
+	}
+	else
+	{
+		/* ALL BYTES WRITTEN TO DR , THE EVENT INTERRUPT ENDS THE PHASE ON BTF */
+		I2C[ I2CNumber ]->I2C_CR2 &= ( ~ ( 1 << I2C_CR2_BIT_DMAEN ) ) ;
+
+		I2C_Handle[ I2CNumber ].Index = I2C_Handle[ I2CNumber ].Transfer->TxSize ;
+	}
+}
+
+/**
+ * @fn 		: _vEventHandler(I2C_t)
+ * @brief 	: THIS FUNCTION MOVES THE INTERRUPT DRIVEN TRANSFER ON I2C EVENTS ( SB , ADDR , TXE , RXNE , BTF )
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vEventHandler( I2C_t I2CNumber )
+{
+	I2C_RegDef_t * Local_pI2C = I2C[ I2CNumber ] ;
+
+	I2C_Handle_t * Local_pHandle = &I2C_Handle[ I2CNumber ] ;
+
+	I2C_Transfer_t * Local_pTransfer = Local_pHandle->Transfer ;
+
+	/* SR1 IS READ ONCE , FIRST STEP OF CLEARING SB , ADDR & BTF */
+	uint16_t Local_u16SR1 = Local_pI2C->I2C_SR1 ;
+
+	if( Local_pHandle->State != I2C_STATE_BUSY )
+	{
+		/* NO TRANSFER , EVENT INTERRUPTS ARE LEFT ENABLED BY SOMEONE ELSE */
+		Local_pI2C->I2C_CR2 &= ( ~ ( I2C_CR2_IT_MASK ) ) ;
+	}
+	else if( 1 == _u8IsDeadlineExpired( I2CNumber ) )
+	{
+		/* STILL INTERRUPTING PAST ITS DEADLINE ( EVENT STORM , SLAVE STRETCHING FOREVER ) , ENDS IT WITH I2C_TRANSFER_TIMEOUT */
+		MI2C_eRecoverBus( Local_pHandle->Config ) ;
+	}
+	else if( ( Local_u16SR1 >> I2C_SR1_SB ) & 1U )
+	{
+		if( Local_pHandle->Phase == I2C_PHASE_RESTART )
+		{
+			/* REPEATED START SENT , RECEIVING STARTS WITH THE READ ADDRESS */
+			Local_pHandle->Phase = I2C_PHASE_RX ;
+
+			if( Local_pHandle->Mode == I2C_MODE_IT )
+			{
+				Local_pI2C->I2C_CR2 |= ( 1 << I2C_CR2_BIT_ITBUFEN ) ;
+			}
+		}
+
+		/* EV5 : START SENT , WRITING THE ADDRESS CLEARS SB */
+		Local_pI2C->I2C_DR = (uint8_t)( ( Local_pTransfer->SlaveAddress << 1 ) |
+				( ( Local_pHandle->Phase == I2C_PHASE_TX ) ? I2C_RW_BIT_WRITE : I2C_RW_BIT_READ ) ) ;
+	}
+	else if( ( Local_u16SR1 >> I2C_SR1_ADDR ) & 1U )
+	{
+		/* EV6 : ADDRESS ACKNOWLEDGED */
+		if( Local_pHandle->Mode == I2C_MODE_DMA )
+		{
+			/* SINGLE BYTE : LAST CAN NOT BE USED , NACK IT IN SOFTWARE */
+			if( ( Local_pHandle->Phase == I2C_PHASE_RX ) && ( Local_pTransfer->RxSize == 1 ) )
+			{
+				Local_pI2C->I2C_CR1 &= ( ~ ( 1 << I2C_CR1_BIT_ACK ) ) ;
+			}
+
+			/* DMA REQUESTS MUST BE ENABLED BEFORE ADDR IS CLEARED */
+			if( OK != _eStartDMA(I2CNumber) )
+			{
+				/* STREAM NOT RUNNING , RELEASE THE BUS & REPORT IT */
+				_vClearADDR(I2CNumber) ;
+
+				Local_pI2C->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+
+				_vEndTransfer( I2CNumber , I2C_TRANSFER_DMA_ERROR ) ;
+			}
+			else
+			{
+				_vClearADDR(I2CNumber) ;
+
+				if( ( Local_pHandle->Phase == I2C_PHASE_RX ) && ( Local_pTransfer->RxSize == 1 ) )
+				{
+					Local_pI2C->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+				}
+			}
+		}
+		else if( ( Local_pHandle->Phase == I2C_PHASE_RX ) && ( Local_pTransfer->RxSize == 1 ) )
+		{
+			/* SINGLE BYTE : NACK IT , CLEAR ADDR THEN STOP */
+			Local_pI2C->I2C_CR1 &= ( ~ ( 1 << I2C_CR1_BIT_ACK ) ) ;
+			_vClearADDR(I2CNumber) ;
+			Local_pI2C->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+		}
+		else if( ( Local_pHandle->Phase == I2C_PHASE_RX ) && ( Local_pTransfer->RxSize == 2 ) )
+		{
+			/* TWO BYTES : NACK APPLIES TO THE NEXT BYTE ( POS ) , BOTH ARE READ ON BTF */
+			Local_pI2C->I2C_CR1 &= ( ~ ( 1 << I2C_CR1_BIT_ACK ) ) ;
+			Local_pI2C->I2C_CR1 |= ( 1 << I2C_CR1_BIT_POS ) ;
+			_vClearADDR(I2CNumber) ;
+			Local_pI2C->I2C_CR2 &= ( ~ ( 1 << I2C_CR2_BIT_ITBUFEN ) ) ;
+		}
+		else
+		{
+			_vClearADDR(I2CNumber) ;
+
+			/* THREE BYTES LEFT : LAST ONES ARE HANDLED ON BTF */
+			if( ( Local_pHandle->Phase == I2C_PHASE_RX ) && ( Local_pTransfer->RxSize == 3 ) )
+			{
+				Local_pI2C->I2C_CR2 &= ( ~ ( 1 << I2C_CR2_BIT_ITBUFEN ) ) ;
+			}
+		}
+	}
+	else if( Local_pHandle->Phase == I2C_PHASE_RESTART )
+	{
+		/* BTF & TXE OF THE LAST WRITTEN BYTE STAY SET UNTIL THE REPEATED START IS SENT , NOTHING TO DO BEFORE SB */
+	}
+	else if( Local_pHandle->Phase == I2C_PHASE_TX )
+	{
+		uint16_t Local_u16Remaining = 0 ;
+
+		if( ( Local_pHandle->Mode == I2C_MODE_DMA ) && ( ( Local_u16SR1 >> I2C_SR1_BTF ) & 1U ) && ( Local_pHandle->Index != Local_pTransfer->TxSize ) )
+		{
+			/* BTF SERVICED BEFORE THE DMA COMPLETE CALL BACK , CHECK THE STREAM DIRECTLY */
+			DMA_GetRemainingDataCount( DMA1_CONTROLLER , I2C_DMA_MAP[ I2CNumber ].TxStream , &Local_u16Remaining ) ;
+
+			if( Local_u16Remaining == 0 )
+			{
+				Local_pI2C->I2C_CR2 &= ( ~ ( 1 << I2C_CR2_BIT_DMAEN ) ) ;
+
+				Local_pHandle->Index = Local_pTransfer->TxSize ;
+			}
+		}
+
+		if( ( ( Local_u16SR1 >> I2C_SR1_TXE ) & 1U ) && ( ( Local_pI2C->I2C_CR2 >> I2C_CR2_BIT_ITBUFEN ) & 1U ) &&
+				( Local_pHandle->Index < Local_pTransfer->TxSize ) )
+		{
+			/* EV8 : LOAD NEXT BYTE */
+			Local_pI2C->I2C_DR = Local_pTransfer->TxBuffer[ Local_pHandle->Index++ ] ;
+
+			if( Local_pHandle->Index == Local_pTransfer->TxSize )
+			{
+				/* ALL BYTES LOADED , WAIT FOR BTF */
+				Local_pI2C->I2C_CR2 &= ( ~ ( 1 << I2C_CR2_BIT_ITBUFEN ) ) ;
+			}
+		}
+		else if( ( ( Local_u16SR1 >> I2C_SR1_BTF ) & 1U ) && ( Local_pHandle->Index == Local_pTransfer->TxSize ) )
+		{
+			/* EV8_2 : LAST BYTE ACKNOWLEDGED */
+			if( Local_pTransfer->RxSize != 0 )
+			{
+				/* WRITE THEN READ : REPEATED START IN RECEIVE DIRECTION , RX PHASE BEGINS ON SB ( BUFFER INTERRUPTS STAY OFF UNTIL THEN ) */
+				Local_pHandle->Phase = I2C_PHASE_RESTART ;
+				Local_pHandle->Index = 0 ;
+
+				Local_pI2C->I2C_CR2 &= ( ~ ( 1 << I2C_CR2_BIT_ITBUFEN ) ) ;
+				Local_pI2C->I2C_CR1 |= ( 1 << I2C_CR1_BIT_ACK ) ;
+				Local_pI2C->I2C_CR1 |= ( 1 << I2C_CR1_BIT_START ) ;
+			}
+			else
+			{
+				Local_pI2C->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+
+				_vEndTransfer( I2CNumber , I2C_TRANSFER_DONE ) ;
+			}
+		}
+	}
+	else if( Local_pHandle->Mode == I2C_MODE_IT )
+	{
+		uint16_t Local_u16Remaining = Local_pTransfer->RxSize - Local_pHandle->Index ;
+
+		if( ( ( Local_u16SR1 >> I2C_SR1_RXNE ) & 1U ) && ( ( Local_pI2C->I2C_CR2 >> I2C_CR2_BIT_ITBUFEN ) & 1U ) )
+		{
+			/* EV7 : BYTE RECEIVED */
+			Local_pTransfer->RxBuffer[ Local_pHandle->Index++ ] = Local_pI2C->I2C_DR ;
+
+			if( Local_u16Remaining == 1 )
+			{
+				/* SINGLE BYTE READ , STOP ALREADY REQUESTED */
+				_vEndTransfer( I2CNumber , I2C_TRANSFER_DONE ) ;
+			}
+			else if( Local_u16Remaining == 4 )
+			{
+				/* THREE BYTES LEFT : LAST ONES ARE HANDLED ON BTF */
+				Local_pI2C->I2C_CR2 &= ( ~ ( 1 << I2C_CR2_BIT_ITBUFEN ) ) ;
+			}
+		}
+		else if( ( Local_u16SR1 >> I2C_SR1_BTF ) & 1U )
+		{
+			if( Local_u16Remaining == 3 )
+			{
+				/* EV7_2 : N-2 IN DR & N-1 IN SHIFT REGISTER , NACK THE LAST ONE */
+				Local_pI2C->I2C_CR1 &= ( ~ ( 1 << I2C_CR1_BIT_ACK ) ) ;
+
+				Local_pTransfer->RxBuffer[ Local_pHandle->Index++ ] = Local_pI2C->I2C_DR ;
+			}
+			else if( Local_u16Remaining == 2 )
+			{
+				/* LAST TWO BYTES : STOP THEN READ BOTH */
+				Local_pI2C->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+
+				Local_pTransfer->RxBuffer[ Local_pHandle->Index++ ] = Local_pI2C->I2C_DR ;
+				Local_pTransfer->RxBuffer[ Local_pHandle->Index++ ] = Local_pI2C->I2C_DR ;
+
+				_vEndTransfer( I2CNumber , I2C_TRANSFER_DONE ) ;
+			}
+		}
+	}
+}
+
+/**
+ * @fn 		: _vErrorHandler(I2C_t)
+ * @brief 	: THIS FUNCTION ENDS THE INTERRUPT DRIVEN TRANSFER ON I2C ERRORS ( BERR , ARLO , AF , OVR , TIMEOUT )
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vErrorHandler( I2C_t I2CNumber )
+{
+	uint16_t Local_u16SR1 = I2C[ I2CNumber ]->I2C_SR1 ;
+
+	I2C_TransferStatus_t Local_Status = I2C_TRANSFER_TIMEOUT ;
+
+	/* CLEAR ERROR FLAGS ( WRITTEN BY ZERO ) */
+	I2C[ I2CNumber ]->I2C_SR1 = (uint16_t)( Local_u16SR1 & ( ~ ( I2C_SR1_ERRORS_MASK ) ) ) ;
+
+	if( ( Local_u16SR1 >> I2C_SR1_BERR ) & 1U )
+	{
+		Local_Status = I2C_TRANSFER_BUS_ERROR ;
+	}
+	else if( ( Local_u16SR1 >> I2C_SR1_ARLO ) & 1U )
+	{
+		/* HARDWARE ALREADY SWITCHED TO SLAVE MODE , NO STOP */
+		Local_Status = I2C_TRANSFER_ARB_LOST ;
+	}
+	else if( ( Local_u16SR1 >> I2C_SR1_AF ) & 1U )
+	{
+		Local_Status = I2C_TRANSFER_NACK ;
+	}
+	else if( ( Local_u16SR1 >> I2C_SR1_OVR ) & 1U )
+	{
+		Local_Status = I2C_TRANSFER_OVERRUN ;
+	}
+
+	if( I2C_Handle[ I2CNumber ].State == I2C_STATE_BUSY )
+	{
+		/* RELEASE THE BUS UNLESS IT WAS LOST */
+		if( Local_Status != I2C_TRANSFER_ARB_LOST )
+		{
+			I2C[ I2CNumber ]->I2C_CR1 |= ( 1 << I2C_CR1_BIT_STOP ) ;
+		}
+
+		_vEndTransfer( I2CNumber , Local_Status ) ;
+	}
+}
+
+/**
+ * @fn 		: _vEndTransfer(I2C_t, I2C_TransferStatus_t)
+ * @brief 	: THIS FUNCTION DISABLES I2C INTERRUPTS , RELEASES THE PERIPHERAL & INVOKES THE TRANSFER CALL BACK
+ *
+ * @param 	: I2CNumber => I2C NUMBER USED
+ * @param 	: Status	=> TRANSFER RESULT , CHECK @I2C_TransferStatus_t
+ * @note	: PRIVATE FUNCTION
+ */
+static void _vEndTransfer( I2C_t I2CNumber , I2C_TransferStatus_t Status )
+{
+	I2C_Transfer_t * Local_pTransfer = I2C_Handle[ I2CNumber ].Transfer ;
+
+	/* DMAEN IS ONLY SET ONCE OUR STREAM IS RUNNING , OTHERWISE THE SHARED STREAM BELONGS TO ANOTHER PERIPHERAL */
+	uint8_t Local_u8StreamOwned = ( ( I2C[ I2CNumber ]->I2C_CR2 >> I2C_CR2_BIT_DMAEN ) & 1 ) ;
+
+	I2C[ I2CNumber ]->I2C_CR2 &= ( ~ ( I2C_CR2_IT_MASK | ( 1 << I2C_CR2_BIT_DMAEN ) | ( 1 << I2C_CR2_BIT_LAST ) ) ) ;
+	I2C[ I2CNumber ]->I2C_CR1 &= ( ~ ( 1 << I2C_CR1_BIT_POS ) ) ;
+
+	if( ( I2C_Handle[ I2CNumber ].Mode == I2C_MODE_DMA ) && ( Local_u8StreamOwned == 1 ) )
+	{
+		/* STREAM MAY STILL BE RUNNING WHEN AN I2C ERROR ENDS THE TRANSFER , NONE RUNS DURING I2C_PHASE_RESTART ( DMAEN CLEARED ON BTF ) */
+		DMA_DisableStream( DMA1_CONTROLLER , ( I2C_Handle[ I2CNumber ].Phase == I2C_PHASE_TX ) ?
+				I2C_DMA_MAP[ I2CNumber ].TxStream : I2C_DMA_MAP[ I2CNumber ].RxStream ) ;
+	}
+
+	/* RELEASE BEFORE THE CALL BACK SO IT CAN START THE NEXT TRANSFER */
+	I2C_Handle[ I2CNumber ].State = I2C_STATE_IDLE ;
+
+	Local_pTransfer->Status = Status ;
+
+	if( NULL != Local_pTransfer->CallBack )
+	{
+		Local_pTransfer->CallBack() ;
+	}
+}
+
+/*==============================================================================================================================================
+ * INTERRUPT HANDLERS SECTION
+ *==============================================================================================================================================*/
+
+/* I2C1 EVENT INTERRUPT HANDLER */
+void I2C1_EV_IRQHandler( void )
+{
+	_vEventHandler( I2C_1 ) ;
+}
+
+/* I2C1 ERROR INTERRUPT HANDLER */
+void I2C1_ER_IRQHandler( void )
+{
+	_vErrorHandler( I2C_1 ) ;
+}
+
+/* I2C2 EVENT INTERRUPT HANDLER */
+void I2C2_EV_IRQHandler( void )
+{
+	_vEventHandler( I2C_2 ) ;
+}
+
+/* I2C2 ERROR INTERRUPT HANDLER */
+void I2C2_ER_IRQHandler( void )
+{
+	_vErrorHandler( I2C_2 ) ;
+}
+
+/*==============================================================================================================================================
+ * DMA CALL BACKS SECTION
+ *==============================================================================================================================================*/
+
+static void _vI2C1_DMATxHandler( void )
+{
+	_vDMAHandler( I2C_1 , I2C_PHASE_TX ) ;
+}
+
+static void _vI2C1_DMARxHandler( void )
+{
+	_vDMAHandler( I2C_1 , I2C_PHASE_RX ) ;
+}
+
+static void _vI2C2_DMATxHandler( void )
+{
+	_vDMAHandler( I2C_2 , I2C_PHASE_TX ) ;
+}
+
+static void _vI2C2_DMARxHandler( void )
+{
+	_vDMAHandler( I2C_2 , I2C_PHASE_RX ) ;
+}
@@ -60,6 +60,17 @@ typedef enum
 
 }ACTIVE_t;
 
+/**
+ * @enum  :  @IRQ_STATE_t
+ * @brief : This Enum Holds Options of The Enable State of an IRQ in The NVIC
+ *
+ */
+typedef enum
+{
+  IRQ_DISABLED = 0 , IRQ_ENABLED
+
+}IRQ_STATE_t;
+
 /* ------------------------------------------------------------------------------------------------ */
 /* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
 /* ------------------------------------------------------------------------------------------------ */
@@ -125,6 +136,17 @@ ERRORS_t NVIC_GetPendingIRQ( IRQNum_t IRQ_Number , PENDING_t * Pending_State  )
 ERRORS_t NVIC_GetActiveIRQ( IRQNum_t IRQ_Number , ACTIVE_t * Active_State ) ;
 
 
+/**
+ * @fn     : NVIC_GetEnableIRQ
+ * @brief  : This Function Take IRQ Number and a Pointer to dereference the pointer with the Enable state
+ * @param  : IRQ_Number -> From enum ( @IRQNum_t )
+ * @param  : Enable_State -> A Pointer to a Variable that User Takes From it the Enable State ( IRQ_STATE_t )
+ * @retval : ErrorStatus to Indicate if Function Worked Correctly or Not
+ * @note   : Used to Restore The Previous State After Masking an IRQ That May be Shared or Enabled by Another Driver
+ */
+ERRORS_t NVIC_GetEnableIRQ( IRQNum_t IRQ_Number , IRQ_STATE_t * Enable_State ) ;
+
+
 
 
 /**
@@ -237,6 +237,50 @@ ERRORS_t NVIC_GetActiveIRQ( IRQNum_t IRQ_Number , ACTIVE_t * Active_State )
 }
 
 
+/**
+ * @fn     : NVIC_GetEnableIRQ
+ * @brief  : This Function Take IRQ Number and a Pointer to dereference the pointer with the Enable state
+ * @param  : IRQ_Number -> From enum ( @IRQNum_t )
+ * @param  : Enable_State -> A Pointer to a Variable that User Takes From it the Enable State ( IRQ_STATE_t )
+ * @retval : ErrorStatus to Indicate if Function Worked Correctly or Not
+ */
+ERRORS_t NVIC_GetEnableIRQ( IRQNum_t IRQ_Number , IRQ_STATE_t * Enable_State )
+{
+	ERRORS_t Local_u8ErrorStatus = OK ;
+
+	/* Variable to Holds Reg Number For the Specified IRQn */
+	uint8_t REG_Number = ( IRQ_Number/32 ) ;
+
+	/* Variable to Hold Bits Start For the Specified IRQn */
+	uint8_t BITS_Start = ( IRQ_Number%32 ) ;
+
+	if( NULL !=  Enable_State )
+	{
+		if( (IRQ_Number >= WWDG_IRQ) && (IRQ_Number < NUMBER_OF_IRQs)  )
+		{
+			/* ISER Reads Back The Enable State */
+			if( ( ( NVIC->ISER[ REG_Number ] >> BITS_Start ) & 0x01 ) )
+			{
+				*Enable_State = IRQ_ENABLED ;
+			}
+			else
+			{
+				*Enable_State = IRQ_DISABLED ;
+			}
+		}
+		else
+		{
+			Local_u8ErrorStatus = NOK ;
+		}
+	}
+	else
+	{
+		Local_u8ErrorStatus = NULL_POINTER ;
+	}
+	return Local_u8ErrorStatus ;
+}
+
+
 /**
  * @fn     : NVIC_SetPriority
  * @brief  : This Function Take IRQ Number and a Priority and assigns the priority to the associated IRQ
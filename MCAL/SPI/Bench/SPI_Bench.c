@@ -0,0 +1,255 @@
+/*
+ ******************************************************************************
+ * @file           : SPI_Bench.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SPI Driver Throughput & Latency Benchmark ( Linux Host )
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/* ======================================================================
+ * PLEASE READ THE FOLLOWING SPECIFICATIONS
+ * ====================================================================== */
+/**
+ *   @BUILD    : make -C MCAL/SPI/Bench             ( Builds spi_bench From The Unmodified Driver Sources )
+ *   @USAGE    : ./spi_bench [ FrameCycles ] [ Repeats ]   ( Defaults : 8 Cycles Per Frame , 4 Repeats )
+ *   @OUTPUT   : One Row Per Path & Transfer Size , All Cycle Counts Are Model Clock Cycles ( See SPI_BenchModel.h )
+ *               CYC/B     => Elapsed Cycles Per Byte From The Call Until The Transfer is Done
+ *               CPU/B     => Register Accesses Done by The CPU Per Byte ( Driver & ISR Work , Idle Time Excluded )
+ *               B/KCYC    => Bytes Moved Per 1000 Cycles
+ *               ISR/XFER  => Interrupt Handler Entries Per Transfer
+ *               SETUP     => Cycles Until The First Frame Reaches The TX Buffer ( Setup Latency )
+ *               START     => Cycles Spent Inside The Start Function ( SPI Driver SetupCycles Statistic , Async Paths Only )
+ *               OVR       => Frames Lost to Overrun , DATA => Loop Back Check of The Received Buffer
+ *   @EXIT     : Non Zero IF Any Transfer Fails , Times Out , Overruns or Receives Wrong Data
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../../LIB/ErrType.h"
+#include "../../../LIB/STM32F446xx.h"
+
+#include "../../GPIO/Inc/GPIO_Interface.h"
+#include "../Inc/SPI_Interface.h"
+
+#include "SPI_BenchModel.h"
+
+/* ======================================================================
+ * BENCHMARK PARAMETERS
+ * ====================================================================== */
+
+#define BENCH_DEFAULT_FRAME_CYCLES 8
+#define BENCH_DEFAULT_REPEATS 4
+#define BENCH_MAX_SIZE 256
+
+/* Idle Cycles Allowed Per Frame ( on Top of The Frame Time ) Before an Asynchronous Transfer is Declared Stuck */
+#define BENCH_TIMEOUT_CYCLES_PER_FRAME 64
+
+typedef enum
+{
+	BENCH_POLLING = 0,
+	BENCH_IT,
+	BENCH_DMA,
+	BENCH_PATHS_NUM
+
+} BENCH_PATH_t;
+
+static const char *const Bench_PathNames[BENCH_PATHS_NUM] = {"POLL", "IT", "DMA"};
+
+static const uint16_t Bench_Sizes[] = {1, 4, 16, 64, 256};
+
+/* Static Buffers Stay Below 4 GB in a Non PIE Build So Their Addresses Fit The 32 Bit DMA Address Registers */
+static uint8_t Bench_TxBuffer[BENCH_MAX_SIZE];
+static uint8_t Bench_RxBuffer[BENCH_MAX_SIZE];
+
+static volatile uint8_t Bench_Done = 0;
+
+static uint32_t Bench_FrameCycles = BENCH_DEFAULT_FRAME_CYCLES;
+
+static SPI_Config_t Bench_SPIConfig =
+	{
+		.SPINumber = SPI1_APB2,
+		.NodeRole = SPI_MASTER,
+		.Mode = SPI_FULL_DUPLEX,
+		.DataWidth = SPI_1BYTE,
+		.Direction = SPI_MSB_FIRST,
+		.SlaveManage = SPI_SW_SLAVE_MANAGE,
+		.BaudRate = SPI_PERIPH_CLK_BY2,
+		.ClockPolarity = SPI_CLK_IDLE_LOW,
+		.ClockPhase = SPI_CAPTURE_LEADING,
+		.SlaveSelectOutputType = SPI_SS_OUT_DIS,
+		.CRC_Status = SPI_CRC_DIS,
+		.InterruptEnable = {SPI_IT_DIS, SPI_IT_DIS, SPI_IT_DIS},
+		.CRCPolynomial = 0,
+};
+
+/* ======================================================================
+ * BENCHMARK FUNCTIONS
+ * ====================================================================== */
+
+static void Bench_TransferDone(void)
+{
+	Bench_Done = 1;
+}
+
+/**
+ * @brief  : Runs Repeats Transfers of BufferSize Bytes on a Path & Prints One Result Row
+ * @return : Number of Failed Transfers
+ */
+static uint32_t Bench_Run(BENCH_PATH_t Path, uint16_t BufferSize, uint32_t Repeats)
+{
+	uint32_t Local_u32Failures = 0;
+	uint32_t Local_u32Repeat;
+	uint32_t Local_u32Index;
+
+	uint64_t Local_u64Cycles = 0;
+	uint64_t Local_u64CPUAccesses = 0;
+	uint64_t Local_u64IRQEntries = 0;
+	uint64_t Local_u64SetupCycles = 0;
+	uint64_t Local_u64Overruns = 0;
+
+	SPI_Statistics_t Local_Statistics;
+
+	SPI_ResetStatistics(SPI1_APB2);
+
+	for (Local_u32Repeat = 0; Local_u32Repeat < Repeats; Local_u32Repeat++)
+	{
+		ERRORS_t Local_u8Status = SPI_NOK;
+		uint32_t Local_u32StartCycles;
+		uint32_t Local_u32StartAccesses;
+		uint32_t Local_u32StartIRQs;
+		uint32_t Local_u32Timeout = (uint32_t)(BufferSize + 2) * (Bench_FrameCycles + BENCH_TIMEOUT_CYCLES_PER_FRAME);
+
+		for (Local_u32Index = 0; Local_u32Index < BufferSize; Local_u32Index++)
+		{
+			Bench_TxBuffer[Local_u32Index] = (uint8_t)(Local_u32Index * 7 + Local_u32Repeat + 1);
+			Bench_RxBuffer[Local_u32Index] = 0;
+		}
+
+		Bench_Done = 0;
+
+		SPIBench_MarkStart();
+		Local_u32StartCycles = SPI_Bench_u32Cycles;
+		Local_u32StartAccesses = SPI_Bench_u32CPUAccesses;
+		Local_u32StartIRQs = SPI_Bench_u32IRQEntries;
+
+		switch (Path)
+		{
+		case BENCH_POLLING:
+			Local_u8Status = SPI_TransceiveBuffer(&Bench_SPIConfig, Bench_RxBuffer, Bench_TxBuffer, BufferSize);
+			Bench_Done = 1;
+			break;
+
+		case BENCH_IT:
+			Local_u8Status = SPI_TransceiveBuffer_IT(&Bench_SPIConfig, Bench_RxBuffer, Bench_TxBuffer, BufferSize, Bench_TransferDone);
+			break;
+
+		case BENCH_DMA:
+			Local_u8Status = SPI_TransceiveBuffer_DMA(&Bench_SPIConfig, Bench_RxBuffer, Bench_TxBuffer, BufferSize, Bench_TransferDone);
+			break;
+
+		default:
+			break;
+		}
+
+		/* CPU Idles Until The Completion Call Back , Interrupts Are Dispatched Here */
+		while (Local_u8Status == SPI_OK && !Bench_Done && Local_u32Timeout != 0)
+		{
+			SPIBench_Idle();
+			Local_u32Timeout--;
+		}
+
+		Local_u64Cycles += SPI_Bench_u32Cycles - Local_u32StartCycles;
+		Local_u64CPUAccesses += SPI_Bench_u32CPUAccesses - Local_u32StartAccesses;
+		Local_u64IRQEntries += SPI_Bench_u32IRQEntries - Local_u32StartIRQs;
+		Local_u64SetupCycles += SPI_Bench_u32FirstFrameCycle - Local_u32StartCycles;
+		Local_u64Overruns += SPI_Bench_u32Overruns;
+
+		if (Local_u8Status != SPI_OK || !Bench_Done || SPI_Bench_u32Overruns != 0 ||
+			memcmp(Bench_RxBuffer, Bench_TxBuffer, BufferSize) != 0)
+		{
+			Local_u32Failures++;
+
+			/* Let a Stuck Transfer Drain Before The Next One */
+			for (Local_u32Timeout = 0; Local_u32Timeout < (uint32_t)(BufferSize + 2) * (Bench_FrameCycles + BENCH_TIMEOUT_CYCLES_PER_FRAME); Local_u32Timeout++)
+			{
+				SPIBench_Idle();
+			}
+		}
+	}
+
+	SPI_GetStatistics(SPI1_APB2, &Local_Statistics);
+
+	printf("%-5s %5u %8.2f %8.2f %8.1f %9.2f %6.1f ",
+		   Bench_PathNames[Path], BufferSize,
+		   (double)Local_u64Cycles / ((double)BufferSize * Repeats),
+		   (double)Local_u64CPUAccesses / ((double)BufferSize * Repeats),
+		   (1000.0 * BufferSize * Repeats) / (double)Local_u64Cycles,
+		   (double)Local_u64IRQEntries / Repeats,
+		   (double)Local_u64SetupCycles / Repeats);
+
+	if (Path == BENCH_POLLING)
+	{
+		printf("%6s ", "-");
+	}
+	else
+	{
+		printf("%6.1f ", (double)Local_Statistics.SetupCycles / Repeats);
+	}
+
+	printf("%4llu %s\n", (unsigned long long)Local_u64Overruns, (Local_u32Failures == 0) ? "OK" : "FAIL");
+
+	return Local_u32Failures;
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t Local_u32Repeats = BENCH_DEFAULT_REPEATS;
+	uint32_t Local_u32Failures = 0;
+	uint8_t Local_u8Path;
+	uint8_t Local_u8Size;
+
+	if (argc > 1)
+	{
+		Bench_FrameCycles = (uint32_t)strtoul(argv[1], NULL, 0);
+	}
+	if (argc > 2)
+	{
+		Local_u32Repeats = (uint32_t)strtoul(argv[2], NULL, 0);
+	}
+	if (Local_u32Repeats == 0)
+	{
+		fprintf(stderr, "USAGE : %s [ FrameCycles ] [ Repeats > 0 ]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	SPIBench_Init(Bench_FrameCycles);
+
+	if (SPI_OK != SPI_Init(&Bench_SPIConfig))
+	{
+		fprintf(stderr, "SPI BENCH : SPI_Init Failed\n");
+		return EXIT_FAILURE;
+	}
+
+	printf("SPI1 HOST BENCHMARK , FRAME = %u CYCLES , %u REPEATS\n", Bench_FrameCycles, Local_u32Repeats);
+	printf("%-5s %5s %8s %8s %8s %9s %6s %6s %4s %s\n", "PATH", "BYTES", "CYC/B", "CPU/B", "B/KCYC", "ISR/XFER", "SETUP", "START", "OVR", "DATA");
+
+	for (Local_u8Path = 0; Local_u8Path < BENCH_PATHS_NUM; Local_u8Path++)
+	{
+		for (Local_u8Size = 0; Local_u8Size < sizeof(Bench_Sizes) / sizeof(Bench_Sizes[0]); Local_u8Size++)
+		{
+			Local_u32Failures += Bench_Run((BENCH_PATH_t)Local_u8Path, Bench_Sizes[Local_u8Size], Local_u32Repeats);
+		}
+	}
+
+	return (Local_u32Failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,508 @@
+/*
+ ******************************************************************************
+ * @file           : SPI_BenchModel.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host Register Model For The SPI Benchmark ( Linux x86-64 )
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "SPI Host Register Model Needs Linux on x86-64 ( Page Faults & Single Stepping Are Used to Trap Register Accesses )"
+#endif
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+
+#include "../../../LIB/STM32F446xx.h"
+
+#include "SPI_BenchModel.h"
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+#define BENCH_PAGE_SIZE 0x1000UL
+#define BENCH_PAGE_OF(ADDRESS) ((uintptr_t)(ADDRESS) & ~(BENCH_PAGE_SIZE - 1))
+
+/* Address Ranges Mapped as Plain Memory ( APB / AHB1 Peripherals & Cortex-M4 System Control Space ) */
+#define BENCH_PERIPH_BASE 0x40000000UL
+#define BENCH_PERIPH_SIZE 0x00080000UL
+#define BENCH_CORE_BASE 0xE0000000UL
+#define BENCH_CORE_SIZE 0x00100000UL
+
+/* Trapped Pages ( DMA1 Shares The DMA2 Page , Its Accesses Are Counted But Not Modelled ) */
+#define BENCH_SPI_PAGE BENCH_PAGE_OF(SPI1_BASE_ADDRESS)
+#define BENCH_DMA_PAGE BENCH_PAGE_OF(DMA2_BASE_ADDRESS)
+
+/* x86-64 EFLAGS Trap Flag & Page Fault Error Code Write Bit */
+#define BENCH_EFLAGS_TF 0x100UL
+#define BENCH_PF_WRITE 0x2UL
+
+/* SPI SR Bits */
+#define BENCH_SR_RXNE 0
+#define BENCH_SR_TXE 1
+#define BENCH_SR_OVR 6
+#define BENCH_SR_BSY 7
+
+/* SPI Register Index ( Offset / 4 ) */
+#define BENCH_SPI_CR1 0
+#define BENCH_SPI_CR2 1
+#define BENCH_SPI_SR 2
+#define BENCH_SPI_DR 3
+
+/* DMA Stream CR Bits & Fields */
+#define BENCH_DMA_EN 0
+#define BENCH_DMA_TEIE 2
+#define BENCH_DMA_HTIE 3
+#define BENCH_DMA_TCIE 4
+#define BENCH_DMA_DIR 6
+#define BENCH_DMA_CIRC 8
+#define BENCH_DMA_MINC 10
+#define BENCH_DMA_MSIZE 13
+
+#define BENCH_DMA_DIR_P2M 0
+#define BENCH_DMA_DIR_M2P 1
+
+/* DMA Stream Flags ( Shifted by 0 For Even Streams & 6 For Odd Streams in ISR[ Stream / 2 ] ) */
+#define BENCH_DMA_TEIF 3
+#define BENCH_DMA_HTIF 4
+#define BENCH_DMA_TCIF 5
+
+/* Offset of The First Stream in DMA_RegDef_t & Size of a Stream Block */
+#define BENCH_DMA_STREAM_OFFSET 16UL
+#define BENCH_DMA_STREAM_SIZE 24UL
+
+#define BENCH_DMA_STREAMS 8
+
+/* ======================================================================
+ * INTERRUPT HANDLERS OF THE DRIVERS UNDER TEST
+ * ====================================================================== */
+
+void SPI1_IRQHandler(void);
+void DMA2_Stream0_IRQHandler(void);
+void DMA2_Stream1_IRQHandler(void);
+void DMA2_Stream2_IRQHandler(void);
+void DMA2_Stream3_IRQHandler(void);
+void DMA2_Stream4_IRQHandler(void);
+void DMA2_Stream5_IRQHandler(void);
+void DMA2_Stream6_IRQHandler(void);
+void DMA2_Stream7_IRQHandler(void);
+
+static void (*const Model_DMAHandlers[BENCH_DMA_STREAMS])(void) =
+	{
+		DMA2_Stream0_IRQHandler, DMA2_Stream1_IRQHandler, DMA2_Stream2_IRQHandler, DMA2_Stream3_IRQHandler,
+		DMA2_Stream4_IRQHandler, DMA2_Stream5_IRQHandler, DMA2_Stream6_IRQHandler, DMA2_Stream7_IRQHandler};
+
+/* ======================================================================
+ * GLOBAL VARIABLES
+ * ====================================================================== */
+
+volatile uint32_t SPI_Bench_u32Cycles = 0;
+volatile uint32_t SPI_Bench_u32CPUAccesses = 0;
+volatile uint32_t SPI_Bench_u32IRQEntries = 0;
+volatile uint32_t SPI_Bench_u32Overruns = 0;
+volatile uint32_t SPI_Bench_u32FirstFrameCycle = 0;
+
+/* Frame Shift Time */
+static uint32_t Model_FrameCycles = 1;
+
+/* TX Buffer , Shift Register & RX Buffer of SPI1 */
+static uint8_t Model_TxFull = 0;
+static uint16_t Model_TxData = 0;
+static uint8_t Model_ShiftBusy = 0;
+static uint16_t Model_ShiftData = 0;
+static uint32_t Model_ShiftDoneCycle = 0;
+static uint8_t Model_RxFull = 0;
+static uint16_t Model_RxData = 0;
+static uint8_t Model_Overrun = 0;
+static uint8_t Model_FirstFrameSeen = 0;
+
+/* DMA2 Streams Progress */
+static uint32_t Model_DMAItems[BENCH_DMA_STREAMS] = {0};
+static uint32_t Model_DMAIndex[BENCH_DMA_STREAMS] = {0};
+
+/* Access Being Single Stepped */
+static uintptr_t Model_PendingAddress = 0;
+static uint8_t Model_PendingWrite = 0;
+static uint32_t Model_PendingOldValue = 0;
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+static void Model_Protect(int Protection)
+{
+	mprotect((void *)BENCH_SPI_PAGE, BENCH_PAGE_SIZE, Protection);
+	mprotect((void *)BENCH_DMA_PAGE, BENCH_PAGE_SIZE, Protection);
+}
+
+static uint8_t Model_IsTrapped(uintptr_t Address)
+{
+	return (BENCH_PAGE_OF(Address) == BENCH_SPI_PAGE || BENCH_PAGE_OF(Address) == BENCH_DMA_PAGE);
+}
+
+static uint16_t Model_StatusRegister(void)
+{
+	return (uint16_t)((Model_RxFull << BENCH_SR_RXNE) | ((!Model_TxFull) << BENCH_SR_TXE) |
+					  (Model_Overrun << BENCH_SR_OVR) | ((Model_ShiftBusy || Model_TxFull) << BENCH_SR_BSY));
+}
+
+static void Model_SetDMAFlag(uint8_t Stream, uint8_t Flag)
+{
+	DMA2->ISR[Stream / 2] |= (uint16_t)(1U << (Flag + ((Stream % 2) ? 6 : 0)));
+}
+
+static uint16_t Model_DMAFlags(uint8_t Stream)
+{
+	return (uint16_t)((DMA2->ISR[Stream / 2] >> ((Stream % 2) ? 6 : 0)) & 0x3F);
+}
+
+static uintptr_t Model_DMAItemAddress(uint8_t Stream)
+{
+	uint32_t Local_u32CR = DMA2->STREAM[Stream].CR;
+	uintptr_t Local_ItemSize = (((Local_u32CR >> BENCH_DMA_MSIZE) & 3) == 0) ? 1 : 2;
+
+	return (uintptr_t)DMA2->STREAM[Stream].M0AR + (Model_DMAIndex[Stream] * Local_ItemSize);
+}
+
+/* One Item Moved by a Stream , Updates NDTR & Sets HT / TC Flags */
+static void Model_DMAItemDone(uint8_t Stream)
+{
+	volatile DMA_Stream_RegDef_t *Local_pStream = &DMA2->STREAM[Stream];
+
+	if ((Local_pStream->CR >> BENCH_DMA_MINC) & 1)
+	{
+		Model_DMAIndex[Stream]++;
+	}
+
+	Local_pStream->NDTR--;
+
+	if (Local_pStream->NDTR == Model_DMAItems[Stream] / 2)
+	{
+		Model_SetDMAFlag(Stream, BENCH_DMA_HTIF);
+	}
+
+	if (Local_pStream->NDTR == 0)
+	{
+		Model_SetDMAFlag(Stream, BENCH_DMA_TCIF);
+
+		if ((Local_pStream->CR >> BENCH_DMA_CIRC) & 1)
+		{
+			Local_pStream->NDTR = Model_DMAItems[Stream];
+			Model_DMAIndex[Stream] = 0;
+		}
+		else
+		{
+			/* Stream is Disabled by Hardware at The End of a Normal Transfer */
+			Local_pStream->CR &= ~(1UL << BENCH_DMA_EN);
+		}
+	}
+}
+
+/* Moves The Peripheral Forward to The Current Model Clock */
+static void Model_Advance(void)
+{
+	uint8_t Local_u8Progress;
+	uint8_t Local_u8Stream;
+
+	do
+	{
+		Local_u8Progress = 0;
+
+		/* Frame Shifted Out , MISO is Looped Back to MOSI */
+		if (Model_ShiftBusy && (int32_t)(SPI_Bench_u32Cycles - Model_ShiftDoneCycle) >= 0)
+		{
+			Model_ShiftBusy = 0;
+
+			if (Model_RxFull)
+			{
+				Model_Overrun = 1;
+				SPI_Bench_u32Overruns++;
+			}
+			else
+			{
+				Model_RxData = Model_ShiftData;
+				Model_RxFull = 1;
+			}
+			Local_u8Progress = 1;
+		}
+
+		/* TX Buffer Moves to The Idle Shift Register While SPI is Enabled */
+		if (!Model_ShiftBusy && Model_TxFull && ((SPI1->CR1 >> SPI_SPE) & 1))
+		{
+			Model_ShiftData = Model_TxData;
+			Model_TxFull = 0;
+			Model_ShiftBusy = 1;
+			Model_ShiftDoneCycle = SPI_Bench_u32Cycles + Model_FrameCycles;
+			Local_u8Progress = 1;
+		}
+
+		/* DMA Requests of SPI1 */
+		for (Local_u8Stream = 0; Local_u8Stream < BENCH_DMA_STREAMS; Local_u8Stream++)
+		{
+			volatile DMA_Stream_RegDef_t *Local_pStream = &DMA2->STREAM[Local_u8Stream];
+			uint32_t Local_u32Direction = (Local_pStream->CR >> BENCH_DMA_DIR) & 3;
+
+			if (!((Local_pStream->CR >> BENCH_DMA_EN) & 1) || Local_pStream->NDTR == 0 ||
+				Local_pStream->PAR != (uint32_t)(uintptr_t)&SPI1->DR)
+			{
+				continue;
+			}
+
+			if (Local_u32Direction == BENCH_DMA_DIR_M2P && ((SPI1->CR2 >> SPI_TXDMAEN) & 1) && !Model_TxFull)
+			{
+				uintptr_t Local_Address = Model_DMAItemAddress(Local_u8Stream);
+
+				Model_TxData = (((Local_pStream->CR >> BENCH_DMA_MSIZE) & 3) == 0) ? *(uint8_t *)Local_Address : *(uint16_t *)Local_Address;
+				Model_TxFull = 1;
+
+				if (!Model_FirstFrameSeen)
+				{
+					Model_FirstFrameSeen = 1;
+					SPI_Bench_u32FirstFrameCycle = SPI_Bench_u32Cycles;
+				}
+
+				Model_DMAItemDone(Local_u8Stream);
+				Local_u8Progress = 1;
+			}
+			else if (Local_u32Direction == BENCH_DMA_DIR_P2M && ((SPI1->CR2 >> SPI_RXDMAEN) & 1) && Model_RxFull)
+			{
+				uintptr_t Local_Address = Model_DMAItemAddress(Local_u8Stream);
+
+				if (((Local_pStream->CR >> BENCH_DMA_MSIZE) & 3) == 0)
+				{
+					*(uint8_t *)Local_Address = (uint8_t)Model_RxData;
+				}
+				else
+				{
+					*(uint16_t *)Local_Address = Model_RxData;
+				}
+				Model_RxFull = 0;
+
+				Model_DMAItemDone(Local_u8Stream);
+				Local_u8Progress = 1;
+			}
+		}
+	} while (Local_u8Progress);
+}
+
+/* Register Access is About to Execute , Pages Are Already Unprotected */
+static void Model_BeforeAccess(uintptr_t Address, uint8_t IsWrite)
+{
+	SPI_Bench_u32Cycles++;
+	SPI_Bench_u32CPUAccesses++;
+
+	Model_Advance();
+
+	Model_PendingOldValue = *(volatile uint32_t *)(Address & ~(uintptr_t)3);
+
+	if (Address >= SPI1_BASE_ADDRESS && Address < SPI1_BASE_ADDRESS + sizeof(SPI_RegDef_t))
+	{
+		uint32_t Local_u32Register = (uint32_t)((Address - SPI1_BASE_ADDRESS) / 4);
+
+		if (Local_u32Register == BENCH_SPI_SR)
+		{
+			SPI1->SR = Model_StatusRegister();
+		}
+		else if (Local_u32Register == BENCH_SPI_DR && !IsWrite)
+		{
+			SPI1->DR = Model_RxData;
+			Model_RxFull = 0;
+		}
+	}
+}
+
+/* Register Access Has Executed , Pages Are Still Unprotected */
+static void Model_AfterAccess(uintptr_t Address, uint8_t IsWrite)
+{
+	if (!IsWrite)
+	{
+		return;
+	}
+
+	if (Address >= SPI1_BASE_ADDRESS && Address < SPI1_BASE_ADDRESS + sizeof(SPI_RegDef_t))
+	{
+		if ((Address - SPI1_BASE_ADDRESS) / 4 == BENCH_SPI_DR)
+		{
+			/* Writing While TXE is Clear Overwrites The Pending Frame Like The Real TX Buffer */
+			Model_TxData = SPI1->DR;
+			Model_TxFull = 1;
+
+			if (!Model_FirstFrameSeen)
+			{
+				Model_FirstFrameSeen = 1;
+				SPI_Bench_u32FirstFrameCycle = SPI_Bench_u32Cycles;
+			}
+		}
+	}
+	else if (Address >= DMA2_BASE_ADDRESS && Address < DMA2_BASE_ADDRESS + sizeof(DMA_RegDef_t))
+	{
+		uintptr_t Local_Offset = Address - DMA2_BASE_ADDRESS;
+
+		if (Local_Offset >= 8 && Local_Offset < BENCH_DMA_STREAM_OFFSET)
+		{
+			/* IFCR Bits Written by One Clear The Matching ISR Bits , IFCR Reads as Zero */
+			uint8_t Local_u8Counter;
+
+			for (Local_u8Counter = 0; Local_u8Counter < 4; Local_u8Counter++)
+			{
+				DMA2->ISR[Local_u8Counter] &= (uint16_t)(~DMA2->IFCR[Local_u8Counter]);
+				DMA2->IFCR[Local_u8Counter] = 0;
+			}
+		}
+		else if (Local_Offset >= BENCH_DMA_STREAM_OFFSET && ((Local_Offset - BENCH_DMA_STREAM_OFFSET) % BENCH_DMA_STREAM_SIZE) < 4)
+		{
+			/* Stream CR Written , Latch The Transfer When EN Rises */
+			uint8_t Local_u8Stream = (uint8_t)((Local_Offset - BENCH_DMA_STREAM_OFFSET) / BENCH_DMA_STREAM_SIZE);
+
+			if (!((Model_PendingOldValue >> BENCH_DMA_EN) & 1) && ((DMA2->STREAM[Local_u8Stream].CR >> BENCH_DMA_EN) & 1))
+			{
+				Model_DMAItems[Local_u8Stream] = DMA2->STREAM[Local_u8Stream].NDTR;
+				Model_DMAIndex[Local_u8Stream] = 0;
+			}
+		}
+	}
+
+	Model_Advance();
+}
+
+static void Model_SegvHandler(int Signal, siginfo_t *Info, void *Context)
+{
+	ucontext_t *Local_pContext = (ucontext_t *)Context;
+	uintptr_t Local_Address = (uintptr_t)Info->si_addr;
+
+	(void)Signal;
+
+	if (!Model_IsTrapped(Local_Address))
+	{
+		/* Real Crash , Let it Fault Again With The Default Action */
+		signal(SIGSEGV, SIG_DFL);
+		return;
+	}
+
+	Model_PendingAddress = Local_Address;
+	Model_PendingWrite = ((Local_pContext->uc_mcontext.gregs[REG_ERR] & BENCH_PF_WRITE) != 0);
+
+	Model_Protect(PROT_READ | PROT_WRITE);
+
+	Model_BeforeAccess(Model_PendingAddress, Model_PendingWrite);
+
+	/* Execute The Faulting Instruction Only , Then Trap Back Into The Model */
+	Local_pContext->uc_mcontext.gregs[REG_EFL] |= BENCH_EFLAGS_TF;
+}
+
+static void Model_TrapHandler(int Signal, siginfo_t *Info, void *Context)
+{
+	ucontext_t *Local_pContext = (ucontext_t *)Context;
+
+	(void)Signal;
+	(void)Info;
+
+	Local_pContext->uc_mcontext.gregs[REG_EFL] &= ~BENCH_EFLAGS_TF;
+
+	Model_AfterAccess(Model_PendingAddress, Model_PendingWrite);
+
+	Model_Protect(PROT_NONE);
+}
+
+static void Model_Map(uintptr_t Base, size_t Size)
+{
+	if (mmap((void *)Base, Size, PROT_READ | PROT_WRITE, MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) != (void *)Base)
+	{
+		perror("SPI BENCH : Can't Map Peripheral Address Range ( Build With -no-pie )");
+		exit(EXIT_FAILURE);
+	}
+}
+
+/* ======================================================================
+ * MODEL FUNCTIONS
+ * ====================================================================== */
+
+void SPIBench_Init(uint32_t FrameCycles)
+{
+	struct sigaction Local_Action;
+
+	Model_FrameCycles = FrameCycles;
+
+	Model_Map(BENCH_PERIPH_BASE, BENCH_PERIPH_SIZE);
+	Model_Map(BENCH_CORE_BASE, BENCH_CORE_SIZE);
+
+	memset(&Local_Action, 0, sizeof(Local_Action));
+	Local_Action.sa_flags = SA_SIGINFO;
+	sigemptyset(&Local_Action.sa_mask);
+
+	Local_Action.sa_sigaction = Model_SegvHandler;
+	sigaction(SIGSEGV, &Local_Action, NULL);
+
+	Local_Action.sa_sigaction = Model_TrapHandler;
+	sigaction(SIGTRAP, &Local_Action, NULL);
+
+	Model_Protect(PROT_NONE);
+}
+
+void SPIBench_MarkStart(void)
+{
+	Model_FirstFrameSeen = 0;
+	SPI_Bench_u32FirstFrameCycle = 0;
+	SPI_Bench_u32Overruns = 0;
+	Model_Overrun = 0;
+}
+
+void SPIBench_Idle(void)
+{
+	uint8_t Local_u8SPIPending;
+	uint8_t Local_au8DMAPending[BENCH_DMA_STREAMS];
+	uint8_t Local_u8Stream;
+
+	Model_Protect(PROT_READ | PROT_WRITE);
+
+	SPI_Bench_u32Cycles++;
+
+	Model_Advance();
+
+	Local_u8SPIPending = (((SPI1->CR2 >> SPI_RXNEIE) & 1) && Model_RxFull) || (((SPI1->CR2 >> SPI_TXEIE) & 1) && !Model_TxFull);
+
+	for (Local_u8Stream = 0; Local_u8Stream < BENCH_DMA_STREAMS; Local_u8Stream++)
+	{
+		uint16_t Local_u16Flags = Model_DMAFlags(Local_u8Stream);
+		uint32_t Local_u32CR = DMA2->STREAM[Local_u8Stream].CR;
+
+		Local_au8DMAPending[Local_u8Stream] = (((Local_u16Flags >> BENCH_DMA_TCIF) & 1) && ((Local_u32CR >> BENCH_DMA_TCIE) & 1)) ||
+											  (((Local_u16Flags >> BENCH_DMA_HTIF) & 1) && ((Local_u32CR >> BENCH_DMA_HTIE) & 1)) ||
+											  (((Local_u16Flags >> BENCH_DMA_TEIF) & 1) && ((Local_u32CR >> BENCH_DMA_TEIE) & 1));
+	}
+
+	Model_Protect(PROT_NONE);
+
+	/* Handlers Run With Trapped Registers Like The Driver Code , Their Accesses Are CPU Cycles */
+	if (Local_u8SPIPending)
+	{
+		SPI_Bench_u32IRQEntries++;
+		SPI1_IRQHandler();
+	}
+
+	for (Local_u8Stream = 0; Local_u8Stream < BENCH_DMA_STREAMS; Local_u8Stream++)
+	{
+		if (Local_au8DMAPending[Local_u8Stream])
+		{
+			SPI_Bench_u32IRQEntries++;
+			Model_DMAHandlers[Local_u8Stream]();
+		}
+	}
+}
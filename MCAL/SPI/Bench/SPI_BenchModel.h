@@ -0,0 +1,75 @@
+/*
+ ******************************************************************************
+ * @file           : SPI_BenchModel.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host Register Model For The SPI Benchmark ( Linux x86-64 )
+ * @Date           : Oct 17, 2026
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+#ifndef SPI_BENCHMODEL_H_
+#define SPI_BENCHMODEL_H_
+
+#include <stdint.h>
+
+/* ======================================================================
+ * PLEASE READ THE FOLLOWING SPECIFICATIONS
+ * ====================================================================== */
+/**
+ *   @IDEA     : The Unmodified Drivers Run on The Host , Peripheral Address Ranges Are Mapped as Plain Memory
+ *               SPI1 & DMA2 Register Pages Are Access Protected , Each Access Traps & is Single Stepped So The Model
+ *               Sees Every Read & Write of SPI_RegDef_t / DMA_RegDef_t Fields Like The Real Peripheral Would
+ *   @CLOCK    : The Model Clock Advances One Cycle Per Register Access & One Cycle Per SPIBench_Idle Call
+ *               A Frame Written to DR Sets RXNE After FrameCycles Clock Cycles , TXE Sets as Soon as The Frame Moves to The Shift Register
+ *               MISO is Looped Back to MOSI So The Received Data Must Match The Sent Data
+ *   @DMA      : DMA2 Streams Whose Peripheral Address is SPI1 DR Serve TXE / RXNE Requests Without CPU Accesses
+ *   @IRQ      : Interrupts Are Dispatched From SPIBench_Idle Only ( The CPU Idle Loop ) , NVIC Enable & Priorities Are Not Modelled
+ */
+
+/* ======================================================================
+ * MODEL COUNTERS
+ * ====================================================================== */
+
+/* Model Clock , Used as SPI_STATISTICS_CYCLE_COUNTER by The Benchmark Build */
+extern volatile uint32_t SPI_Bench_u32Cycles;
+
+/* Register Accesses Done by The CPU ( Driver Code & ISRs ) , Idle Cycles Are Not Counted */
+extern volatile uint32_t SPI_Bench_u32CPUAccesses;
+
+/* Interrupt Handlers Invoked by The Model ( SPI1 & DMA2 Streams ) */
+extern volatile uint32_t SPI_Bench_u32IRQEntries;
+
+/* Frames Received While RXNE Was Still Set ( Lost Frames ) */
+extern volatile uint32_t SPI_Bench_u32Overruns;
+
+/* Model Clock Value When The First Frame Entered The TX Buffer After SPIBench_MarkStart */
+extern volatile uint32_t SPI_Bench_u32FirstFrameCycle;
+
+/* ======================================================================
+ * MODEL FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Map The Peripheral Address Ranges & Install The Register Access Traps
+ * @param  : FrameCycles => Model Clock Cycles Needed to Shift One Frame ( RXNE Delay After a Frame Starts )
+ * @note   : Must be Called Before Any Driver Function , Exits The Process IF The Address Ranges Can't be Mapped
+ */
+void SPIBench_Init(uint32_t FrameCycles);
+
+/**
+ * @brief  : This Function is Used to Reset The Per Transfer Model Counters Before a Measured Transfer
+ */
+void SPIBench_MarkStart(void);
+
+/**
+ * @brief  : This Function is Used to Spend One Idle CPU Cycle & Dispatch Pending SPI1 / DMA2 Interrupts
+ */
+void SPIBench_Idle(void);
+
+#endif /* SPI_BENCHMODEL_H_ */
@@ -0,0 +1,52 @@
+/*
+ ******************************************************************************
+ * @file           : SPI_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Configuration File For SPI Driver
+ * @Date           : Aug 20, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+#ifndef SPI_CONFIG_H_
+#define SPI_CONFIG_H_
+
+/* ======================================================================
+ * CONFIGURATION PARAMETERS
+ * ====================================================================== */
+
+/* Maximum Number of Pending Transactions Per SPI Peripheral in The Transaction Queue */
+#define SPI_QUEUE_SIZE 8
+
+/* SPI_Transfer Default Strategy Thresholds ( in Frames ) , Can be Changed Per Instance Using SPI_SetTransferThresholds
+ * Lengths <= SPI_POLLING_MAX_LENGTH Use Polling , Lengths <= SPI_IT_MAX_LENGTH Use Interrupts , Longer Transfers Use DMA
+ * Measured With The Host Benchmark ( make -C MCAL/SPI/Bench run , 8 Cycles Per Frame , Cycles Are Model Register Accesses ) :
+ *   Path     1 Byte Elapsed   4 Bytes Elapsed   CPU Cost
+ *   Polling  11               35                8.0 Per Frame ( Blocked For The Frame Time )
+ *   IT       13               46                3 Start + 3.0 Per Frame , 1 ISR Entry Per Frame
+ *   DMA      185              209               177 Per Transfer Whatever The Length , 1 ISR Entry Per Transfer
+ * Polling : Up to 4 Frames The Blocked Time ( 35 ) Stays Below an IT Round Trip ( 46 ) , Whose 4 ISR Entries Also Cost The Exception
+ *           Entry & Exit on Target ( Not Modelled ) , Longer Polls Block The CPU For Time an Interrupt Driven Transfer Gives Back
+ * IT      : DMA Per Transfer Cost / IT Per Frame Cost = 177 / 3 = 59 Frames , Elapsed Times Cross Between 16 & 64 Frames
+ *           ( 19.1 vs 11.1 CYC/B at 16 , 10.8 vs 11.0 CYC/B at 64 ) , Re Run The Benchmark With The Target Frame Time to Retune */
+#define SPI_POLLING_MAX_LENGTH 4
+#define SPI_IT_MAX_LENGTH 59
+
+/* SPI Driver Statistics ( Transfers , Frames , ISR Entries & Cycle Counts ) Read by SPI_GetStatistics
+ * Options : SPI_STATISTICS_ENABLE or SPI_STATISTICS_DISABLE ( Counters Are Not Compiled in The Hot Paths When Disabled ) */
+#ifndef SPI_STATISTICS
+#define SPI_STATISTICS SPI_STATISTICS_DISABLE
+#endif
+
+/* Free Running Cycle Counter Used by The Statistics , DWT CYCCNT by Default ( DWT Must be Enabled by The Application )
+ * Can be Redefined to Any uint32_t Counter ( e.g. The Simulated Register Model Clock of The Host Benchmark in MCAL/SPI/Bench ) */
+#ifndef SPI_STATISTICS_CYCLE_COUNTER
+#define SPI_STATISTICS_CYCLE_COUNTER (*(volatile uint32_t *)0xE0001004UL)
+#endif
+
+#endif /* SPI_CONFIG_H_ */
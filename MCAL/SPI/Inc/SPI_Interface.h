@@ -117,6 +117,20 @@ typedef enum
 
 } SPI_CRC_STATUS_t;
 
+/** SPI_CRC_RESULT_t
+ * ========================================================================
+ *  @brief : This Enum is used to report The Hardware CRC Check Result of The Last Transfer
+ *  @enum  : @SPI_CRC_RESULT_t
+ * ========================================================================
+ */
+typedef enum
+{
+    SPI_CRC_NOT_CHECKED = 0, /* CRC Disabled or Transfer Still in Progress */
+    SPI_CRC_PASS = 1,        /* Received CRC Matches */
+    SPI_CRC_FAIL = 2,        /* CRCERR Flag Was Set */
+
+} SPI_CRC_RESULT_t;
+
 /** SPI_DATA_SIZE_t
  * ========================================================================
  *  @brief : This Enum is used to select the SPI Data Size
@@ -289,9 +303,86 @@ typedef struct
     SPI_SS_OTYPE_t SlaveSelectOutputType;
     SPI_CRC_STATUS_t CRC_Status;
     SPI_IT_ENABLE_t InterruptEnable;
+    uint16_t CRCPolynomial; /* Written to CRCPR When CRC is Enabled , 0 Keeps The Reset Value ( 0x0007 ) */
 
 } SPI_Config_t;
 
+/* SPI_STATISTICS Options in SPI_Config.h */
+#define SPI_STATISTICS_DISABLE 0
+#define SPI_STATISTICS_ENABLE 1
+
+/** SPI_Statistics_t
+ * ========================================================================
+ *  @brief  : This struct is used to read The Driver Statistics of an SPI Peripheral
+ *  @struct : @SPI_Statistics_t
+ *  @note   : Counters Stay Zero Unless SPI_STATISTICS is Set to SPI_STATISTICS_ENABLE in SPI_Config.h
+ * ========================================================================
+ */
+typedef struct
+{
+    uint32_t Transfers;        /* Buffer Transfers Started */
+    uint32_t Frames;           /* Frames Requested in These Transfers */
+    uint32_t PollingTransfers; /* Transfers Done by Blocking Polling */
+    uint32_t ITTransfers;      /* Transfers Done by Interrupts */
+    uint32_t DMATransfers;     /* Transfers Done by DMA */
+    uint32_t ISREntries;       /* SPI & DMA Completion Interrupt Entries */
+    uint32_t BlockingCycles;   /* Cycles Spent Inside Blocking Transfers ( Cycles Per Frame = BlockingCycles / Polling Frames ) */
+    uint32_t SetupCycles;      /* Cycles Spent Starting Interrupt & DMA Transfers ( Setup Latency ) */
+
+} SPI_Statistics_t;
+
+/** SPI_QUEUE_ENGINE_t
+ * ========================================================================
+ *  @brief : This Enum is used to select how a Queued Transaction is Moved
+ *  @enum  : @SPI_QUEUE_ENGINE_t
+ * ========================================================================
+ */
+typedef enum
+{
+    SPI_QUEUE_ENGINE_IT = 0,  /* Drained From SPI RXNE Interrupt */
+    SPI_QUEUE_ENGINE_DMA = 1, /* Drained From DMA RX Stream Transfer Complete Interrupt */
+
+} SPI_QUEUE_ENGINE_t;
+
+/** SPI_Device_t
+ * ========================================================================
+ *  @brief  : This struct is used to describe a Device on an SPI Bus ( Used By The Transaction Queue )
+ *  @struct : @SPI_Device_t
+ *  @note   : GPIO_Interface.h Must be Included Before SPI_Interface.h , CS Pin Must be Initialized as Output By The Application
+ *            Config Must Use SPI_MASTER , its Clock Polarity , Phase , Baud Rate , Bit Order & Data Width Are Written to CR1
+ *            Before Each Transaction of The Device , Other Settings ( Mode , CRC , ... ) Are Taken From SPI_Init of The Peripheral
+ * ========================================================================
+ */
+typedef struct
+{
+    SPI_Config_t *Config;      /* SPI Configuration Used For This Device ( SPI_Init Must be Called With it ) */
+    Port_t CSPort;             /* Chip Select Port */
+    Pin_t CSPin;               /* Chip Select Pin */
+    uint16_t PreDelayUs;       /* Delay After CS Assertion in Micro Seconds ( 0 For No Delay ) , Never Waited in an Interrupt */
+    uint16_t PostDelayUs;      /* Delay Before CS Deassertion in Micro Seconds ( 0 For No Delay ) , Never Waited in an Interrupt */
+    SPI_QUEUE_ENGINE_t Engine; /* Interrupt or DMA */
+
+} SPI_Device_t;
+
+/** SPI_Transaction_t
+ * ========================================================================
+ *  @brief  : This struct is used to describe one Queued SPI Transaction
+ *  @struct : @SPI_Transaction_t
+ *  @note   : Buffers Are uint8_t For SPI_1BYTE Devices & uint16_t For SPI_2BYTE Devices , One of Them Can be NULL
+ *            The Struct Must Stay Valid Until its Call Back is Invoked
+ * ========================================================================
+ */
+typedef struct
+{
+    SPI_Device_t *Device;              /* Target Device */
+    void *ReceivedBuffer;              /* Receive Buffer or NULL */
+    void *BufferToSend;                /* Transmit Buffer or NULL */
+    uint16_t BufferSize;               /* Number of Frames */
+    void (*pv_CallBackFunc)(void);     /* Invoked After CS is Deasserted ( Can be NULL ) */
+    ERRORS_t Status;                   /* Set by The Driver Before The Call Back : SPI_OK , SPI_CRC_ERROR or SPI_NOK IF it Could Not be Started */
+
+} SPI_Transaction_t;
+
 /* ======================================================================
  *                         FUNCTIONS PROTOTYPES
  * ====================================================================== */
@@ -396,9 +487,26 @@ ERRORS_t SPI_TransceiveData(SPI_Config_t *Config, uint16_t *ReceivedData, uint16
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  * @note   : IF You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter ,
  *      IF You Want to Receive Data Only You Can Pass NULL to The BufferToSend Parameter
+ *      SPI Peripheral Must be Initialized Using SPI_Init With SPI_1BYTE Data Width , Parameters are Checked Once Per Call Not Per Byte
+ *      BufferSize Must Not be 0 , TIME_OUT_ERROR is Returned IF CRC is Enabled & The Peer CRC Frame is Not Received
+ *      SPI_NOK is Returned IF an Interrupt or DMA Transfer is Still in Progress on This SPI
  */
 ERRORS_t SPI_TransceiveBuffer(SPI_Config_t *Config, uint8_t *ReceviedBuffer, uint8_t *BufferToSend, uint16_t BufferSize);
 
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames at The Same Time
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Frames
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Frames to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : SPI Peripheral Must be Initialized Using SPI_Init With SPI_2BYTE Data Width , One Frame is Moved Per DR Access
+ *           BufferSize Must Not be 0 , TIME_OUT_ERROR is Returned IF CRC is Enabled & The Peer CRC Frame is Not Received
+ *           SPI_NOK is Returned IF an Interrupt or DMA Transfer is Still in Progress on This SPI
+ *      IF You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , IF You Want to Receive Data Only You Can Pass NULL to The BufferToSend Parameter
+ */
+ERRORS_t SPI_TransceiveBuffer16(SPI_Config_t *Config, uint16_t *ReceivedBuffer, uint16_t *BufferToSend, uint16_t BufferSize);
+
 /**
  * @brief  : This Function is Used to Send & Receive Data Using Interrupts ( Non Blocking Function ) AKA Asynchronous
  *
@@ -423,7 +531,187 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  * @note   : You Can Use This Function Directly without Enabling RXNE Interrupt in The Configuration Struct , as This Function Enables it Automatically
  *         if You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , IF You Want to Receive Data Only You Can NULL to The BufferToSend Parameter
+ *         Transfer is Full Duplex , Every RXNE Interrupt Stores The Received Item & Loads The Next Item to Be Sent in The Same ISR Pass
  */
 ERRORS_t SPI_TransceiveBuffer_IT(SPI_Config_t *Config, uint8_t *ReceivedBuffer, uint8_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
 
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames Using Interrupts ( Non Blocking Function ) AKA Asynchronous
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Frames
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Frames to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Works With SPI_2BYTE Data Width Only , One Frame is Moved Per DR Access
+ *         if You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , IF You Want to Receive Data Only You Can NULL to The BufferToSend Parameter
+ */
+ERRORS_t SPI_TransceiveBuffer16_IT(SPI_Config_t *Config, uint16_t *ReceivedBuffer, uint16_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Read The Hardware CRC Check Result of The Last Buffer Transfer on an SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Result => This is a Pointer to Variable That Holds The CRC Result -> @SPI_CRC_RESULT_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Useful For Interrupt , DMA & Queued Transfers , Call it From The Call Back Function
+ *           Blocking Buffer Transfers Also Return SPI_CRC_ERROR Directly on a Mismatch
+ */
+ERRORS_t SPI_GetCRCResult(SPI_t SPINum, SPI_CRC_RESULT_t *Result);
+
+/**
+ * @brief  : This Function is Used to Read The Result of The Last Interrupt or DMA Transfer on an SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Status => This is a Pointer to Variable That Holds The Transfer Result , SPI_OK or SPI_NOK IF an Overrun or Mode Fault Ended it
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Call it From The Call Back Function , Queued Transactions Get The Same Result in Their Status Field
+ */
+ERRORS_t SPI_GetTransferStatus(SPI_t SPINum, ERRORS_t *Status);
+
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of Data Using DMA ( Non Blocking Function ) AKA Asynchronous
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint8_t Array That Holds The Received Data
+ * @param  : BufferToSend => This is a Pointer to uint8_t Array That Holds The Data to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Size of The Buffer to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address , Invoked Once When The Whole Buffer is Exchanged
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Function Selects The DMA Controller , Streams & Channel of The SPI Peripheral Internally & Starts RX & TX Streams Together
+ *              SPI1 -> DMA2 ( RX Stream 2 , TX Stream 5 , Channel 3 )    SPI2 -> DMA1 ( RX Stream 3 , TX Stream 4 , Channel 0 )
+ *              SPI3 -> DMA1 ( RX Stream 0 , TX Stream 5 , Channel 0 )    SPI4 -> DMA2 ( RX Stream 0 , TX Stream 1 , Channel 4 )
+ *           You Should Enable The RX Stream Interrupt of The Used SPI in NVIC as The Call Back Function is Invoked From it
+ *           IF You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , IF You Want to Receive Data Only You Can Pass NULL to The BufferToSend Parameter
+ *           Works With SPI_1BYTE Data Width Only
+ */
+ERRORS_t SPI_TransceiveBuffer_DMA(SPI_Config_t *Config, uint8_t *ReceivedBuffer, uint8_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames Using DMA ( Non Blocking Function ) AKA Asynchronous
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Frames
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Frames to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address , Invoked Once When The Whole Buffer is Exchanged
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Works With SPI_2BYTE Data Width Only , Same DMA Streams & Channels as SPI_TransceiveBuffer_DMA
+ */
+ERRORS_t SPI_TransceiveBuffer16_DMA(SPI_Config_t *Config, uint16_t *ReceivedBuffer, uint16_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Add a Transaction to The Transaction Queue of its SPI Peripheral
+ *
+ * @param  : Transaction => This is a Pointer to Struct of Type SPI_Transaction_t That Describes The Transaction -> @SPI_Transaction_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : IF The SPI is Idle The Transaction Starts Immediately , Otherwise it Starts From The Completion Interrupt of The Previous One
+ *           The Driver Applies The Device Clock Settings , Asserts CS ( PIN_LOW ) , Waits PreDelayUs , Exchanges The Buffers , Waits PostDelayUs ,
+ *           Deasserts CS Then Invokes The Call Back
+ *           Delays Are Busy Waits So They Are Never Done in an Interrupt , a Device With Delays is Started Here or From SPI_QueueProcess & its
+ *           CS is Released From SPI_QueueProcess , Devices Without Delays Are Chained Back to Back From The Completion Interrupt
+ *           The SPI IRQ ( IT Engine ) or The DMA RX Stream IRQ ( DMA Engine ) Must be Enabled in The NVIC , The Queue Only Masks & Restores Them
+ *           Returns SPI_NOK IF The Queue is Full ( SPI_QUEUE_SIZE in SPI_Config.h )
+ */
+ERRORS_t SPI_SubmitTransaction(SPI_Transaction_t *Transaction);
+
+/**
+ * @brief  : This Function is Used to Finish The Delayed Steps of The Transaction Queue of an SPI Peripheral in Thread Context
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Waits The PostDelayUs of a Finished Transaction , Deasserts its CS & Invokes its Call Back , Then Starts The Next Pending
+ *           Transaction With its PreDelayUs , Call it From The Main Loop When Any Device Uses Nonzero Delays ( Never From an Interrupt )
+ */
+ERRORS_t SPI_QueueProcess(SPI_t SPINum);
+
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer Choosing Polling , Interrupts or DMA Automatically According to its Length
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => Pointer to uint8_t ( SPI_1BYTE ) or uint16_t ( SPI_2BYTE ) Array That Holds The Received Data or NULL
+ * @param  : BufferToSend => Pointer to uint8_t ( SPI_1BYTE ) or uint16_t ( SPI_2BYTE ) Array That Holds The Data to Be Sent or NULL
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => Invoked When The Transfer is Done ( Before Returning IF Polling is Selected ) , Can be NULL
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Lengths Up to The Polling Threshold Are Blocking , Lengths Up to The Interrupt Threshold Use Interrupts & Longer Ones Use DMA
+ *           Default Thresholds Are in SPI_Config.h , SPI_Init Must be Called First
+ */
+ERRORS_t SPI_Transfer(SPI_Config_t *Config, void *ReceivedBuffer, void *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Tune The Length Thresholds Used by SPI_Transfer For One SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : PollingMaxLength => Transfers of This Length or Shorter Use Polling
+ * @param  : ITMaxLength => Longer Transfers Up to This Length Use Interrupts , Longer Ones Use DMA
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : SPI_Init Resets The Thresholds to The Defaults in SPI_Config.h , So Call This Function After SPI_Init
+ */
+ERRORS_t SPI_SetTransferThresholds(SPI_t SPINum, uint16_t PollingMaxLength, uint16_t ITMaxLength);
+
+/**
+ * @brief  : This Function is Used to Read The Driver Statistics of an SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Statistics => This is a Pointer to Struct of Type SPI_Statistics_t That Holds The Copied Statistics
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_GetStatistics(SPI_t SPINum, SPI_Statistics_t *Statistics);
+
+/**
+ * @brief  : This Function is Used to Clear The Driver Statistics of an SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_ResetStatistics(SPI_t SPINum);
+
+/**
+ * @brief  : This Function is Used to Start a Continuous Slave Receive Into a Ring Buffer Using Circular DMA
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : RingBuffer => This is a Pointer to uint8_t Array Used as The Ring Buffer
+ * @param  : RingSize => This is a Variable of Type uint16_t That Holds The Size of The Ring Buffer
+ * @param  : pv_HalfCallBackFunc => Invoked When The First Half of The Ring is Filled ( Can be NULL )
+ * @param  : pv_FullCallBackFunc => Invoked When The Second Half of The Ring is Filled ( Can be NULL )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Works in SPI_SLAVE Role With SPI_1BYTE Data Width Only , Uses The Same RX DMA Stream as SPI_TransceiveBuffer_DMA
+ *           Reception Continues Until SPI_StopRingReceive_DMA is Called , Use SPI_GetRingAvailable & SPI_ReadRing to Consume The Data
+ *           The Application Must Read Faster Than The Ring is Refilled , Otherwise Unread Data is Overwritten & SPI_RING_OVERRUN is Reported
+ *           Half & Full Ring Interrupts Count The DMA Laps , So The DMA RX Stream IRQ Must be Enabled in The NVIC
+ */
+ERRORS_t SPI_StartRingReceive_DMA(SPI_Config_t *Config, uint8_t *RingBuffer, uint16_t RingSize, void (*pv_HalfCallBackFunc)(void), void (*pv_FullCallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Stop The Continuous Ring Buffer Receive
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_StopRingReceive_DMA(SPI_t SPINum);
+
+/**
+ * @brief  : This Function is Used to Get The Number of Received Bytes Not Read Yet From The Ring Buffer
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Available => This is a Pointer to Variable That Holds The Number of Available Bytes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ *           SPI_RING_OVERRUN IF DMA Overwrote Unread Bytes , They Are Dropped & Reading Resumes From The Newest Byte
+ */
+ERRORS_t SPI_GetRingAvailable(SPI_t SPINum, uint16_t *Available);
+
+/**
+ * @brief  : This Function is Used to Copy Received Bytes Out of The Ring Buffer & Advance The Read Pointer
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Data => This is a Pointer to uint8_t Array That Holds The Copied Data
+ * @param  : Length => This is a Variable of Type uint16_t That Holds The Maximum Number of Bytes to Copy
+ * @param  : ReadLength => This is a Pointer to Variable That Holds The Number of Bytes Actually Copied
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ *           SPI_RING_OVERRUN IF DMA Overwrote Unread Bytes Before ( Nothing Copied ) or While They Were Copied ( Copied Data Not Valid )
+ */
+ERRORS_t SPI_ReadRing(SPI_t SPINum, uint8_t *Data, uint16_t Length, uint16_t *ReadLength);
+
 #endif /* SPI_INTERFACE_H_ */
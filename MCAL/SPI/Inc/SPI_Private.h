@@ -13,8 +13,119 @@
  ******************************************************************************
  */
 
-#ifndef USART_PRIVATE_H_
-#define USART_PRIVATE_H_
+#ifndef SPI_PRIVATE_H_
+#define SPI_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+#define SPI_BR_MASK 0xFFC7
+
+#define SPI_NOT_PREPARED 0x00
+#define SPI_PREPARED 0x01
+
+/* Statistics Helpers , Expand to Nothing Useful When SPI_STATISTICS is Disabled */
+#if SPI_STATISTICS == SPI_STATISTICS_ENABLE
+#define SPI_STATS_ADD(SPINUM, FIELD, VALUE) (SPI_Statistics[(SPINUM)].FIELD += (uint32_t)(VALUE))
+#define SPI_STATS_CYCLES() (SPI_STATISTICS_CYCLE_COUNTER)
+#else
+#define SPI_STATS_ADD(SPINUM, FIELD, VALUE) ((void)(VALUE))
+#define SPI_STATS_CYCLES() (0UL)
+#endif
+
+/* Data Sent to Generate The Clock When Receiving Only */
+#define SPI_DUMMY_DATA 0xFF
+
+/* Maximum Status Register Polls While Waiting For a Flag That Changes Within a Frame Time ( BSY , CRC Frame RXNE ) */
+#define SPI_FLAG_TIMEOUT 100000UL
+
+/* Context of SPI_QueueStartNext , Busy Wait Delays Are Applied in Thread Context Only */
+#define SPI_QUEUE_ISR_CONTEXT 0x00
+#define SPI_QUEUE_THREAD_CONTEXT 0x01
+
+/* Previous NVIC Enable State Returned by SPI_QueueLock */
+#define SPI_LOCK_SPI_IRQ_ENABLED 0x01
+#define SPI_LOCK_DMA_IRQ_ENABLED 0x02
+
+/* ======================================================================
+ * PRIVATE ENUMS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Enum is Used to Specify The SPI Interrupts
+ */
+typedef enum
+{
+    SPI_IT_TXE = 0x00,
+    SPI_IT_RXNE = 0x01,
+    SPI_IT_ERR = 0x02,
+    SPI_IT_MAX_NUM = 0x03
+
+} SPI_IT_SRC_t;
+
+/**
+ * @brief  : This Enum is Used to Specify The SPI Interrupt Sources
+ */
+typedef enum
+{
+    SPI_NO_IRQ_SRC = 0x00,
+    SPI_TRANSCEIVE_DATA_IRQ_SRC = 0x01,
+    SPI_TRANSCEIVE_BUFFER_IRQ_SRC = 0x02,
+    SPI_TRANSCEIVE_BUFFER_DMA_SRC = 0x03,
+    SPI_TRANSCEIVE_BUFFER16_IRQ_SRC = 0x04,
+    SPI_RING_RECEIVE_DMA_SRC = 0x05,
+
+} SPI_IRQ_SRC_t;
+
+/**
+ * @brief  : This Struct is Used to Map Each SPI Peripheral to Its DMA Controller , Streams & Channel
+ */
+typedef struct
+{
+    DMA_CONTROLLER_t DMAController;
+    DMA_STREAMS_t RxStream;
+    DMA_STREAMS_t TxStream;
+    DMA_CHANNEL_t ChannelNumber;
+
+} SPI_DMA_MAP_t;
+
+/**
+ * @brief  : This Struct is Used to Hold The Asynchronous Transfer State of One SPI Peripheral
+ */
+typedef struct
+{
+    uint8_t Prepared;              /* SPI_PREPARED After a Successful SPI_Init */
+    SPI_DATA_SIZE_t DataWidth;     /* Data Width Validated in SPI_Init */
+    SPI_CRC_STATUS_t CRCStatus;    /* Hardware CRC Enabled in SPI_Init or NOT */
+    SPI_CRC_RESULT_t CRCResult;    /* CRC Check Result of The Last Buffer Transfer */
+    ERRORS_t TransferStatus;       /* SPI_OK or SPI_NOK IF an Overrun or Mode Fault Ended The Last Asynchronous Transfer */
+    uint16_t PollingMaxLength;     /* SPI_Transfer Uses Polling Up to This Length */
+    uint16_t ITMaxLength;          /* SPI_Transfer Uses Interrupts Up to This Length , DMA Above */
+    SPI_IRQ_SRC_t IRQSource;       /* Current Asynchronous Operation */
+    uint16_t *DataToBeReceived;    /* Transceive Data Receive Location */
+    uint8_t *BufferToBeReceived;   /* Transceive Buffer Receive Location */
+    uint8_t *BufferToBeSent;       /* Transceive Buffer Data to Be Sent */
+    uint16_t *Buffer16ToBeReceived; /* Transceive 16 Bit Buffer Receive Location */
+    uint16_t *Buffer16ToBeSent;    /* Transceive 16 Bit Buffer Data to Be Sent */
+    uint16_t BufferSize;           /* Transceive Buffer Size */
+    uint16_t TransmitCounter;      /* Number of Items Written to DR */
+    uint16_t ReceiveCounter;       /* Number of Items Read From DR */
+    SPI_Transaction_t *Queue[SPI_QUEUE_SIZE]; /* Pending Transactions */
+    uint8_t QueueHead;             /* Index of Next Transaction to Be Started */
+    uint8_t QueueTail;             /* Index of Next Free Slot */
+    uint8_t QueueCount;            /* Number of Pending Transactions */
+    SPI_Transaction_t *ActiveTransaction; /* Queued Transaction Currently on The Bus */
+    uint8_t ReleasePending;        /* Active Transaction Finished , CS Waits For its PostDelayUs in SPI_QueueProcess */
+    uint8_t *RingBuffer;           /* Circular DMA Receive Ring Buffer */
+    uint16_t RingSize;             /* Ring Buffer Size */
+    uint16_t RingReadIndex;        /* Index of Next Byte to Be Read by The Application */
+    uint32_t RingReadCount;        /* Bytes Read by The Application Since The Ring Was Started */
+    volatile uint32_t RingEvents;  /* Half & Full Ring Interrupts Since The Ring Was Started , Counts The DMA Laps */
+    void (*RingHalfCallBack)(void); /* Application Half Ring Call Back ( Can be NULL ) */
+    void (*RingFullCallBack)(void); /* Application Full Ring Call Back ( Can be NULL ) */
+
+} SPI_TransferState_t;
 
 /* ======================================================================
  * PRIVATE FUNCTION
@@ -46,48 +157,156 @@ static ERRORS_t SPI_SetMode(SPI_Config_t *Config);
  */
 static ERRORS_t SPI_HANDLE_IT(SPI_t SPINumber);
 
-/* ======================================================================
- * PRIVATE MACROS
- * ====================================================================== */
+/**
+ * @brief  : This Function is Used to Clear The Overrun & Mode Fault Flags & End The Interrupt Driven Transfer They Broke
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Status => Status Register Snapshot Taken on ISR Entry
+ * @note   : Private Function Used Inside SPI_HANDLE_IT
+ */
+static void SPI_AbortTransferIT(SPI_t SPINumber, uint16_t Status);
 
-#define SPI_BR_MASK 0xFFC7
+/**
+ * @brief  : This Function is Used to Exchange a Buffer of 8 Bit Frames by Polling The Status Register Directly ( Unchecked Fast Path )
+ *
+ * @param  : SPIx => Pointer to The SPI Peripheral Registers
+ * @param  : ReceivedBuffer => Pointer to The Receive Buffer or NULL to Discard Received Data
+ * @param  : BufferToSend => Pointer to The Transmit Buffer or NULL to Send Dummy Data
+ * @param  : BufferSize => Number of Frames to Be Exchanged
+ * @param  : CRCStatus => SPI_CRC_EN to Send CRC After The Last Frame & Receive The Peer CRC
+ * @return : ERRORS_t => SPI_OK , SPI_NOK on Overrun or TIME_OUT_ERROR IF The Bus Stalls or The Peer CRC Frame Was Not Received
+ * @note   : No Parameter Checking is Done , Caller Must Validate The Parameters , BufferSize Must Not be 0
+ */
+static inline ERRORS_t SPI_FastTransceive(SPI_RegDef_t *SPIx, uint8_t *ReceivedBuffer, uint8_t *BufferToSend, uint16_t BufferSize, SPI_CRC_STATUS_t CRCStatus);
 
-#define SPI_BUFFER_SIZE_NOT_REACHED 0x00
-#define SPI_BUFFER_SIZE_REACHED 0x01
+/**
+ * @brief  : This Function is Used to Exchange a Buffer of 16 Bit Frames by Polling The Status Register Directly ( Unchecked Fast Path )
+ *
+ * @param  : SPIx => Pointer to The SPI Peripheral Registers
+ * @param  : ReceivedBuffer => Pointer to The Receive Buffer or NULL to Discard Received Data
+ * @param  : BufferToSend => Pointer to The Transmit Buffer or NULL to Send Dummy Data
+ * @param  : BufferSize => Number of Frames to Be Exchanged
+ * @param  : CRCStatus => SPI_CRC_EN to Send CRC After The Last Frame & Receive The Peer CRC
+ * @return : ERRORS_t => SPI_OK , SPI_NOK on Overrun or TIME_OUT_ERROR IF The Bus Stalls or The Peer CRC Frame Was Not Received
+ * @note   : No Parameter Checking is Done , Caller Must Validate The Parameters , BufferSize Must Not be 0
+ */
+static inline ERRORS_t SPI_FastTransceive16(SPI_RegDef_t *SPIx, uint16_t *ReceivedBuffer, uint16_t *BufferToSend, uint16_t BufferSize, SPI_CRC_STATUS_t CRCStatus);
 
-/* ======================================================================
- * PRIVATE ENUMS
- * ====================================================================== */
+/**
+ * @brief  : This Function is Used to Start an Interrupt Driven Buffer Transfer After The Buffers Are Set in The Instance State
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : IRQSource => SPI_TRANSCEIVE_BUFFER_IRQ_SRC For 8 Bit Buffers or SPI_TRANSCEIVE_BUFFER16_IRQ_SRC For 16 Bit Buffers
+ * @param  : FirstFrame => First Frame to Be Loaded in DR
+ * @param  : BufferSize => Number of Frames to Be Exchanged
+ * @param  : pv_CallBackFunc => Call Back Function Invoked Once When The Last Frame is Received
+ */
+static void SPI_StartTransceiveIT(SPI_t SPINumber, SPI_IRQ_SRC_t IRQSource, uint16_t FirstFrame, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
 
 /**
- * @brief  : This Enum is Used to Specify The SPI Interrupts
+ * @brief  : This Function is Used to Configure The DMA RX & TX Streams of The SPI Peripheral & Start The Transfer
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => Pointer to The Receive Buffer or NULL to Discard Received Data
+ * @param  : BufferToSend => Pointer to The Transmit Buffer or NULL to Send Dummy Data
+ * @param  : BufferSize => Number of Frames to Be Exchanged
+ * @param  : pv_CallBackFunc => Call Back Function Invoked When RX Stream Completes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-typedef enum
-{
-    SPI_IT_TXE = 0x00,
-    SPI_IT_RXNE = 0x01,
-    SPI_IT_ERR = 0x02,
-    SPI_IT_MAX_NUM = 0x03
+static ERRORS_t SPI_StartDMA(SPI_Config_t *Config, void *ReceivedBuffer, void *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
 
-} SPI_IT_SRC_t;
+/**
+ * @brief  : This Function is Used to Handle The End of a DMA Transfer ( RX Stream Transfer Complete )
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @note   : This Function is Used Inside The DMA Call Back Handlers (Private Function)
+ */
+static void SPI_DMA_HANDLE_IT(SPI_t SPINumber);
 
 /**
- * @brief  : This Enum is Used to Specify The SPI Interrupt Sources
+ * @brief  : This Function is Used to Start The Next Pending Transaction in The Queue IF The SPI is Idle
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Context => SPI_QUEUE_THREAD_CONTEXT or SPI_QUEUE_ISR_CONTEXT
+ * @note   : Called From SPI_SubmitTransaction , SPI_QueueProcess & From The Completion Interrupts
  */
-typedef enum
-{
-    SPI_NO_IRQ_SRC = 0x00,
-    SPI_TRANSCEIVE_DATA_IRQ_SRC = 0x01,
-    SPI_TRANSCEIVE_BUFFER_IRQ_SRC = 0x02,
+static void SPI_QueueStartNext(SPI_t SPINumber, uint8_t Context);
 
-} SPI_IRQ_SRC_t;
+/**
+ * @brief  : This Function is Used to Finish The Active Queued Transaction & Start The Next One
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @note   : Called From The Completion Interrupts After The Transfer Call Back
+ */
+static void SPI_QueueTransactionDone(SPI_t SPINumber);
 
-typedef enum
-{
-    SPI_ROLE_TRANSMIT = 0x00,
-    SPI_ROLE_RECEIVE = 0x01,
-} SPI_ROLE_DIR_t;
+/**
+ * @brief  : This Function is Used to Write The Clock & Frame Settings of a Queued Device to CR1 IF They Differ From The Current Ones
+ *
+ * @param  : Config => SPI Configuration of The Device About to be Selected
+ */
+static void SPI_ApplyDeviceConfig(SPI_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Mask / Restore The Completion Interrupts of an SPI Peripheral While The Queue is Modified
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : LockState => Previous NVIC Enable State Returned by SPI_QueueLock
+ */
+static uint8_t SPI_QueueLock(SPI_t SPINumber);
+static void SPI_QueueUnlock(SPI_t SPINumber, uint8_t LockState);
+
+/**
+ * @brief  : This Function is Used to Get The Ring Buffer Write Index From The DMA RX Stream Counter
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : uint16_t => Index of Next Byte to Be Written by DMA
+ */
+static uint16_t SPI_GetRingWriteIndex(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to Get The Number of Bytes Written by DMA Into The Ring Since it Was Started
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : uint32_t => Laps Counted From The Half & Full Ring Interrupts Times The Ring Size Plus The Write Index ( Modulo 2^32 )
+ * @note   : A Full Ring Interrupt Still Pending When The Write Index Already Wrapped is Accounted For
+ */
+static uint32_t SPI_GetRingWriteCount(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to Count a Half or Full Ring Event & Invoke The Matching Application Call Back
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @note   : Called From The DMA RX Stream Half & Full Transfer Interrupts (Private Function)
+ */
+static void SPI_RingEvent(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to Reset The Hardware CRC Calculation Before a New Transfer
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @note   : CRC Registers Are Cleared by Rewriting CRCEN While The SPI is Disabled
+ */
+static void SPI_ResetCRC(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to Check & Clear The CRCERR Flag After The CRC Frame is Received
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : SPI_CRC_RESULT_t => SPI_CRC_PASS or SPI_CRC_FAIL
+ */
+static SPI_CRC_RESULT_t SPI_CheckCRC(SPI_t SPINumber);
 
+/* DMA RX Stream Transfer Complete Handlers Registered in DMA Driver */
+static void SPI1_DMA_RxComplete(void);
+static void SPI2_DMA_RxComplete(void);
+static void SPI3_DMA_RxComplete(void);
+static void SPI4_DMA_RxComplete(void);
 
+/* DMA RX Stream Half & Full Ring Handlers Registered in DMA Driver */
+static void SPI1_DMA_RingEvent(void);
+static void SPI2_DMA_RingEvent(void);
+static void SPI3_DMA_RingEvent(void);
+static void SPI4_DMA_RingEvent(void);
 
-#endif /* USART_PRIVATE_H_ */
\ No newline at end of file
+#endif /* SPI_PRIVATE_H_ */
\ No newline at end of file
@@ -22,7 +22,13 @@
 #include "../../../LIB/ErrType.h"
 #include "../../../LIB/STM32F446xx.h"
 
+#include "../../DMA/Inc/DMA_Interface.h"
+#include "../../GPIO/Inc/GPIO_Interface.h"
+#include "../../NVIC/Inc/NVIC_Interface.h"
+#include "../../SYSTICK/Inc/SYSTICK_Interface.h"
+
 #include "../Inc/SPI_Interface.h"
+#include "../Inc/SPI_Config.h"
 #include "../Inc/SPI_Private.h"
 
 /*==============================================================================================================================================
@@ -39,29 +45,46 @@ static SPI_RegDef_t *SPI[SPI_MAX_NUM] = {SPI1, SPI2 , SPI3 , SPI4};
 /* SPI Interrupt Pointers to Functions */
 static void (*SPI_PTR_TO_FUNC[SPI_MAX_NUM][SPI_IT_MAX_NUM])(void) = {NULL};
 
-/* SPI Transceive Data To Be Received To Use In ISR */
-static uint16_t *SPI_TransceiveDataToBeReceived[SPI_MAX_NUM] = {NULL};
+/* SPI Per Instance Asynchronous Transfer State To Use In ISR */
+/* Each SPI Peripheral Keeps Its Own Progress So All Instances Can Run Transfers Concurrently */
+static SPI_TransferState_t SPI_State[SPI_MAX_NUM] = {0};
+
+/* SPI Driver Statistics , Updated Only When SPI_STATISTICS is Enabled in SPI_Config.h */
+static SPI_Statistics_t SPI_Statistics[SPI_MAX_NUM] = {0};
+
+/* SPI DMA Request Mapping ( RM0390 DMA1 & DMA2 Request Mapping Tables ) , Streams Shared With USART & I2C Are Refused by DMA_Init While Enabled */
+static const SPI_DMA_MAP_t SPI_DMA_MAP[SPI_MAX_NUM] =
+	{
+		{DMA2_CONTROLLER, DMA_STREAM2, DMA_STREAM5, DMA_CHANNEL3}, /* SPI1 */
+		{DMA1_CONTROLLER, DMA_STREAM3, DMA_STREAM4, DMA_CHANNEL0}, /* SPI2 */
+		{DMA1_CONTROLLER, DMA_STREAM0, DMA_STREAM5, DMA_CHANNEL0}, /* SPI3 */
+		{DMA2_CONTROLLER, DMA_STREAM0, DMA_STREAM1, DMA_CHANNEL4}  /* SPI4 */
+};
 
-/* SPI Transceive Buffer To Be Received To Use In ISR */
-static uint8_t *SPI_TransceiveBufferToBeReceived[SPI_MAX_NUM] = {NULL};
+/* SPI DMA RX & TX Streams Configurations */
+static DMA_INIT_STRUCT_t SPI_DMA_RxConfig[SPI_MAX_NUM];
+static DMA_INIT_STRUCT_t SPI_DMA_TxConfig[SPI_MAX_NUM];
 
-/* SPI Transceive Buffer To Be Sent To Use In ISR */
-static uint8_t *SPI_TransceiveBufferToBeSent[SPI_MAX_NUM] = {NULL};
+/* SPI DMA Transfer Complete Call Back Functions */
+static void (*SPI_DMA_CallBack[SPI_MAX_NUM])(void) = {NULL};
 
-/* SPI Transceive Buffer Size To Use In ISR */
-static uint16_t SPI_TransceiveBufferSize[SPI_MAX_NUM] = {0};
+/* SPI DMA RX Streams Transfer Complete Handlers To Be Registered in DMA Driver */
+static void (*const SPI_DMA_RxCompleteHandler[SPI_MAX_NUM])(void) =
+	{
+		SPI1_DMA_RxComplete, SPI2_DMA_RxComplete, SPI3_DMA_RxComplete, SPI4_DMA_RxComplete};
 
-/* SPI Transceive Buffer Node Role To Check On In ISR */
-/* SPI_MASTER or SPI_SLAVE */
-static SPI_ROLE_t SPI_TransceiveBufferNodeRole[SPI_MAX_NUM] = {0};
+/* SPI DMA RX Streams Half & Full Ring Handlers To Be Registered in DMA Driver */
+static void (*const SPI_DMA_RingEventHandler[SPI_MAX_NUM])(void) =
+	{
+		SPI1_DMA_RingEvent, SPI2_DMA_RingEvent, SPI3_DMA_RingEvent, SPI4_DMA_RingEvent};
 
-/* SPI Transceive Buffer Role Direction To Check On In ISR */
-/* SPI_ROLE_TRANSMIT or SPI_ROLE_RECEIVE */
-static SPI_ROLE_DIR_t SPI_TransceiveBufferRoleDirection[SPI_MAX_NUM] = {0};
+/* SPI & DMA RX Stream IRQ Numbers Masked While The Transaction Queue is Modified */
+static const IRQNum_t SPI_IRQ_NUM[SPI_MAX_NUM] = {SPI1_IRQ, SPI2_IRQ, SPI3_IRQ, SPI4_IRQ};
+static const IRQNum_t SPI_DMA_RX_IRQ_NUM[SPI_MAX_NUM] = {DMA2_Stream2_IRQ, DMA1_Stream3_IRQ, DMA1_Stream0_IRQ, DMA2_Stream0_IRQ};
 
-/* SPI IRQ Sources To Use In ISR */
-/* SPI_NO_IRQ_SRC or SPI_TRANSCEIVE_DATA_IRQ_SRC or SPI_TRANSCEIVE_BUFFER_IRQ_SRC */
-static SPI_IRQ_SRC_t IRQ_SRC[SPI_MAX_NUM] = {SPI_NO_IRQ_SRC};
+/* SPI DMA Dummy Data Used When No Buffer To Send or To Receive is Passed */
+static uint16_t SPI_DMA_DummyTx = 0xFFFF;
+static uint16_t SPI_DMA_DummyRx = 0;
 
 /*==============================================================================================================================================
  * GLOBAL VARIABLES SECTION END
@@ -83,9 +106,18 @@ static SPI_IRQ_SRC_t IRQ_SRC[SPI_MAX_NUM] = {SPI_NO_IRQ_SRC};
 ERRORS_t SPI_Init(SPI_Config_t *Config)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+	uint32_t Local_u32Timeout = SPI_FLAG_TIMEOUT;
 
 	if (SPI_INVALID_CONFIG != SPI_CheckConfig(Config))
 	{
+		/* CRCPR , CRCEN & DFF Can Only be Changed While SPI is Disabled , Let a Frame Still Shifting Leave First ( Re Initialization ) */
+		while (((SPI[Config->SPINumber]->SR >> SPI_BUSY_FLAG) & 1) && Local_u32Timeout != 0)
+		{
+			Local_u32Timeout--;
+		}
+
+		/* Disable SPI Peripheral */
+		SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_SPE));
 
 		/* Set The BaudRate */
 		/* For Master Role Only */
@@ -114,6 +146,12 @@ ERRORS_t SPI_Init(SPI_Config_t *Config)
 		SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_CRCEN));
 		SPI[Config->SPINumber]->CR1 |= (Config->CRC_Status << SPI_CRCEN);
 
+		/* Set CRC Polynomial ( SPI is Disabled Above ) */
+		if (Config->CRC_Status == SPI_CRC_EN && Config->CRCPolynomial != 0)
+		{
+			SPI[Config->SPINumber]->CRCPR = Config->CRCPolynomial;
+		}
+
 		/* Set Slave Management */
 		/* For Slave Role Only */
 		if (Config->NodeRole == SPI_SLAVE)
@@ -143,6 +181,16 @@ ERRORS_t SPI_Init(SPI_Config_t *Config)
 
 		/* Enable SPI Peripheral */
 		SPI[Config->SPINumber]->CR1 |= (1 << SPI_SPE);
+
+		/* Configuration is Validated Once Here , Blocking Buffer Transfers Use The Unchecked Fast Path Afterwards */
+		SPI_State[Config->SPINumber].Prepared = SPI_PREPARED;
+		SPI_State[Config->SPINumber].DataWidth = Config->DataWidth;
+		SPI_State[Config->SPINumber].CRCStatus = Config->CRC_Status;
+		SPI_State[Config->SPINumber].CRCResult = SPI_CRC_NOT_CHECKED;
+
+		/* Default SPI_Transfer Strategy Thresholds */
+		SPI_State[Config->SPINumber].PollingMaxLength = SPI_POLLING_MAX_LENGTH;
+		SPI_State[Config->SPINumber].ITMaxLength = SPI_IT_MAX_LENGTH;
 	}
 	else
 	{
@@ -295,7 +343,7 @@ ERRORS_t SPI_EnableDMALine(SPI_t SPINum, SPI_DMA_LINE_t DMA_Line)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2)
+	if (SPINum >= SPI1_APB2 && SPINum <= SPI4_APB2)
 	{
 		switch (DMA_Line)
 		{
@@ -330,7 +378,7 @@ ERRORS_t SPI_DisableDMALine(SPI_t SPINum, SPI_DMA_LINE_t DMA_Line)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2)
+	if (SPINum >= SPI1_APB2 && SPINum <= SPI4_APB2)
 	{
 		switch (DMA_Line)
 		{
@@ -455,24 +503,114 @@ ERRORS_t SPI_TransceiveData(SPI_Config_t *Config, uint16_t *ReceivedData, uint16
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  * @note   : IF You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter ,
  *      IF You Want to Receive Data Only You Can Pass NULL to The BufferToSend Parameter
+ *      SPI Peripheral Must be Initialized Using SPI_Init With SPI_1BYTE Data Width , Parameters are Checked Once Per Call Not Per Byte
+ *      BufferSize Must Not be 0 , TIME_OUT_ERROR is Returned IF CRC is Enabled & The Peer CRC Frame is Not Received
+ *      SPI_NOK is Returned IF an Interrupt or DMA Transfer is Still in Progress on This SPI
  */
 ERRORS_t SPI_TransceiveBuffer(SPI_Config_t *Config, uint8_t *ReceviedBuffer, uint8_t *BufferToSend, uint16_t BufferSize)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	uint16_t Local_u16Counter = 0;
+	uint32_t Local_u32StartCycles = SPI_STATS_CYCLES();
 
-	if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2)
+	if (Config == NULL || (ReceviedBuffer == NULL && BufferToSend == NULL))
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2 ||
+			 SPI_State[Config->SPINumber].Prepared != SPI_PREPARED || SPI_State[Config->SPINumber].DataWidth != SPI_1BYTE ||
+			 BufferSize == 0)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_State[Config->SPINumber].IRQSource != SPI_NO_IRQ_SRC)
 	{
+		/* Another Asynchronous Transfer is in Progress on This SPI */
 		Local_u8ErrorStatus = SPI_NOK;
 	}
 	else
 	{
-		/* Correct Parameters */
+		/* Correct Parameters , Configuration Was Already Validated in SPI_Init */
+		if (SPI_State[Config->SPINumber].CRCStatus == SPI_CRC_EN)
+		{
+			SPI_ResetCRC(Config->SPINumber);
+		}
+
+		Local_u8ErrorStatus = SPI_FastTransceive(SPI[Config->SPINumber], ReceviedBuffer, BufferToSend, BufferSize, SPI_State[Config->SPINumber].CRCStatus);
+
+		SPI_STATS_ADD(Config->SPINumber, BlockingCycles, SPI_STATS_CYCLES() - Local_u32StartCycles);
+		SPI_STATS_ADD(Config->SPINumber, PollingTransfers, 1);
+		SPI_STATS_ADD(Config->SPINumber, Transfers, 1);
+		SPI_STATS_ADD(Config->SPINumber, Frames, BufferSize);
+
+		if (SPI_State[Config->SPINumber].CRCStatus == SPI_CRC_EN && Local_u8ErrorStatus == SPI_OK)
+		{
+			SPI_State[Config->SPINumber].CRCResult = SPI_CheckCRC(Config->SPINumber);
+
+			if (SPI_State[Config->SPINumber].CRCResult == SPI_CRC_FAIL)
+			{
+				Local_u8ErrorStatus = SPI_CRC_ERROR;
+			}
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames at The Same Time
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Frames
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Frames to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : SPI Peripheral Must be Initialized Using SPI_Init With SPI_2BYTE Data Width , One Frame is Moved Per DR Access
+ *           BufferSize Must Not be 0 , TIME_OUT_ERROR is Returned IF CRC is Enabled & The Peer CRC Frame is Not Received
+ *           SPI_NOK is Returned IF an Interrupt or DMA Transfer is Still in Progress on This SPI
+ */
+ERRORS_t SPI_TransceiveBuffer16(SPI_Config_t *Config, uint16_t *ReceivedBuffer, uint16_t *BufferToSend, uint16_t BufferSize)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	uint32_t Local_u32StartCycles = SPI_STATS_CYCLES();
+
+	if (Config == NULL || (ReceivedBuffer == NULL && BufferToSend == NULL))
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2 ||
+			 SPI_State[Config->SPINumber].Prepared != SPI_PREPARED || SPI_State[Config->SPINumber].DataWidth != SPI_2BYTE ||
+			 BufferSize == 0)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_State[Config->SPINumber].IRQSource != SPI_NO_IRQ_SRC)
+	{
+		/* Another Asynchronous Transfer is in Progress on This SPI */
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		/* Correct Parameters , Configuration Was Already Validated in SPI_Init */
+		if (SPI_State[Config->SPINumber].CRCStatus == SPI_CRC_EN)
+		{
+			SPI_ResetCRC(Config->SPINumber);
+		}
 
-		for (Local_u16Counter = 0; Local_u16Counter < BufferSize; Local_u16Counter++)
+		Local_u8ErrorStatus = SPI_FastTransceive16(SPI[Config->SPINumber], ReceivedBuffer, BufferToSend, BufferSize, SPI_State[Config->SPINumber].CRCStatus);
+
+		SPI_STATS_ADD(Config->SPINumber, BlockingCycles, SPI_STATS_CYCLES() - Local_u32StartCycles);
+		SPI_STATS_ADD(Config->SPINumber, PollingTransfers, 1);
+		SPI_STATS_ADD(Config->SPINumber, Transfers, 1);
+		SPI_STATS_ADD(Config->SPINumber, Frames, BufferSize);
+
+		if (SPI_State[Config->SPINumber].CRCStatus == SPI_CRC_EN && Local_u8ErrorStatus == SPI_OK)
 		{
-			SPI_TransceiveData(Config, (uint16_t *)&ReceviedBuffer[Local_u16Counter], (uint16_t *)&BufferToSend[Local_u16Counter]);
+			SPI_State[Config->SPINumber].CRCResult = SPI_CheckCRC(Config->SPINumber);
+
+			if (SPI_State[Config->SPINumber].CRCResult == SPI_CRC_FAIL)
+			{
+				Local_u8ErrorStatus = SPI_CRC_ERROR;
+			}
 		}
 	}
 	return Local_u8ErrorStatus;
@@ -504,7 +642,11 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
 			/* Correct Parameters */
 
 			/* Setting IRQ Source */
-			IRQ_SRC[Config->SPINumber] = SPI_TRANSCEIVE_DATA_IRQ_SRC;
+			SPI_State[Config->SPINumber].IRQSource = SPI_TRANSCEIVE_DATA_IRQ_SRC;
+
+			/* Set Received Data Globally ( NULL When Receiving is Not Required ) */
+			SPI_State[Config->SPINumber].DataToBeReceived = ReceivedData;
+			SPI_State[Config->SPINumber].TransferStatus = SPI_OK;
 
 			/* Receive Data is Required */
 			if (ReceivedData != NULL)
@@ -512,9 +654,6 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
 				/* Set The Call Back Function */
 				SPI_PTR_TO_FUNC[Config->SPINumber][SPI_IT_RXNE] = pv_CALL_BACK_FUNC;
 
-				/* Set Received Data Globally */
-				SPI_TransceiveDataToBeReceived[Config->SPINumber] = ReceivedData;
-
 				/* Check on The Node Role */
 				/* Master Can't Receive Data , So Send Any Value to Initiate Communication */
 				if (Config->NodeRole == SPI_MASTER)
@@ -568,349 +707,1732 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  * @note   : You Can Use This Function Directly without Enabling RXNE Interrupt in The Configuration Struct , as This Function Enables it Automatically
  *         if You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , IF You Want to Receive Data Only You Can NULL to The BufferToSend Parameter
+ *         Transfer is Full Duplex , Every RXNE Interrupt Stores The Received Item & Loads The Next Item to Be Sent in The Same ISR Pass
  */
 ERRORS_t SPI_TransceiveBuffer_IT(SPI_Config_t *Config, uint8_t *ReceivedBuffer, uint8_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2)
+	if (Config == NULL || (ReceivedBuffer == NULL && BufferToSend == NULL))
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2 || Config->DataWidth != SPI_1BYTE || BufferSize == 0)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_State[Config->SPINumber].IRQSource != SPI_NO_IRQ_SRC)
 	{
+		/* Another Asynchronous Transfer is in Progress on This SPI */
 		Local_u8ErrorStatus = SPI_NOK;
 	}
 	else
 	{
 		/* Correct Parameters */
-		/* Set IRQ Source */
-		IRQ_SRC[Config->SPINumber] = SPI_TRANSCEIVE_BUFFER_IRQ_SRC;
-
-		/* Set Buffer Size Globally */
-		SPI_TransceiveBufferSize[Config->SPINumber] = BufferSize;
-
-		/* Receive Buffer is Required */
-		if (NULL != ReceivedBuffer)
-		{
-			/* Set Call Back Function */
-			SPI_PTR_TO_FUNC[Config->SPINumber][SPI_IT_RXNE] = pv_CallBackFunc;
-
-			/* Set Direction Globally */
-			SPI_TransceiveBufferRoleDirection[Config->SPINumber] = SPI_ROLE_RECEIVE;
-
-			/* Set ReceivedBuffer Globally */
-			SPI_TransceiveBufferToBeReceived[Config->SPINumber] = ReceivedBuffer;
-
-			/* Check on The Node Role */
-			if (Config->NodeRole == SPI_SLAVE)
-			{
-				/* Set Role Globally */
-				SPI_TransceiveBufferNodeRole[Config->SPINumber] = SPI_SLAVE;
-
-				/* Enable Receive Buffer Not Empty Interrupt */
-				SPI[Config->SPINumber]->CR2 |= (1 << SPI_RXNEIE);
-			}
-			else if (Config->NodeRole == SPI_MASTER)
-			{
-				/* Set Role Globally */
-				SPI_TransceiveBufferNodeRole[Config->SPINumber] = SPI_MASTER;
-
-				/* Wait Until The Transmit Buffer is Empty */
-				SPI_WaitUntilFlagSet(Config->SPINumber, SPI_TRANSMIT_BUFFER_E_FLAG);
-
-				/* Send Any Value to Initiate Communication */
-				SPI[Config->SPINumber]->DR = 0xFF;
-
-				/* Enable Receive Buffer Not Empty Interrupt */
-				SPI[Config->SPINumber]->CR2 |= (1 << SPI_RXNEIE);
-			}
-		}
-
-		/* Sending Buffer is Required */
-		if (BufferToSend != NULL)
-		{
-			/* Set Call Back Function */
-			SPI_PTR_TO_FUNC[Config->SPINumber][SPI_IT_TXE] = pv_CallBackFunc;
-
-			/* Set Direction Globally */
-			SPI_TransceiveBufferRoleDirection[Config->SPINumber] = SPI_ROLE_TRANSMIT;
+		/* Set Buffers Globally */
+		SPI_State[Config->SPINumber].BufferToBeReceived = ReceivedBuffer;
+		SPI_State[Config->SPINumber].BufferToBeSent = BufferToSend;
 
-			/* Set Buffer To Send Globally */
-			SPI_TransceiveBufferToBeSent[Config->SPINumber] = BufferToSend;
-
-			/* wait Until The Transmit Buffer is Empty */
-			SPI_WaitUntilFlagSet(Config->SPINumber, SPI_TRANSMIT_BUFFER_E_FLAG);
-
-			/* Send First Data Item */
-			SPI[Config->SPINumber]->DR = SPI_TransceiveBufferToBeSent[Config->SPINumber][0];
-
-			/* Enable Transmit Buffer Not Interrupt */
-			SPI[Config->SPINumber]->CR2 |= (1 << SPI_TXEIE);
-		}
+		SPI_StartTransceiveIT(Config->SPINumber, SPI_TRANSCEIVE_BUFFER_IRQ_SRC, (BufferToSend != NULL) ? BufferToSend[0] : SPI_DUMMY_DATA, BufferSize, pv_CallBackFunc);
 	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Set The SPI Mode According to The Required Configuration in The Configuration Struct
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames Using Interrupts ( Non Blocking Function ) AKA Asynchronous
  *
  * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
- * @return : ERRORS_t   => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
- * @note   : Private Function Used Inside The SPI_Init Function
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Frames
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Frames to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Works With SPI_2BYTE Data Width Only , One Frame is Moved Per DR Access
+ *         if You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , IF You Want to Receive Data Only You Can NULL to The BufferToSend Parameter
  */
-static ERRORS_t SPI_SetMode(SPI_Config_t *Config)
+ERRORS_t SPI_TransceiveBuffer16_IT(SPI_Config_t *Config, uint16_t *ReceivedBuffer, uint16_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
-	if (Config != NULL)
+
+	if (Config == NULL || (ReceivedBuffer == NULL && BufferToSend == NULL))
 	{
-		switch (Config->Mode)
-		{
-		case SPI_FULL_DUPLEX:
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_RXONLY));
-			break;
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2 || Config->DataWidth != SPI_2BYTE || BufferSize == 0)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_State[Config->SPINumber].IRQSource != SPI_NO_IRQ_SRC)
+	{
+		/* Another Asynchronous Transfer is in Progress on This SPI */
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		/* Correct Parameters */
+		/* Set Buffers Globally */
+		SPI_State[Config->SPINumber].Buffer16ToBeReceived = ReceivedBuffer;
+		SPI_State[Config->SPINumber].Buffer16ToBeSent = BufferToSend;
 
-		case SPI_HALF_DUPLEX_TX:
-			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIMODE);
-			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIOE);
-			break;
+		SPI_StartTransceiveIT(Config->SPINumber, SPI_TRANSCEIVE_BUFFER16_IRQ_SRC, (BufferToSend != NULL) ? BufferToSend[0] : SPI_DUMMY_DATA, BufferSize, pv_CallBackFunc);
+	}
+	return Local_u8ErrorStatus;
+}
 
-		case SPI_HALF_DUPLEX_RX:
-			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIMODE);
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIOE));
-			break;
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of Data Using DMA ( Non Blocking Function ) AKA Asynchronous
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint8_t Array That Holds The Received Data
+ * @param  : BufferToSend => This is a Pointer to uint8_t Array That Holds The Data to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Size of The Buffer to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address , Invoked Once When The Whole Buffer is Exchanged
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : RX Stream is Always Started Even in Send Only Mode ( Into a Dummy Variable ) So That The Completion is Signaled After The Last Frame is Shifted Out
+ *           and No Overrun is Left Behind , Same For TX Stream in Receive Only Mode ( Dummy Data is Sent to Generate The Clock )
+ */
+ERRORS_t SPI_TransceiveBuffer_DMA(SPI_Config_t *Config, uint8_t *ReceivedBuffer, uint8_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-		case SPI_SIMPLEX_TX:
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_RXONLY));
-			break;
+	if (Config == NULL || (ReceivedBuffer == NULL && BufferToSend == NULL))
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2 || Config->DataWidth != SPI_1BYTE || BufferSize == 0)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_State[Config->SPINumber].IRQSource != SPI_NO_IRQ_SRC)
+	{
+		/* Another Asynchronous Transfer is in Progress on This SPI */
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		Local_u8ErrorStatus = SPI_StartDMA(Config, ReceivedBuffer, BufferToSend, BufferSize, pv_CallBackFunc);
+	}
+	return Local_u8ErrorStatus;
+}
 
-		case SPI_SIMPLEX_RX:
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
-			SPI[Config->SPINumber]->CR1 |= (1 << SPI_RXONLY);
-			break;
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames Using DMA ( Non Blocking Function ) AKA Asynchronous
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Frames
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Frames to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address , Invoked Once When The Whole Buffer is Exchanged
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Works With SPI_2BYTE Data Width Only , Both DMA Memory & Peripheral Sizes Are Set to Half Word
+ */
+ERRORS_t SPI_TransceiveBuffer16_DMA(SPI_Config_t *Config, uint16_t *ReceivedBuffer, uint16_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-		default:
-			Local_u8ErrorStatus = SPI_NOK;
-			break;
-		}
+	if (Config == NULL || (ReceivedBuffer == NULL && BufferToSend == NULL))
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2 || Config->DataWidth != SPI_2BYTE || BufferSize == 0)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_State[Config->SPINumber].IRQSource != SPI_NO_IRQ_SRC)
+	{
+		/* Another Asynchronous Transfer is in Progress on This SPI */
+		Local_u8ErrorStatus = SPI_NOK;
 	}
 	else
 	{
-		Local_u8ErrorStatus = NULL_POINTER;
+		Local_u8ErrorStatus = SPI_StartDMA(Config, ReceivedBuffer, BufferToSend, BufferSize, pv_CallBackFunc);
 	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Check on SPI Configuration Structure Before Passing it to The SPI_Init Function
+ * @brief  : This Function is Used to Add a Transaction to The Transaction Queue of its SPI Peripheral
  *
- * @param  : Configuration => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
- * @return : ERRORS_t     => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @param  : Transaction => This is a Pointer to Struct of Type SPI_Transaction_t That Describes The Transaction -> @SPI_Transaction_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : IF The SPI is Idle The Transaction Starts Immediately , Otherwise it Starts From The Completion Interrupt of The Previous One
  */
-static ERRORS_t SPI_CheckConfig(SPI_Config_t *Configuration)
+ERRORS_t SPI_SubmitTransaction(SPI_Transaction_t *Transaction)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (Configuration->SPINumber < SPI1_APB2 || Configuration->SPINumber > SPI4_APB2 ||
-			Configuration->BaudRate < SPI_PERIPH_CLK_BY2 || Configuration->BaudRate > SPI_PERIPH_CLK_BY256 ||
-			Configuration->ClockPhase < SPI_CAPTURE_LEADING || Configuration->ClockPhase > SPI_CAPTURE_TRAILING ||
-			Configuration->ClockPolarity < SPI_CLK_IDLE_LOW || Configuration->ClockPolarity > SPI_CLK_IDLE_HIGH ||
-			Configuration->DataWidth < SPI_1BYTE || Configuration->DataWidth > SPI_2BYTE ||
-			Configuration->Direction < SPI_MSB_FIRST || Configuration->Direction > SPI_LSB_FIRST ||
-			Configuration->CRC_Status < SPI_CRC_DIS || Configuration->CRC_Status > SPI_CRC_EN ||
-			Configuration->Mode < SPI_FULL_DUPLEX || Configuration->Mode > SPI_SIMPLEX_RX ||
-			Configuration->NodeRole < SPI_SLAVE || Configuration->NodeRole > SPI_MASTER ||
-			Configuration->SlaveManage < SPI_HW_SLAVE_MANAGE || Configuration->SlaveManage > SPI_SW_SLAVE_MANAGE ||
-			Configuration->SlaveSelectOutputType < SPI_SS_OUT_DIS || Configuration->SlaveSelectOutputType > SPI_SS_OUT_EN ||
-			Configuration->InterruptEnable.RXNE < SPI_IT_DIS || Configuration->InterruptEnable.RXNE > SPI_IT_EN ||
-			Configuration->InterruptEnable.TXE < SPI_IT_DIS || Configuration->InterruptEnable.TXE > SPI_IT_EN ||
-			Configuration->InterruptEnable.ERR < SPI_IT_DIS || Configuration->InterruptEnable.ERR > SPI_IT_EN)
+	SPI_TransferState_t *Local_pState = NULL;
+
+	uint8_t Local_u8LockState = 0;
+
+	if (Transaction == NULL || Transaction->Device == NULL || Transaction->Device->Config == NULL ||
+		(Transaction->ReceivedBuffer == NULL && Transaction->BufferToSend == NULL))
 	{
-		Local_u8ErrorStatus = SPI_INVALID_CONFIG;
+		Local_u8ErrorStatus = NULL_POINTER;
 	}
+	else if (Transaction->Device->Config->SPINumber < SPI1_APB2 || Transaction->Device->Config->SPINumber > SPI4_APB2 ||
+			 Transaction->Device->Engine < SPI_QUEUE_ENGINE_IT || Transaction->Device->Engine > SPI_QUEUE_ENGINE_DMA ||
+			 Transaction->BufferSize == 0 || Transaction->Device->Config->NodeRole != SPI_MASTER ||
+			 SPI_CheckConfig(Transaction->Device->Config) == SPI_INVALID_CONFIG ||
+			 SPI_State[Transaction->Device->Config->SPINumber].Prepared != SPI_PREPARED)
+	{
+		/* Device Clock & Frame Settings Are Written to CR1 Before Each of its Transactions , So They Must be Valid */
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		Local_pState = &SPI_State[Transaction->Device->Config->SPINumber];
+
+		Local_u8LockState = SPI_QueueLock(Transaction->Device->Config->SPINumber);
+
+		if (Local_pState->QueueCount == SPI_QUEUE_SIZE)
+		{
+			/* Queue is Full */
+			Local_u8ErrorStatus = SPI_NOK;
+		}
+		else
+		{
+			Local_pState->Queue[Local_pState->QueueTail] = Transaction;
+			Local_pState->QueueTail = (Local_pState->QueueTail + 1) % SPI_QUEUE_SIZE;
+			Local_pState->QueueCount++;
+		}
+
+		SPI_QueueUnlock(Transaction->Device->Config->SPINumber, Local_u8LockState);
 
+		/* Start Immediately IF The Bus is Idle , Outside The Lock So The Pre Delay Doesn't Mask Interrupts */
+		if (Local_u8ErrorStatus == SPI_OK)
+		{
+			SPI_QueueStartNext(Transaction->Device->Config->SPINumber, SPI_QUEUE_THREAD_CONTEXT);
+		}
+	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Handle The SPI Interrupts
+ * @brief  : This Function is Used to Finish The Delayed Steps of The Transaction Queue of an SPI Peripheral in Thread Context
  *
- * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
- * @note   : This Function is Used Inside The SPI Interrupt Handlers (Private Function)
+ * @note   : Waits The PostDelayUs of a Finished Transaction , Deasserts its CS & Invokes its Call Back , Then Starts The Next Pending
+ *           Transaction With its PreDelayUs , Call it From The Main Loop When Any Device Uses Nonzero Delays ( Never From an Interrupt )
  */
-static ERRORS_t SPI_HANDLE_IT(SPI_t SPINumber)
+ERRORS_t SPI_QueueProcess(SPI_t SPINum)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+	SPI_TransferState_t *Local_pState = NULL;
+	SPI_Transaction_t *Local_pTransaction = NULL;
+	uint8_t Local_u8LockState = 0;
 
-	if (SPINumber < SPI1_APB2 || SPINumber > SPI4_APB2)
+	if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2)
 	{
 		Local_u8ErrorStatus = SPI_NOK;
 	}
 	else
 	{
-		/* Correct Parameter */
+		Local_pState = &SPI_State[SPINum];
+
+		Local_u8LockState = SPI_QueueLock(SPINum);
 
-		/* IF The IRQ Source is Transceive Data */
-		if (IRQ_SRC[SPINumber] == SPI_TRANSCEIVE_DATA_IRQ_SRC)
+		if (Local_pState->ReleasePending == 1)
 		{
-			/* Clear IRQ Source */
-			IRQ_SRC[SPINumber] = SPI_NO_IRQ_SRC;
+			Local_pTransaction = Local_pState->ActiveTransaction;
+			Local_pState->ReleasePending = 0;
+		}
 
-			/* Reading is Required Only */
-			/* Read the Received Data */
-			if (SPI_TransceiveDataToBeReceived[SPINumber] != NULL)
-			{
-				*SPI_TransceiveDataToBeReceived[SPINumber] = SPI[SPINumber]->DR;
-			}
-			/* If Receiving Or Transmitting is Required
+		SPI_QueueUnlock(SPINum, Local_u8LockState);
 
-			/* Disable  Rx Buffer Not Empty Interrupt */
-			SPI[SPINumber]->CR2 &= (~(1 << SPI_RXNEIE));
+		if (Local_pTransaction != NULL)
+		{
+			SYSTICK_Delayus(Local_pTransaction->Device->PostDelayUs);
 
-			/* Disable  Tx Buffer Not Empty Interrupt */
-			SPI[SPINumber]->CR2 &= (~(1 << SPI_TXEIE));
+			/* Deassert Chip Select */
+			GPIO_u8SetPinValue(Local_pTransaction->Device->CSPort, Local_pTransaction->Device->CSPin, PIN_HIGH);
 
-			/* Invoke Call Back Function */
-			if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE] != NULL)
-			{
-				SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE]();
-			}
-			else if( SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE] != NULL )
+			Local_pState->ActiveTransaction = NULL;
+		}
+
+		/* Pending Transactions Left by The Completion Interrupt ( Pre Delay or Bus Held by a Post Delay ) */
+		SPI_QueueStartNext(SPINum, SPI_QUEUE_THREAD_CONTEXT);
+
+		if (Local_pTransaction != NULL && Local_pTransaction->pv_CallBackFunc != NULL)
+		{
+			Local_pTransaction->pv_CallBackFunc();
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer Choosing Polling , Interrupts or DMA Automatically According to its Length
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => Pointer to uint8_t ( SPI_1BYTE ) or uint16_t ( SPI_2BYTE ) Array That Holds The Received Data or NULL
+ * @param  : BufferToSend => Pointer to uint8_t ( SPI_1BYTE ) or uint16_t ( SPI_2BYTE ) Array That Holds The Data to Be Sent or NULL
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => Invoked When The Transfer is Done ( Before Returning IF Polling is Selected ) , Can be NULL
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_Transfer(SPI_Config_t *Config, void *ReceivedBuffer, void *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (Config == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2 || SPI_State[Config->SPINumber].Prepared != SPI_PREPARED)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (BufferSize <= SPI_State[Config->SPINumber].PollingMaxLength)
+	{
+		/* Short Transfer , Polling Has The Lowest Latency */
+		if (Config->DataWidth == SPI_2BYTE)
+		{
+			Local_u8ErrorStatus = SPI_TransceiveBuffer16(Config, (uint16_t *)ReceivedBuffer, (uint16_t *)BufferToSend, BufferSize);
+		}
+		else
+		{
+			Local_u8ErrorStatus = SPI_TransceiveBuffer(Config, (uint8_t *)ReceivedBuffer, (uint8_t *)BufferToSend, BufferSize);
+		}
+
+		if ((Local_u8ErrorStatus == SPI_OK || Local_u8ErrorStatus == SPI_CRC_ERROR) && pv_CallBackFunc != NULL)
+		{
+			pv_CallBackFunc();
+		}
+	}
+	else if (BufferSize <= SPI_State[Config->SPINumber].ITMaxLength)
+	{
+		/* Medium Transfer , Interrupts Avoid The DMA Setup Cost */
+		if (Config->DataWidth == SPI_2BYTE)
+		{
+			Local_u8ErrorStatus = SPI_TransceiveBuffer16_IT(Config, (uint16_t *)ReceivedBuffer, (uint16_t *)BufferToSend, BufferSize, pv_CallBackFunc);
+		}
+		else
+		{
+			Local_u8ErrorStatus = SPI_TransceiveBuffer_IT(Config, (uint8_t *)ReceivedBuffer, (uint8_t *)BufferToSend, BufferSize, pv_CallBackFunc);
+		}
+	}
+	else
+	{
+		/* Long Transfer , DMA Moves The Frames Without CPU Load */
+		if (Config->DataWidth == SPI_2BYTE)
+		{
+			Local_u8ErrorStatus = SPI_TransceiveBuffer16_DMA(Config, (uint16_t *)ReceivedBuffer, (uint16_t *)BufferToSend, BufferSize, pv_CallBackFunc);
+		}
+		else
+		{
+			Local_u8ErrorStatus = SPI_TransceiveBuffer_DMA(Config, (uint8_t *)ReceivedBuffer, (uint8_t *)BufferToSend, BufferSize, pv_CallBackFunc);
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Tune The Length Thresholds Used by SPI_Transfer For One SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : PollingMaxLength => Transfers of This Length or Shorter Use Polling
+ * @param  : ITMaxLength => Longer Transfers Up to This Length Use Interrupts , Longer Ones Use DMA
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_SetTransferThresholds(SPI_t SPINum, uint16_t PollingMaxLength, uint16_t ITMaxLength)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2 || ITMaxLength < PollingMaxLength)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		SPI_State[SPINum].PollingMaxLength = PollingMaxLength;
+		SPI_State[SPINum].ITMaxLength = ITMaxLength;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Read The Driver Statistics of an SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Statistics => This is a Pointer to Struct of Type SPI_Statistics_t That Holds The Copied Statistics
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_GetStatistics(SPI_t SPINum, SPI_Statistics_t *Statistics)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (Statistics == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		*Statistics = SPI_Statistics[SPINum];
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Clear The Driver Statistics of an SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_ResetStatistics(SPI_t SPINum)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	SPI_Statistics_t Local_EmptyStatistics = {0};
+
+	if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		SPI_Statistics[SPINum] = Local_EmptyStatistics;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Read The Hardware CRC Check Result of The Last Buffer Transfer on an SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Result => This is a Pointer to Variable That Holds The CRC Result -> @SPI_CRC_RESULT_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_GetCRCResult(SPI_t SPINum, SPI_CRC_RESULT_t *Result)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (Result == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		*Result = SPI_State[SPINum].CRCResult;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Read The Result of The Last Interrupt or DMA Transfer on an SPI Peripheral
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Status => This is a Pointer to Variable That Holds The Transfer Result , SPI_OK or SPI_NOK IF an Overrun or Mode Fault Ended it
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Call it From The Call Back Function , The CRC Check Result is Read Separately Using SPI_GetCRCResult
+ */
+ERRORS_t SPI_GetTransferStatus(SPI_t SPINum, ERRORS_t *Status)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (Status == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		*Status = SPI_State[SPINum].TransferStatus;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start a Continuous Slave Receive Into a Ring Buffer Using Circular DMA
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : RingBuffer => This is a Pointer to uint8_t Array Used as The Ring Buffer
+ * @param  : RingSize => This is a Variable of Type uint16_t That Holds The Size of The Ring Buffer
+ * @param  : pv_HalfCallBackFunc => Invoked When The First Half of The Ring is Filled ( Can be NULL )
+ * @param  : pv_FullCallBackFunc => Invoked When The Second Half of The Ring is Filled ( Can be NULL )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Half & Full Ring Interrupts Are Always Enabled , They Count The DMA Laps Used to Detect an Overrun of The Reader
+ *           The DMA RX Stream IRQ Must be Enabled in The NVIC
+ */
+ERRORS_t SPI_StartRingReceive_DMA(SPI_Config_t *Config, uint8_t *RingBuffer, uint16_t RingSize, void (*pv_HalfCallBackFunc)(void), void (*pv_FullCallBackFunc)(void))
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	DMA_INIT_STRUCT_t *Local_pRxConfig = NULL;
+
+	if (Config == NULL || RingBuffer == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI4_APB2 || Config->NodeRole != SPI_SLAVE ||
+			 Config->DataWidth != SPI_1BYTE || RingSize < 2)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_State[Config->SPINumber].IRQSource != SPI_NO_IRQ_SRC)
+	{
+		/* Another Asynchronous Transfer is in Progress on This SPI */
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		Local_pRxConfig = &SPI_DMA_RxConfig[Config->SPINumber];
+
+		SPI_State[Config->SPINumber].IRQSource = SPI_RING_RECEIVE_DMA_SRC;
+		SPI_State[Config->SPINumber].RingBuffer = RingBuffer;
+		SPI_State[Config->SPINumber].RingSize = RingSize;
+		SPI_State[Config->SPINumber].RingReadIndex = 0;
+		SPI_State[Config->SPINumber].RingReadCount = 0;
+		SPI_State[Config->SPINumber].RingEvents = 0;
+		SPI_State[Config->SPINumber].RingHalfCallBack = pv_HalfCallBackFunc;
+		SPI_State[Config->SPINumber].RingFullCallBack = pv_FullCallBackFunc;
+
+		/* RX Stream in Circular Mode , Half & Full Transfer Interrupts Count The Laps & Invoke The Application Call Backs */
+		Local_pRxConfig->DMAController = SPI_DMA_MAP[Config->SPINumber].DMAController;
+		Local_pRxConfig->StreamNumber = SPI_DMA_MAP[Config->SPINumber].RxStream;
+		Local_pRxConfig->ChannelNumber = SPI_DMA_MAP[Config->SPINumber].ChannelNumber;
+		Local_pRxConfig->PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER;
+		Local_pRxConfig->MemBurst = DMA_MEM_SINGLE_TRANSFER;
+		Local_pRxConfig->Priority = DMA_VERY_HIGH_PRIORITY;
+		Local_pRxConfig->MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS;
+		Local_pRxConfig->PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS;
+		Local_pRxConfig->MemInc = DMA_MINC_ENABLE;
+		Local_pRxConfig->PeriphInc = DMA_PINC_DISABLE;
+		Local_pRxConfig->Mode = DMA_CIRCULAR;
+		Local_pRxConfig->DoubleBuffer = DMA_DOUBLE_BUFFER_DIS;
+		Local_pRxConfig->Direction = DMA_PERIPH_TO_MEM;
+		Local_pRxConfig->EnableIT.FIFOErrorIT = DMA_INT_DISABLE;
+		Local_pRxConfig->EnableIT.DirectModeErrorIT = DMA_INT_DISABLE;
+		Local_pRxConfig->EnableIT.TransferErrorIT = DMA_INT_DISABLE;
+		Local_pRxConfig->EnableIT.HalfTransferIT = DMA_INT_ENABLE;
+		Local_pRxConfig->EnableIT.TransferCompleteIT = DMA_INT_ENABLE;
+		Local_pRxConfig->FIFOMode = DMA_FIFOMODE_DISABLE;
+		Local_pRxConfig->FIFOThreshold = DMA_FIFO_THRESHOLD_HALF_FULL;
+
+		if (DMA_OK != DMA_Init(Local_pRxConfig))
+		{
+			SPI_State[Config->SPINumber].IRQSource = SPI_NO_IRQ_SRC;
+			Local_u8ErrorStatus = SPI_NOK;
+		}
+		else
+		{
+			DMA_SetCallBack(Local_pRxConfig, DMA_HALF_TRANSFER_CALLBACK, SPI_DMA_RingEventHandler[Config->SPINumber]);
+			DMA_SetCallBack(Local_pRxConfig, DMA_TRANSFER_CMP_CALLBACK, SPI_DMA_RingEventHandler[Config->SPINumber]);
+
+			/* Clear Flags Left From Previous Transfers Before Enabling The Stream */
+			DMA_ClearInterruptFlag(Local_pRxConfig->DMAController, Local_pRxConfig->StreamNumber, TRANSFER_COMPLETE_IT_FLAG);
+			DMA_ClearInterruptFlag(Local_pRxConfig->DMAController, Local_pRxConfig->StreamNumber, HALF_TRANSFER_IT_FLAG);
+
+			SPI_State[Config->SPINumber].TransferStatus = SPI_OK;
+
+			DMA_StartTransfer(Local_pRxConfig, (uint32_t *)&(SPI[Config->SPINumber]->DR), (uint32_t *)RingBuffer, RingSize);
+
+			/* Enable RX DMA Request */
+			SPI[Config->SPINumber]->CR2 |= (1 << SPI_RXDMAEN);
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stop The Continuous Ring Buffer Receive
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_StopRingReceive_DMA(SPI_t SPINum)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2 || SPI_State[SPINum].IRQSource != SPI_RING_RECEIVE_DMA_SRC)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		/* Disable RX DMA Request & Stream */
+		SPI[SPINum]->CR2 &= (~(1 << SPI_RXDMAEN));
+
+		DMA_DisableStream(SPI_DMA_MAP[SPINum].DMAController, SPI_DMA_MAP[SPINum].RxStream);
+
+		SPI_State[SPINum].IRQSource = SPI_NO_IRQ_SRC;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Number of Received Bytes Not Read Yet From The Ring Buffer
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Available => This is a Pointer to Variable That Holds The Number of Available Bytes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ *           SPI_RING_OVERRUN IF DMA Overwrote Unread Bytes , They Are Dropped & Reading Resumes From The Newest Byte
+ */
+ERRORS_t SPI_GetRingAvailable(SPI_t SPINum, uint16_t *Available)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	uint32_t Local_u32Unread = 0;
+
+	if (Available == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (SPINum < SPI1_APB2 || SPINum > SPI4_APB2 || SPI_State[SPINum].IRQSource != SPI_RING_RECEIVE_DMA_SRC)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		Local_u32Unread = SPI_GetRingWriteCount(SPINum) - SPI_State[SPINum].RingReadCount;
+
+		if (Local_u32Unread > SPI_State[SPINum].RingSize)
+		{
+			/* DMA Lapped The Reader , Unread Bytes Were Overwritten , Drop Them & Resume From The Write Position */
+			SPI_State[SPINum].RingReadCount += Local_u32Unread;
+			SPI_State[SPINum].RingReadIndex = (uint16_t)(SPI_State[SPINum].RingReadCount % SPI_State[SPINum].RingSize);
+
+			*Available = 0;
+			Local_u8ErrorStatus = SPI_RING_OVERRUN;
+		}
+		else
+		{
+			*Available = (uint16_t)Local_u32Unread;
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Copy Received Bytes Out of The Ring Buffer & Advance The Read Pointer
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Data => This is a Pointer to uint8_t Array That Holds The Copied Data
+ * @param  : Length => This is a Variable of Type uint16_t That Holds The Maximum Number of Bytes to Copy
+ * @param  : ReadLength => This is a Pointer to Variable That Holds The Number of Bytes Actually Copied
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ *           SPI_RING_OVERRUN IF DMA Overwrote Unread Bytes Before ( Nothing Copied ) or While They Were Copied ( Copied Data Not Valid )
+ */
+ERRORS_t SPI_ReadRing(SPI_t SPINum, uint8_t *Data, uint16_t Length, uint16_t *ReadLength)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	uint16_t Local_u16Available = 0;
+	uint16_t Local_u16Counter = 0;
+	uint32_t Local_u32StartCount = 0;
+
+	if (Data == NULL || ReadLength == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else
+	{
+		Local_u8ErrorStatus = SPI_GetRingAvailable(SPINum, &Local_u16Available);
+
+		if (Local_u8ErrorStatus != SPI_OK)
+		{
+			/* Ring Not Running ( SPI_NOK ) or SPI_RING_OVERRUN , Nothing is Copied */
+			*ReadLength = 0;
+		}
+		else
+		{
+			Local_u32StartCount = SPI_State[SPINum].RingReadCount;
+
+			if (Length > Local_u16Available)
+			{
+				Length = Local_u16Available;
+			}
+
+			for (Local_u16Counter = 0; Local_u16Counter < Length; Local_u16Counter++)
+			{
+				Data[Local_u16Counter] = SPI_State[SPINum].RingBuffer[SPI_State[SPINum].RingReadIndex];
+
+				SPI_State[SPINum].RingReadIndex++;
+				if (SPI_State[SPINum].RingReadIndex == SPI_State[SPINum].RingSize)
+				{
+					SPI_State[SPINum].RingReadIndex = 0;
+				}
+			}
+			SPI_State[SPINum].RingReadCount += Length;
+
+			*ReadLength = Length;
+
+			/* DMA May Have Reached The Copied Bytes While They Were Being Copied */
+			if ((SPI_GetRingWriteCount(SPINum) - Local_u32StartCount) > SPI_State[SPINum].RingSize)
+			{
+				Local_u8ErrorStatus = SPI_RING_OVERRUN;
+			}
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set The SPI Mode According to The Required Configuration in The Configuration Struct
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @return : ERRORS_t   => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Private Function Used Inside The SPI_Init Function
+ */
+static ERRORS_t SPI_SetMode(SPI_Config_t *Config)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+	if (Config != NULL)
+	{
+		switch (Config->Mode)
+		{
+		case SPI_FULL_DUPLEX:
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_RXONLY));
+			break;
+
+		case SPI_HALF_DUPLEX_TX:
+			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIMODE);
+			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIOE);
+			break;
+
+		case SPI_HALF_DUPLEX_RX:
+			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIMODE);
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIOE));
+			break;
+
+		case SPI_SIMPLEX_TX:
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_RXONLY));
+			break;
+
+		case SPI_SIMPLEX_RX:
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
+			SPI[Config->SPINumber]->CR1 |= (1 << SPI_RXONLY);
+			break;
+
+		default:
+			Local_u8ErrorStatus = SPI_NOK;
+			break;
+		}
+	}
+	else
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Check on SPI Configuration Structure Before Passing it to The SPI_Init Function
+ *
+ * @param  : Configuration => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @return : ERRORS_t     => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPI_CheckConfig(SPI_Config_t *Configuration)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (Configuration->SPINumber < SPI1_APB2 || Configuration->SPINumber > SPI4_APB2 ||
+			Configuration->BaudRate < SPI_PERIPH_CLK_BY2 || Configuration->BaudRate > SPI_PERIPH_CLK_BY256 ||
+			Configuration->ClockPhase < SPI_CAPTURE_LEADING || Configuration->ClockPhase > SPI_CAPTURE_TRAILING ||
+			Configuration->ClockPolarity < SPI_CLK_IDLE_LOW || Configuration->ClockPolarity > SPI_CLK_IDLE_HIGH ||
+			Configuration->DataWidth < SPI_1BYTE || Configuration->DataWidth > SPI_2BYTE ||
+			Configuration->Direction < SPI_MSB_FIRST || Configuration->Direction > SPI_LSB_FIRST ||
+			Configuration->CRC_Status < SPI_CRC_DIS || Configuration->CRC_Status > SPI_CRC_EN ||
+			Configuration->Mode < SPI_FULL_DUPLEX || Configuration->Mode > SPI_SIMPLEX_RX ||
+			Configuration->NodeRole < SPI_SLAVE || Configuration->NodeRole > SPI_MASTER ||
+			Configuration->SlaveManage < SPI_HW_SLAVE_MANAGE || Configuration->SlaveManage > SPI_SW_SLAVE_MANAGE ||
+			Configuration->SlaveSelectOutputType < SPI_SS_OUT_DIS || Configuration->SlaveSelectOutputType > SPI_SS_OUT_EN ||
+			Configuration->InterruptEnable.RXNE < SPI_IT_DIS || Configuration->InterruptEnable.RXNE > SPI_IT_EN ||
+			Configuration->InterruptEnable.TXE < SPI_IT_DIS || Configuration->InterruptEnable.TXE > SPI_IT_EN ||
+			Configuration->InterruptEnable.ERR < SPI_IT_DIS || Configuration->InterruptEnable.ERR > SPI_IT_EN)
+	{
+		Local_u8ErrorStatus = SPI_INVALID_CONFIG;
+	}
+
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Handle The SPI Interrupts
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : This Function is Used Inside The SPI Interrupt Handlers (Private Function)
+ */
+static ERRORS_t SPI_HANDLE_IT(SPI_t SPINumber)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (SPINumber < SPI1_APB2 || SPINumber > SPI4_APB2)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		/* Correct Parameter */
+		SPI_STATS_ADD(SPINumber, ISREntries, 1);
+
+		/* Status is Read Once , Every Decision Below is Taken on This Snapshot */
+		uint16_t Local_u16Status = SPI[SPINumber]->SR;
+
+		if (((Local_u16Status >> SPI_OVERRUN_FLAG) & 1) || ((Local_u16Status >> SPI_MODE_FAULT_FLAG) & 1))
+		{
+			/* Overrun or Mode Fault , Frames Were Lost or Another Master Took The Bus , The Running Transfer Can't be Completed */
+			SPI_AbortTransferIT(SPINumber, Local_u16Status);
+		}
+		/* IF The IRQ Source is Transceive Data , Completed by RXNE When Receiving or by TXE When Sending Only */
+		else if (SPI_State[SPINumber].IRQSource == SPI_TRANSCEIVE_DATA_IRQ_SRC &&
+				 (((Local_u16Status >> SPI_RECEIVE_BUFFER_NE_FLAG) & 1) ||
+				  (((Local_u16Status >> SPI_TRANSMIT_BUFFER_E_FLAG) & 1) && !((SPI[SPINumber]->CR2 >> SPI_RXNEIE) & 1))))
+		{
+			/* Clear IRQ Source */
+			SPI_State[SPINumber].IRQSource = SPI_NO_IRQ_SRC;
+
+			/* Reading is Required Only */
+			/* Read the Received Data */
+			if (SPI_State[SPINumber].DataToBeReceived != NULL && ((Local_u16Status >> SPI_RECEIVE_BUFFER_NE_FLAG) & 1))
+			{
+				*SPI_State[SPINumber].DataToBeReceived = SPI[SPINumber]->DR;
+			}
+			/* If Receiving Or Transmitting is Required
+
+			/* Disable  Rx Buffer Not Empty Interrupt */
+			SPI[SPINumber]->CR2 &= (~(1 << SPI_RXNEIE));
+
+			/* Disable  Tx Buffer Not Empty Interrupt */
+			SPI[SPINumber]->CR2 &= (~(1 << SPI_TXEIE));
+
+			/* Invoke Call Back Function */
+			if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE] != NULL)
+			{
+				SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE]();
+			}
+			else if( SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE] != NULL )
 			{
 				SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE]() ;
 			}
 		}
 
-		/* IF The IRQ Source is Transceive Buffer */
-		if (IRQ_SRC[SPINumber] == SPI_TRANSCEIVE_BUFFER_IRQ_SRC)
+		/* IF The IRQ Source is Transceive Buffer ( 8 Bit or 16 Bit Frames ) , Each Received Frame Moves The Transfer One Step */
+		else if ((SPI_State[SPINumber].IRQSource == SPI_TRANSCEIVE_BUFFER_IRQ_SRC || SPI_State[SPINumber].IRQSource == SPI_TRANSCEIVE_BUFFER16_IRQ_SRC) &&
+				 ((Local_u16Status >> SPI_RECEIVE_BUFFER_NE_FLAG) & 1))
+		{
+			/* Transfer Progress of This SPI Instance */
+			SPI_TransferState_t *Local_pState = &SPI_State[SPINumber];
+
+			/* Read The Received Item , Clears RXNE */
+			uint16_t Local_u16ReceivedData = SPI[SPINumber]->DR;
+
+			if (Local_pState->ReceiveCounter >= Local_pState->BufferSize)
+			{
+				/* This is The CRC Frame , Not Stored */
+			}
+			else if (Local_pState->IRQSource == SPI_TRANSCEIVE_BUFFER16_IRQ_SRC)
+			{
+				if (Local_pState->Buffer16ToBeReceived != NULL)
+				{
+					Local_pState->Buffer16ToBeReceived[Local_pState->ReceiveCounter] = Local_u16ReceivedData;
+				}
+			}
+			else if (Local_pState->BufferToBeReceived != NULL)
+			{
+				Local_pState->BufferToBeReceived[Local_pState->ReceiveCounter] = (uint8_t)Local_u16ReceivedData;
+			}
+			Local_pState->ReceiveCounter++;
+
+			if (Local_pState->ReceiveCounter < Local_pState->BufferSize)
+			{
+				/* Load Next Item in The Same ISR Pass */
+				if (Local_pState->IRQSource == SPI_TRANSCEIVE_BUFFER16_IRQ_SRC)
+				{
+					SPI[SPINumber]->DR = (Local_pState->Buffer16ToBeSent != NULL) ? Local_pState->Buffer16ToBeSent[Local_pState->TransmitCounter] : SPI_DUMMY_DATA;
+				}
+				else
+				{
+					SPI[SPINumber]->DR = (Local_pState->BufferToBeSent != NULL) ? Local_pState->BufferToBeSent[Local_pState->TransmitCounter] : SPI_DUMMY_DATA;
+				}
+				Local_pState->TransmitCounter++;
+
+				/* CRC is Sent Right After The Last Frame */
+				if (Local_pState->TransmitCounter == Local_pState->BufferSize && Local_pState->CRCStatus == SPI_CRC_EN)
+				{
+					SPI[SPINumber]->CR1 |= (1 << SPI_CRCNEXT);
+				}
+			}
+			else if (Local_pState->ReceiveCounter == Local_pState->BufferSize && Local_pState->CRCStatus == SPI_CRC_EN)
+			{
+				/* Last Data Frame Received , Wait For The CRC Frame */
+			}
+			else
+			{
+				/* Buffer Size is Reached , Disable Rx Buffer Not Empty Interrupt & Invoke Call Back Function */
+				SPI[SPINumber]->CR2 &= (~(1 << SPI_RXNEIE));
+
+				if (Local_pState->CRCStatus == SPI_CRC_EN)
+				{
+					Local_pState->CRCResult = SPI_CheckCRC(SPINumber);
+				}
+
+				/* Clear IRQ Source */
+				Local_pState->IRQSource = SPI_NO_IRQ_SRC;
+
+				/* Invoke Call Back Function */
+				if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE] != NULL)
+				{
+					SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE]();
+				}
+
+				/* Finish Queued Transaction ( IF Any ) & Start The Next Pending One */
+				SPI_QueueTransactionDone(SPINumber);
+			}
+		}
+		else
+		{
+			/* No Event For The Current Operation ( e.g. Left Over Enable Bits ) , Nothing is Read or Counted */
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+
+/**
+ * @brief  : This Function is Used to Clear The Overrun & Mode Fault Flags & End The Interrupt Driven Transfer They Broke
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Status => Status Register Snapshot Taken on ISR Entry
+ * @note   : Private Function , The Transfer is Completed With SPI_NOK ( Read it Using SPI_GetTransferStatus ) & The Queue Moves On
+ *           DMA & Ring Transfers Only Get Their Status Updated , Their Streams Are Left to Their Own Completion Handling
+ */
+static void SPI_AbortTransferIT(SPI_t SPINumber, uint16_t Status)
+{
+	SPI_IRQ_SRC_t Local_IRQSource = SPI_State[SPINumber].IRQSource;
+
+	if ((Status >> SPI_OVERRUN_FLAG) & 1)
+	{
+		/* OVR is Cleared by Reading DR Then SR */
+		(void)SPI[SPINumber]->DR;
+		(void)SPI[SPINumber]->SR;
+	}
+
+	if ((Status >> SPI_MODE_FAULT_FLAG) & 1)
+	{
+		/* MODF is Cleared by Writing CR1 After Reading SR , Hardware Also Cleared MSTR & SPE ( Only a Master Can Fault ) */
+		SPI[SPINumber]->CR1 |= ((1 << SPI_MSTR) | (1 << SPI_SPE));
+	}
+
+	SPI_State[SPINumber].TransferStatus = SPI_NOK;
+
+	if (Local_IRQSource == SPI_TRANSCEIVE_DATA_IRQ_SRC || Local_IRQSource == SPI_TRANSCEIVE_BUFFER_IRQ_SRC || Local_IRQSource == SPI_TRANSCEIVE_BUFFER16_IRQ_SRC)
+	{
+		SPI[SPINumber]->CR2 &= (~((1 << SPI_RXNEIE) | (1 << SPI_TXEIE)));
+
+		/* Release The SPI */
+		SPI_State[SPINumber].IRQSource = SPI_NO_IRQ_SRC;
+
+		if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE] != NULL)
+		{
+			SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE]();
+		}
+		else if (Local_IRQSource == SPI_TRANSCEIVE_DATA_IRQ_SRC && SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE] != NULL)
+		{
+			SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE]();
+		}
+
+		if (Local_IRQSource != SPI_TRANSCEIVE_DATA_IRQ_SRC)
+		{
+			/* Finish Queued Transaction ( IF Any ) & Start The Next Pending One */
+			SPI_QueueTransactionDone(SPINumber);
+		}
+	}
+}
+
+
+/**
+ * @brief  : This Function is Used to Exchange a Buffer of 8 Bit Frames by Polling The Status Register Directly ( Unchecked Fast Path )
+ *
+ * @param  : SPIx => Pointer to The SPI Peripheral Registers
+ * @param  : ReceivedBuffer => Pointer to The Receive Buffer or NULL to Discard Received Data
+ * @param  : BufferToSend => Pointer to The Transmit Buffer or NULL to Send Dummy Data
+ * @param  : BufferSize => Number of Frames to Be Exchanged
+ * @param  : CRCStatus => SPI_CRC_EN to Send CRC After The Last Frame & Receive The Peer CRC
+ * @return : ERRORS_t => SPI_OK , SPI_NOK on Overrun or TIME_OUT_ERROR IF The Bus Stalls or The Peer CRC Frame Was Not Received
+ * @note   : Private Function , No Parameter Checking is Done Here , BufferSize Must Not be 0
+ *           Next Frame is Written as Soon as TX Buffer is Empty While The Previous One is Still Shifting ( At Most 2 Frames in Flight )
+ *           So The Bus is Kept Busy Back to Back , an Interrupt Longer Than One Frame Time Can Then Overrun The Receiver , Which is Reported
+ */
+static inline ERRORS_t SPI_FastTransceive(SPI_RegDef_t *SPIx, uint8_t *ReceivedBuffer, uint8_t *BufferToSend, uint16_t BufferSize, SPI_CRC_STATUS_t CRCStatus)
+{
+	uint16_t Local_u16TxCounter = 0;
+	uint16_t Local_u16RxCounter = 0;
+	uint8_t Local_u8ReceivedData = 0;
+	uint32_t Local_u32Timeout = SPI_FLAG_TIMEOUT;
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	while (Local_u16RxCounter < BufferSize && Local_u8ErrorStatus == SPI_OK)
+	{
+		/* Status is Read Once Per Pass */
+		uint16_t Local_u16Status = SPIx->SR;
+
+		if ((Local_u16Status >> SPI_OVERRUN_FLAG) & 1)
+		{
+			/* A Received Frame Was Lost , Clear OVR ( Read DR Then SR ) & Stop */
+			(void)SPIx->DR;
+			(void)SPIx->SR;
+			Local_u8ErrorStatus = SPI_NOK;
+		}
+		else
+		{
+			/* Load Next Frame IF TX Buffer is Empty & No More Than 2 Frames Are in Flight */
+			if ((Local_u16TxCounter < BufferSize) && ((Local_u16TxCounter - Local_u16RxCounter) < 2) && ((Local_u16Status >> SPI_TRANSMIT_BUFFER_E_FLAG) & 1))
+			{
+				SPIx->DR = (BufferToSend != NULL) ? BufferToSend[Local_u16TxCounter] : SPI_DUMMY_DATA;
+				Local_u16TxCounter++;
+
+				/* CRC is Sent Right After The Last Frame */
+				if (Local_u16TxCounter == BufferSize && CRCStatus == SPI_CRC_EN)
+				{
+					SPIx->CR1 |= (1 << SPI_CRCNEXT);
+				}
+			}
+
+			/* Store Received Frame */
+			if ((Local_u16Status >> SPI_RECEIVE_BUFFER_NE_FLAG) & 1)
+			{
+				Local_u8ReceivedData = (uint8_t)SPIx->DR;
+
+				if (ReceivedBuffer != NULL)
+				{
+					ReceivedBuffer[Local_u16RxCounter] = Local_u8ReceivedData;
+				}
+				Local_u16RxCounter++;
+
+				/* Progress Was Made , Restart The Stall Deadline */
+				Local_u32Timeout = SPI_FLAG_TIMEOUT;
+			}
+			else if (--Local_u32Timeout == 0)
+			{
+				/* Bus Stopped Moving ( e.g. SPI Disabled by a Mode Fault ) */
+				Local_u8ErrorStatus = TIME_OUT_ERROR;
+			}
+		}
+	}
+
+	/* Read The CRC Frame Sent by The Other Node , CRCERR is Updated After it is Received */
+	if (CRCStatus == SPI_CRC_EN && Local_u8ErrorStatus == SPI_OK)
+	{
+		Local_u32Timeout = SPI_FLAG_TIMEOUT;
+
+		while (!((SPIx->SR >> SPI_RECEIVE_BUFFER_NE_FLAG) & 1) && Local_u32Timeout != 0)
+		{
+			Local_u32Timeout--;
+		}
+
+		if (Local_u32Timeout == 0)
+		{
+			/* CRC Frame Never Arrived */
+			Local_u8ErrorStatus = TIME_OUT_ERROR;
+		}
+		else
+		{
+			Local_u8ReceivedData = (uint8_t)SPIx->DR;
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Exchange a Buffer of 16 Bit Frames by Polling The Status Register Directly ( Unchecked Fast Path )
+ *
+ * @param  : SPIx => Pointer to The SPI Peripheral Registers
+ * @param  : ReceivedBuffer => Pointer to The Receive Buffer or NULL to Discard Received Data
+ * @param  : BufferToSend => Pointer to The Transmit Buffer or NULL to Send Dummy Data
+ * @param  : BufferSize => Number of Frames to Be Exchanged
+ * @param  : CRCStatus => SPI_CRC_EN to Send CRC After The Last Frame & Receive The Peer CRC
+ * @return : ERRORS_t => SPI_OK , SPI_NOK on Overrun or TIME_OUT_ERROR IF The Bus Stalls or The Peer CRC Frame Was Not Received
+ * @note   : Private Function , No Parameter Checking is Done Here , BufferSize Must Not be 0 , Same Pipelining as SPI_FastTransceive
+ */
+static inline ERRORS_t SPI_FastTransceive16(SPI_RegDef_t *SPIx, uint16_t *ReceivedBuffer, uint16_t *BufferToSend, uint16_t BufferSize, SPI_CRC_STATUS_t CRCStatus)
+{
+	uint16_t Local_u16TxCounter = 0;
+	uint16_t Local_u16RxCounter = 0;
+	uint16_t Local_u16ReceivedData = 0;
+	uint32_t Local_u32Timeout = SPI_FLAG_TIMEOUT;
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	while (Local_u16RxCounter < BufferSize && Local_u8ErrorStatus == SPI_OK)
+	{
+		/* Status is Read Once Per Pass */
+		uint16_t Local_u16Status = SPIx->SR;
+
+		if ((Local_u16Status >> SPI_OVERRUN_FLAG) & 1)
+		{
+			/* A Received Frame Was Lost , Clear OVR ( Read DR Then SR ) & Stop */
+			(void)SPIx->DR;
+			(void)SPIx->SR;
+			Local_u8ErrorStatus = SPI_NOK;
+		}
+		else
+		{
+			/* Load Next Frame IF TX Buffer is Empty & No More Than 2 Frames Are in Flight */
+			if ((Local_u16TxCounter < BufferSize) && ((Local_u16TxCounter - Local_u16RxCounter) < 2) && ((Local_u16Status >> SPI_TRANSMIT_BUFFER_E_FLAG) & 1))
+			{
+				SPIx->DR = (BufferToSend != NULL) ? BufferToSend[Local_u16TxCounter] : SPI_DUMMY_DATA;
+				Local_u16TxCounter++;
+
+				/* CRC is Sent Right After The Last Frame */
+				if (Local_u16TxCounter == BufferSize && CRCStatus == SPI_CRC_EN)
+				{
+					SPIx->CR1 |= (1 << SPI_CRCNEXT);
+				}
+			}
+
+			/* Store Received Frame */
+			if ((Local_u16Status >> SPI_RECEIVE_BUFFER_NE_FLAG) & 1)
+			{
+				Local_u16ReceivedData = SPIx->DR;
+
+				if (ReceivedBuffer != NULL)
+				{
+					ReceivedBuffer[Local_u16RxCounter] = Local_u16ReceivedData;
+				}
+				Local_u16RxCounter++;
+
+				/* Progress Was Made , Restart The Stall Deadline */
+				Local_u32Timeout = SPI_FLAG_TIMEOUT;
+			}
+			else if (--Local_u32Timeout == 0)
+			{
+				/* Bus Stopped Moving ( e.g. SPI Disabled by a Mode Fault ) */
+				Local_u8ErrorStatus = TIME_OUT_ERROR;
+			}
+		}
+	}
+
+	/* Read The CRC Frame Sent by The Other Node , CRCERR is Updated After it is Received */
+	if (CRCStatus == SPI_CRC_EN && Local_u8ErrorStatus == SPI_OK)
+	{
+		Local_u32Timeout = SPI_FLAG_TIMEOUT;
+
+		while (!((SPIx->SR >> SPI_RECEIVE_BUFFER_NE_FLAG) & 1) && Local_u32Timeout != 0)
+		{
+			Local_u32Timeout--;
+		}
+
+		if (Local_u32Timeout == 0)
+		{
+			/* CRC Frame Never Arrived */
+			Local_u8ErrorStatus = TIME_OUT_ERROR;
+		}
+		else
+		{
+			Local_u16ReceivedData = SPIx->DR;
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start an Interrupt Driven Buffer Transfer After The Buffers Are Set in The Instance State
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : IRQSource => SPI_TRANSCEIVE_BUFFER_IRQ_SRC For 8 Bit Buffers or SPI_TRANSCEIVE_BUFFER16_IRQ_SRC For 16 Bit Buffers
+ * @param  : FirstFrame => First Frame to Be Loaded in DR
+ * @param  : BufferSize => Number of Frames to Be Exchanged
+ * @param  : pv_CallBackFunc => Call Back Function Invoked Once When The Last Frame is Received
+ * @note   : Private Function , No Parameter Checking is Done Here
+ */
+static void SPI_StartTransceiveIT(SPI_t SPINumber, SPI_IRQ_SRC_t IRQSource, uint16_t FirstFrame, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
+{
+	uint32_t Local_u32StartCycles = SPI_STATS_CYCLES();
+
+	/* Set IRQ Source */
+	SPI_State[SPINumber].IRQSource = IRQSource;
+
+	/* Set Buffer Size Globally */
+	SPI_State[SPINumber].BufferSize = BufferSize;
+
+	/* Reset Transfer Progress of This Instance , First TX Item is Written Here So TX Counter Starts From 1 */
+	SPI_State[SPINumber].TransmitCounter = 1;
+	SPI_State[SPINumber].ReceiveCounter = 0;
+
+	/* Set Call Back Function , Invoked Once When The Last Item is Received */
+	SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE] = pv_CallBackFunc;
+
+	SPI_State[SPINumber].CRCResult = SPI_CRC_NOT_CHECKED;
+	SPI_State[SPINumber].TransferStatus = SPI_OK;
+
+	/* No Transfer Owns The SPI Here ( Callers Check IRQSource ) , So The Transmit Buffer is Already Empty & Nothing is Waited For */
+
+	if (SPI_State[SPINumber].CRCStatus == SPI_CRC_EN)
+	{
+		SPI_ResetCRC(SPINumber);
+	}
+
+	/* Load First Data Item , Dummy Data is Sent IF Receiving Only */
+	SPI[SPINumber]->DR = FirstFrame;
+
+	/* CRC is Sent Right After The Last Frame */
+	if (BufferSize == 1 && SPI_State[SPINumber].CRCStatus == SPI_CRC_EN)
+	{
+		SPI[SPINumber]->CR1 |= (1 << SPI_CRCNEXT);
+	}
+
+	/* Enable Receive Buffer Not Empty Interrupt , Each RXNE Stores The Received Item & Loads The Next One , Mode Fault Ends The Transfer */
+	SPI[SPINumber]->CR2 |= ((1 << SPI_RXNEIE) | (1 << SPI_ERRIE));
+
+	SPI_STATS_ADD(SPINumber, SetupCycles, SPI_STATS_CYCLES() - Local_u32StartCycles);
+	SPI_STATS_ADD(SPINumber, ITTransfers, 1);
+	SPI_STATS_ADD(SPINumber, Transfers, 1);
+	SPI_STATS_ADD(SPINumber, Frames, BufferSize);
+}
+
+/**
+ * @brief  : This Function is Used to Configure The DMA RX & TX Streams of The SPI Peripheral & Start The Transfer
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => Pointer to The Receive Buffer or NULL to Discard Received Data
+ * @param  : BufferToSend => Pointer to The Transmit Buffer or NULL to Send Dummy Data
+ * @param  : BufferSize => Number of Frames to Be Exchanged
+ * @param  : pv_CallBackFunc => Call Back Function Invoked When RX Stream Completes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Private Function , Frame Size ( 8 or 16 Bits ) is Taken From Config->DataWidth
+ */
+static ERRORS_t SPI_StartDMA(SPI_Config_t *Config, void *ReceivedBuffer, void *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	uint32_t Local_u32StartCycles = SPI_STATS_CYCLES();
+
+	SPI_t Local_SPINumber = Config->SPINumber;
+	DMA_INIT_STRUCT_t *Local_pRxConfig = &SPI_DMA_RxConfig[Local_SPINumber];
+	DMA_INIT_STRUCT_t *Local_pTxConfig = &SPI_DMA_TxConfig[Local_SPINumber];
+
+	/* Mark SPI as Busy */
+	SPI_State[Local_SPINumber].IRQSource = SPI_TRANSCEIVE_BUFFER_DMA_SRC;
+
+	SPI_DMA_CallBack[Local_SPINumber] = pv_CallBackFunc;
+
+	/* Common Streams Configurations */
+	Local_pRxConfig->DMAController = SPI_DMA_MAP[Local_SPINumber].DMAController;
+	Local_pRxConfig->ChannelNumber = SPI_DMA_MAP[Local_SPINumber].ChannelNumber;
+	Local_pRxConfig->PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER;
+	Local_pRxConfig->MemBurst = DMA_MEM_SINGLE_TRANSFER;
+	Local_pRxConfig->MemDataWidth = (Config->DataWidth == SPI_2BYTE) ? DMA_MEM_DATA_WIDTH_16BITS : DMA_MEM_DATA_WIDTH_8BITS;
+	Local_pRxConfig->PeriphDataWidth = (Config->DataWidth == SPI_2BYTE) ? DMA_PERIPH_DATA_WIDTH_16BITS : DMA_PERIPH_DATA_WIDTH_8BITS;
+	Local_pRxConfig->PeriphInc = DMA_PINC_DISABLE;
+	Local_pRxConfig->Mode = DMA_NORMAL;
+	Local_pRxConfig->DoubleBuffer = DMA_DOUBLE_BUFFER_DIS;
+	Local_pRxConfig->EnableIT.FIFOErrorIT = DMA_INT_DISABLE;
+	Local_pRxConfig->EnableIT.DirectModeErrorIT = DMA_INT_DISABLE;
+	Local_pRxConfig->EnableIT.TransferErrorIT = DMA_INT_DISABLE;
+	Local_pRxConfig->EnableIT.HalfTransferIT = DMA_INT_DISABLE;
+	Local_pRxConfig->FIFOMode = DMA_FIFOMODE_DISABLE;
+	Local_pRxConfig->FIFOThreshold = DMA_FIFO_THRESHOLD_HALF_FULL;
+	*Local_pTxConfig = *Local_pRxConfig;
+
+	/* RX Stream Configurations , Higher Priority Than TX to Avoid Overrun */
+	Local_pRxConfig->StreamNumber = SPI_DMA_MAP[Local_SPINumber].RxStream;
+	Local_pRxConfig->Priority = DMA_VERY_HIGH_PRIORITY;
+	Local_pRxConfig->MemInc = (ReceivedBuffer != NULL) ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+	Local_pRxConfig->Direction = DMA_PERIPH_TO_MEM;
+	Local_pRxConfig->EnableIT.TransferCompleteIT = DMA_INT_ENABLE;
+
+	/* TX Stream Configurations */
+	Local_pTxConfig->StreamNumber = SPI_DMA_MAP[Local_SPINumber].TxStream;
+	Local_pTxConfig->Priority = DMA_HIGH_PRIORITY;
+	Local_pTxConfig->MemInc = (BufferToSend != NULL) ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+	Local_pTxConfig->Direction = DMA_MEM_TO_PERIPH;
+	Local_pTxConfig->EnableIT.TransferCompleteIT = DMA_INT_DISABLE;
+
+	if (ReceivedBuffer == NULL)
+	{
+		ReceivedBuffer = &SPI_DMA_DummyRx;
+	}
+	if (BufferToSend == NULL)
+	{
+		BufferToSend = &SPI_DMA_DummyTx;
+	}
+
+	if (DMA_OK != DMA_Init(Local_pRxConfig) || DMA_OK != DMA_Init(Local_pTxConfig))
+	{
+		SPI_State[Local_SPINumber].IRQSource = SPI_NO_IRQ_SRC;
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		DMA_SetCallBack(Local_pRxConfig, DMA_TRANSFER_CMP_CALLBACK, SPI_DMA_RxCompleteHandler[Local_SPINumber]);
+
+		/* Clear Flags Left From Previous Transfers Before Enabling The Streams */
+		DMA_ClearInterruptFlag(Local_pRxConfig->DMAController, Local_pRxConfig->StreamNumber, TRANSFER_COMPLETE_IT_FLAG);
+		DMA_ClearInterruptFlag(Local_pRxConfig->DMAController, Local_pRxConfig->StreamNumber, HALF_TRANSFER_IT_FLAG);
+		DMA_ClearInterruptFlag(Local_pTxConfig->DMAController, Local_pTxConfig->StreamNumber, TRANSFER_COMPLETE_IT_FLAG);
+		DMA_ClearInterruptFlag(Local_pTxConfig->DMAController, Local_pTxConfig->StreamNumber, HALF_TRANSFER_IT_FLAG);
+
+		/* CRC Frame is Sent & Received Automatically by Hardware at The End of DMA Transfers */
+		SPI_State[Local_SPINumber].CRCResult = SPI_CRC_NOT_CHECKED;
+		SPI_State[Local_SPINumber].TransferStatus = SPI_OK;
+
+		if (SPI_State[Local_SPINumber].CRCStatus == SPI_CRC_EN)
+		{
+			SPI_ResetCRC(Local_SPINumber);
+		}
+
+		/* Enable RX DMA Request First , Then Start Both Streams , Then Enable TX DMA Request ( RM0390 SPI DMA Procedure ) */
+		SPI[Local_SPINumber]->CR2 |= (1 << SPI_RXDMAEN);
+
+		DMA_StartTransfer(Local_pRxConfig, (uint32_t *)&(SPI[Local_SPINumber]->DR), (uint32_t *)ReceivedBuffer, BufferSize);
+		DMA_StartTransfer(Local_pTxConfig, (uint32_t *)BufferToSend, (uint32_t *)&(SPI[Local_SPINumber]->DR), BufferSize);
+
+		SPI[Local_SPINumber]->CR2 |= (1 << SPI_TXDMAEN);
+
+		SPI_STATS_ADD(Local_SPINumber, SetupCycles, SPI_STATS_CYCLES() - Local_u32StartCycles);
+		SPI_STATS_ADD(Local_SPINumber, DMATransfers, 1);
+		SPI_STATS_ADD(Local_SPINumber, Transfers, 1);
+		SPI_STATS_ADD(Local_SPINumber, Frames, BufferSize);
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Handle The End of a DMA Transfer ( RX Stream Transfer Complete )
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @note   : Private Function Called From The DMA RX Stream Transfer Complete Call Back
+ */
+static void SPI_DMA_HANDLE_IT(SPI_t SPINumber)
+{
+	uint32_t Local_u32Timeout = SPI_FLAG_TIMEOUT;
+
+	SPI_STATS_ADD(SPINumber, ISREntries, 1);
+
+	/* Disable DMA Requests */
+	SPI[SPINumber]->CR2 &= (~((1 << SPI_TXDMAEN) | (1 << SPI_RXDMAEN)));
+
+	/* RX Stream Only Counts Data Frames , Read The CRC Frame That Follows Them */
+	if (SPI_State[SPINumber].CRCStatus == SPI_CRC_EN)
+	{
+		while (!((SPI[SPINumber]->SR >> SPI_RECEIVE_BUFFER_NE_FLAG) & 1) && Local_u32Timeout != 0)
+		{
+			Local_u32Timeout--;
+		}
+
+		if (Local_u32Timeout == 0)
+		{
+			/* CRC Frame Never Arrived , Received Data Can't be Trusted */
+			SPI_State[SPINumber].CRCResult = SPI_CRC_FAIL;
+		}
+		else
 		{
-			/* Variable to Indicate if The Buffer Size is Reached or Not */
-			static uint8_t BufferSizeReached = SPI_BUFFER_SIZE_NOT_REACHED;
+			(void)SPI[SPINumber]->DR;
 
-			/* Counter to Indicate The Number of Data Sent or Received For Slave Role */
-			static uint16_t TransmitCounterSlave = 1;
-			static uint16_t ReceiveCounterSlave = 0;
+			SPI_State[SPINumber].CRCResult = SPI_CheckCRC(SPINumber);
+		}
+	}
 
-			/* Counter to Indicate The Number of Data Sent or Received For Master Role */
-			static uint16_t TransmitCounterMaster = 1;
-			static uint16_t ReceiveCounterMaster = 0;
+	/* Release The SPI */
+	SPI_State[SPINumber].IRQSource = SPI_NO_IRQ_SRC;
 
-			switch (SPI_TransceiveBufferNodeRole[SPINumber])
-			{
-			case SPI_SLAVE:
+	if (SPI_DMA_CallBack[SPINumber] != NULL)
+	{
+		SPI_DMA_CallBack[SPINumber]();
+	}
 
-				/* Slave is Transmitter */
-				if (SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_TRANSMIT)
-				{
+	/* Finish Queued Transaction ( IF Any ) & Start The Next Pending One */
+	SPI_QueueTransactionDone(SPINumber);
+}
 
-					/* if Buffer Size is Reached */
-					if (TransmitCounterSlave == SPI_TransceiveBufferSize[SPINumber])
-					{
-						BufferSizeReached = SPI_BUFFER_SIZE_REACHED;
-						/* Reset Counter */
-						TransmitCounterSlave = 1;
-
-					}
-					else
-					{
-						/* Send Next Data */
-						SPI[SPINumber]->DR = SPI_TransceiveBufferToBeSent[SPINumber][TransmitCounterSlave++];
-					}
-				}
-				/* Slave is Receiver */
-				else if (SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_RECEIVE)
-				{
+/**
+ * @brief  : This Function is Used to Start The Next Pending Transaction in The Queue IF The SPI is Idle
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Context => SPI_QUEUE_THREAD_CONTEXT From SPI_SubmitTransaction or SPI_QUEUE_ISR_CONTEXT From The Completion Interrupts
+ * @note   : Private Function , The Device Pre Delay is a Busy Wait , So in ISR Context a Transaction With a Pre Delay is Left Pending
+ *           For SPI_QueueProcess , A Transaction That Can't be Started is Completed With SPI_NOK & The Next One is Tried
+ */
+static void SPI_QueueStartNext(SPI_t SPINumber, uint8_t Context)
+{
+	SPI_TransferState_t *Local_pState = &SPI_State[SPINumber];
+	SPI_Transaction_t *Local_pTransaction = NULL;
+	SPI_Device_t *Local_pDevice = NULL;
+	ERRORS_t Local_u8StartStatus = SPI_OK;
+	uint8_t Local_u8LockState = 0;
+
+	do
+	{
+		Local_pTransaction = NULL;
+		Local_u8StartStatus = SPI_OK;
 
-					/* Receive the Data */
-					SPI_TransceiveBufferToBeReceived[SPINumber][ReceiveCounterSlave++] = SPI[SPINumber]->DR;
+		/* Claim The Next Transaction Only IF No Transfer is on The Bus & a Transaction is Pending */
+		Local_u8LockState = SPI_QueueLock(SPINumber);
 
-					/* if Buffer Size is Reached */
-					if (ReceiveCounterSlave == SPI_TransceiveBufferSize[SPINumber])
-					{
-						BufferSizeReached = SPI_BUFFER_SIZE_REACHED;
-						/* Reset Counter */
-						ReceiveCounterSlave = 0;
-					}
-				}
+		if (Local_pState->IRQSource == SPI_NO_IRQ_SRC && Local_pState->ActiveTransaction == NULL && Local_pState->QueueCount != 0 &&
+			(Context == SPI_QUEUE_THREAD_CONTEXT || Local_pState->Queue[Local_pState->QueueHead]->Device->PreDelayUs == 0))
+		{
+			Local_pTransaction = Local_pState->Queue[Local_pState->QueueHead];
+			Local_pState->QueueHead = (Local_pState->QueueHead + 1) % SPI_QUEUE_SIZE;
+			Local_pState->QueueCount--;
+			Local_pState->ActiveTransaction = Local_pTransaction;
+		}
 
-				break;
+		SPI_QueueUnlock(SPINumber, Local_u8LockState);
 
-			case SPI_MASTER:
+		if (Local_pTransaction != NULL)
+		{
+			Local_pDevice = Local_pTransaction->Device;
 
-				/* Master is Transmitter */
-				if (SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_TRANSMIT)
-				{
-					if (TransmitCounterMaster == SPI_TransceiveBufferSize[SPINumber])
-					{
-						BufferSizeReached = SPI_BUFFER_SIZE_REACHED;
-						/* Reset Counter */
-						TransmitCounterMaster = 1;
-					}
-					else
-					{
-						/* Send Next Data */
-						SPI[SPINumber]->DR = SPI_TransceiveBufferToBeSent[SPINumber][TransmitCounterMaster++];
-					}
-				}
-				/* Master is Receiver */
-				else if (SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_RECEIVE)
-				{
+			/* Clock & Frame Settings of This Device Are Applied Before CS is Asserted */
+			SPI_ApplyDeviceConfig(Local_pDevice->Config);
 
-					/* Receive the Data */
-					SPI_TransceiveBufferToBeReceived[SPINumber][ReceiveCounterMaster++] = SPI[SPINumber]->DR;
-
-					if (ReceiveCounterMaster == SPI_TransceiveBufferSize[SPINumber])
-					{
-						BufferSizeReached = SPI_BUFFER_SIZE_REACHED;
-						/* Reset Counter */
-						ReceiveCounterMaster = 0;
-					}
-					else
-					{
-						/* Send Any Value to Initiate Communication */
-						SPI[SPINumber]->DR = 0xFF;
-					}
-				}
-				break;
+			/* Assert Chip Select */
+			GPIO_u8SetPinValue(Local_pDevice->CSPort, Local_pDevice->CSPin, PIN_LOW);
+
+			/* Only Claimed in Thread Context When a Pre Delay is Needed */
+			if (Local_pDevice->PreDelayUs != 0)
+			{
+				SYSTICK_Delayus(Local_pDevice->PreDelayUs);
+			}
+
+			if (Local_pDevice->Engine == SPI_QUEUE_ENGINE_DMA)
+			{
+				Local_u8StartStatus = SPI_StartDMA(Local_pDevice->Config, Local_pTransaction->ReceivedBuffer, Local_pTransaction->BufferToSend, Local_pTransaction->BufferSize, NULL);
 			}
-			/* If Buffer Size is Reached  , Disable Rx Buffer Not Empty Interrupt & Invoke Call Back Function */
-			if (BufferSizeReached == SPI_BUFFER_SIZE_REACHED)
+			else if (Local_pDevice->Config->DataWidth == SPI_2BYTE)
 			{
+				Local_pState->Buffer16ToBeReceived = (uint16_t *)Local_pTransaction->ReceivedBuffer;
+				Local_pState->Buffer16ToBeSent = (uint16_t *)Local_pTransaction->BufferToSend;
 
-				/* Clear IRQ Source */
-				IRQ_SRC[SPINumber] = SPI_NO_IRQ_SRC;
+				SPI_StartTransceiveIT(SPINumber, SPI_TRANSCEIVE_BUFFER16_IRQ_SRC,
+									  (Local_pState->Buffer16ToBeSent != NULL) ? Local_pState->Buffer16ToBeSent[0] : SPI_DUMMY_DATA,
+									  Local_pTransaction->BufferSize, NULL);
+			}
+			else
+			{
+				Local_pState->BufferToBeReceived = (uint8_t *)Local_pTransaction->ReceivedBuffer;
+				Local_pState->BufferToBeSent = (uint8_t *)Local_pTransaction->BufferToSend;
 
-				if( SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_TRANSMIT )
-				{
-					/* Disable Tx Buffer Not Empty Interrupt */
-					SPI[SPINumber]->CR2 &= (~(1 << SPI_TXEIE));
-
-					/* Invoke Call Back Function */
-					if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE] != NULL)
-					{
-						SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE]();
-					}
-				}
-				else if( SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_RECEIVE )
+				SPI_StartTransceiveIT(SPINumber, SPI_TRANSCEIVE_BUFFER_IRQ_SRC,
+									  (Local_pState->BufferToBeSent != NULL) ? Local_pState->BufferToBeSent[0] : SPI_DUMMY_DATA,
+									  Local_pTransaction->BufferSize, NULL);
+			}
+
+			if (Local_u8StartStatus != SPI_OK)
+			{
+				/* Transfer Could Not be Started , Release The Device & Report The Error , Then Try The Next Transaction */
+				GPIO_u8SetPinValue(Local_pDevice->CSPort, Local_pDevice->CSPin, PIN_HIGH);
+
+				Local_pTransaction->Status = SPI_NOK;
+				Local_pState->ActiveTransaction = NULL;
+
+				if (Local_pTransaction->pv_CallBackFunc != NULL)
 				{
-					/* Disable  Rx Buffer Not Empty Interrupt */
-					SPI[SPINumber]->CR2 &= (~(1 << SPI_RXNEIE));
-
-					/* Invoke Call Back Function */
-					if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE] != NULL)
-					{
-						SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE]();
-					}
+					Local_pTransaction->pv_CallBackFunc();
 				}
-
-				/* Reset Variables*/
-				BufferSizeReached = SPI_BUFFER_SIZE_NOT_REACHED;
 			}
 		}
+	} while (Local_pTransaction != NULL && Local_u8StartStatus != SPI_OK);
+}
+
+/**
+ * @brief  : This Function is Used to Finish The Active Queued Transaction & Start The Next One
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @note   : Private Function , Next Transaction is Started Before The Call Back is Invoked to Keep The Bus Busy
+ *           Runs in The Completion Interrupt So CS is Deasserted Without Any Busy Wait , a Device With a Post Delay is Released by SPI_QueueProcess
+ */
+static void SPI_QueueTransactionDone(SPI_t SPINumber)
+{
+	SPI_TransferState_t *Local_pState = &SPI_State[SPINumber];
+	SPI_Transaction_t *Local_pTransaction = Local_pState->ActiveTransaction;
+
+	if (Local_pTransaction != NULL)
+	{
+		Local_pTransaction->Status = (Local_pState->TransferStatus != SPI_OK) ? Local_pState->TransferStatus : (Local_pState->CRCResult == SPI_CRC_FAIL) ? SPI_CRC_ERROR : SPI_OK;
 	}
-	return Local_u8ErrorStatus;
+
+	if (Local_pTransaction != NULL && Local_pTransaction->Device->PostDelayUs != 0)
+	{
+		/* CS Stays Asserted & The Bus Stays Owned Until SPI_QueueProcess Waits The Post Delay */
+		Local_pState->ReleasePending = 1;
+	}
+	else
+	{
+		if (Local_pTransaction != NULL)
+		{
+			/* Deassert Chip Select */
+			GPIO_u8SetPinValue(Local_pTransaction->Device->CSPort, Local_pTransaction->Device->CSPin, PIN_HIGH);
+
+			Local_pState->ActiveTransaction = NULL;
+		}
+
+		SPI_QueueStartNext(SPINumber, SPI_QUEUE_ISR_CONTEXT);
+
+		if (Local_pTransaction != NULL && Local_pTransaction->pv_CallBackFunc != NULL)
+		{
+			Local_pTransaction->pv_CallBackFunc();
+		}
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Write The Clock & Frame Settings of a Queued Device to CR1 IF They Differ From The Current Ones
+ *
+ * @param  : Config => SPI Configuration of The Device About to be Selected
+ * @note   : Private Function , Called While No Transfer is on The Bus , SPI is Disabled Only While CR1 is Rewritten
+ */
+static void SPI_ApplyDeviceConfig(SPI_Config_t *Config)
+{
+	uint16_t Local_u16Mask = (1 << SPI_CPOL) | (1 << SPI_CPHA) | (1 << SPI_LSBFIRST) | (1 << SPI_DFF);
+	uint16_t Local_u16Bits = (Config->ClockPolarity << SPI_CPOL) | (Config->ClockPhase << SPI_CPHA) |
+							 (Config->Direction << SPI_LSBFIRST) | (Config->DataWidth << SPI_DFF);
+	uint32_t Local_u32Timeout = SPI_FLAG_TIMEOUT;
+
+	/* Baud Rate is Set For Master Role Only ( Same as SPI_Init ) */
+	if (Config->NodeRole == SPI_MASTER)
+	{
+		Local_u16Mask |= (uint16_t)(~SPI_BR_MASK);
+		Local_u16Bits |= (Config->BaudRate << SPI_BR);
+	}
+
+	if ((SPI[Config->SPINumber]->CR1 & Local_u16Mask) != Local_u16Bits)
+	{
+		/* Let The Last Frame of The Previous Device Leave The Shift Register Before Disabling SPI */
+		while (((SPI[Config->SPINumber]->SR >> SPI_BUSY_FLAG) & 1) && Local_u32Timeout != 0)
+		{
+			Local_u32Timeout--;
+		}
+
+		SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_SPE));
+		SPI[Config->SPINumber]->CR1 = (SPI[Config->SPINumber]->CR1 & (~Local_u16Mask)) | Local_u16Bits;
+		SPI[Config->SPINumber]->CR1 |= (1 << SPI_SPE);
+
+		SPI_State[Config->SPINumber].DataWidth = Config->DataWidth;
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Mask The Completion Interrupts of an SPI Peripheral While The Queue is Modified
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : uint8_t => Previous NVIC Enable State of The Masked IRQs , Passed to SPI_QueueUnlock
+ * @note   : Private Function , The DMA RX Stream IRQ Can be Shared With Other Peripherals ( e.g. DMA2 Stream 2 With USART1 RX )
+ */
+static uint8_t SPI_QueueLock(SPI_t SPINumber)
+{
+	uint8_t Local_u8LockState = 0;
+
+	IRQ_STATE_t Local_SPIIRQState = IRQ_DISABLED;
+	IRQ_STATE_t Local_DMAIRQState = IRQ_DISABLED;
+
+	NVIC_GetEnableIRQ(SPI_IRQ_NUM[SPINumber], &Local_SPIIRQState);
+	NVIC_GetEnableIRQ(SPI_DMA_RX_IRQ_NUM[SPINumber], &Local_DMAIRQState);
+
+	NVIC_DisableIRQ(SPI_IRQ_NUM[SPINumber]);
+	NVIC_DisableIRQ(SPI_DMA_RX_IRQ_NUM[SPINumber]);
+
+	if (Local_SPIIRQState == IRQ_ENABLED)
+	{
+		Local_u8LockState |= SPI_LOCK_SPI_IRQ_ENABLED;
+	}
+	if (Local_DMAIRQState == IRQ_ENABLED)
+	{
+		Local_u8LockState |= SPI_LOCK_DMA_IRQ_ENABLED;
+	}
+	return Local_u8LockState;
+}
+
+/**
+ * @brief  : This Function is Used to Restore The Completion Interrupts of an SPI Peripheral After The Queue is Modified
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : LockState => Value Returned by The Matching SPI_QueueLock , Only IRQs That Were Enabled Are Enabled Again
+ * @note   : Private Function
+ */
+static void SPI_QueueUnlock(SPI_t SPINumber, uint8_t LockState)
+{
+	if (LockState & SPI_LOCK_SPI_IRQ_ENABLED)
+	{
+		NVIC_EnableIRQ(SPI_IRQ_NUM[SPINumber]);
+	}
+	if (LockState & SPI_LOCK_DMA_IRQ_ENABLED)
+	{
+		NVIC_EnableIRQ(SPI_DMA_RX_IRQ_NUM[SPINumber]);
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Get The Ring Buffer Write Index From The DMA RX Stream Counter
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : uint16_t => Index of Next Byte to Be Written by DMA
+ * @note   : Private Function , NDTR Counts Down From RingSize & is Reloaded in Circular Mode
+ */
+static uint16_t SPI_GetRingWriteIndex(SPI_t SPINumber)
+{
+	uint16_t Local_u16Remaining = 0;
+	uint16_t Local_u16WriteIndex = 0;
+
+	DMA_GetRemainingDataCount(SPI_DMA_MAP[SPINumber].DMAController, SPI_DMA_MAP[SPINumber].RxStream, &Local_u16Remaining);
+
+	Local_u16WriteIndex = SPI_State[SPINumber].RingSize - Local_u16Remaining;
+
+	/* NDTR Reads RingSize Right After Reload */
+	if (Local_u16WriteIndex == SPI_State[SPINumber].RingSize)
+	{
+		Local_u16WriteIndex = 0;
+	}
+	return Local_u16WriteIndex;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Number of Bytes Written by DMA Into The Ring Since it Was Started
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : uint32_t => Laps Counted From The Half & Full Ring Interrupts Times The Ring Size Plus The Write Index ( Modulo 2^32 )
+ * @note   : Private Function , Every Lap Raises One Half & One Full Ring Interrupt , an Odd Event Count Means The Writer is in The Second Half
+ */
+static uint32_t SPI_GetRingWriteCount(SPI_t SPINumber)
+{
+	uint32_t Local_u32Events = 0;
+	uint32_t Local_u32Laps = 0;
+	uint16_t Local_u16WriteIndex = 0;
+
+	/* Index & Event Count Must Belong to The Same Moment , Read Again IF a Ring Interrupt Came in Between */
+	do
+	{
+		Local_u32Events = SPI_State[SPINumber].RingEvents;
+		Local_u16WriteIndex = SPI_GetRingWriteIndex(SPINumber);
+	} while (Local_u32Events != SPI_State[SPINumber].RingEvents);
+
+	Local_u32Laps = Local_u32Events / 2;
+
+	/* Second Half Was Entered But The Index Already Wrapped , The Full Ring Interrupt is Still Pending */
+	if ((Local_u32Events & 1) && Local_u16WriteIndex < (SPI_State[SPINumber].RingSize / 2))
+	{
+		Local_u32Laps++;
+	}
+	return (Local_u32Laps * SPI_State[SPINumber].RingSize) + Local_u16WriteIndex;
+}
+
+/**
+ * @brief  : This Function is Used to Count a Half or Full Ring Event & Invoke The Matching Application Call Back
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @note   : Private Function , Events Alternate Half / Full , So an Odd Count After The Increment is a Half Ring Event
+ */
+static void SPI_RingEvent(SPI_t SPINumber)
+{
+	SPI_State[SPINumber].RingEvents++;
+
+	if (SPI_State[SPINumber].RingEvents & 1)
+	{
+		if (SPI_State[SPINumber].RingHalfCallBack != NULL)
+		{
+			SPI_State[SPINumber].RingHalfCallBack();
+		}
+	}
+	else if (SPI_State[SPINumber].RingFullCallBack != NULL)
+	{
+		SPI_State[SPINumber].RingFullCallBack();
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Reset The Hardware CRC Calculation Before a New Transfer
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @note   : Private Function , CRC Registers Are Cleared by Rewriting CRCEN While The SPI is Disabled
+ */
+static void SPI_ResetCRC(SPI_t SPINumber)
+{
+	SPI[SPINumber]->CR1 &= (~(1 << SPI_SPE));
+
+	SPI[SPINumber]->CR1 &= (~(1 << SPI_CRCEN));
+	SPI[SPINumber]->CR1 |= (1 << SPI_CRCEN);
+
+	SPI[SPINumber]->CR1 |= (1 << SPI_SPE);
+}
+
+/**
+ * @brief  : This Function is Used to Check & Clear The CRCERR Flag After The CRC Frame is Received
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : SPI_CRC_RESULT_t => SPI_CRC_PASS or SPI_CRC_FAIL
+ * @note   : Private Function
+ */
+static SPI_CRC_RESULT_t SPI_CheckCRC(SPI_t SPINumber)
+{
+	SPI_CRC_RESULT_t Local_Result = SPI_CRC_PASS;
+
+	if ((SPI[SPINumber]->SR >> SPI_CRC_ERROR_FLAG) & 1)
+	{
+		Local_Result = SPI_CRC_FAIL;
+
+		/* CRCERR is Cleared by Writing 0 */
+		SPI[SPINumber]->SR &= (~(1 << SPI_CRC_ERROR_FLAG));
+	}
+	return Local_Result;
+}
+
+/* ======================================================================
+ * DMA CALL BACK HANDLERS
+ * ====================================================================== */
+
+/* SPI1 DMA RX Transfer Complete Handler */
+static void SPI1_DMA_RxComplete(void)
+{
+	SPI_DMA_HANDLE_IT(SPI1_APB2);
+}
+
+/* SPI2 DMA RX Transfer Complete Handler */
+static void SPI2_DMA_RxComplete(void)
+{
+	SPI_DMA_HANDLE_IT(SPI2_APB1);
 }
 
+/* SPI3 DMA RX Transfer Complete Handler */
+static void SPI3_DMA_RxComplete(void)
+{
+	SPI_DMA_HANDLE_IT(SPI3_APB1);
+}
+
+/* SPI4 DMA RX Transfer Complete Handler */
+static void SPI4_DMA_RxComplete(void)
+{
+	SPI_DMA_HANDLE_IT(SPI4_APB2);
+}
+
+/* SPI1 DMA RX Half & Full Ring Handler */
+static void SPI1_DMA_RingEvent(void)
+{
+	SPI_RingEvent(SPI1_APB2);
+}
 
+/* SPI2 DMA RX Half & Full Ring Handler */
+static void SPI2_DMA_RingEvent(void)
+{
+	SPI_RingEvent(SPI2_APB1);
+}
+
+/* SPI3 DMA RX Half & Full Ring Handler */
+static void SPI3_DMA_RingEvent(void)
+{
+	SPI_RingEvent(SPI3_APB1);
+}
+
+/* SPI4 DMA RX Half & Full Ring Handler */
+static void SPI4_DMA_RingEvent(void)
+{
+	SPI_RingEvent(SPI4_APB2);
+}
 
 /* ======================================================================
  * INTERRUPT HANDLERS
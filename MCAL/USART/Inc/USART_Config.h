@@ -20,6 +20,14 @@
  * CONFIGURATION PARAMETERS
  * ====================================================================== */
 
+/* Default USART Clock in Hz , Used When USART_Config_t PeripheralClock is 0 */
 #define F_PCLK 16000000UL
 
+/* Largest Baud Rate Error Accepted by USART_Init in ppm ( Both Ends Errors Add Up Against The Receiver Tolerance ) */
+#define USART_BAUD_MAX_ERROR_PPM 20000L
+
+/* Interrupt Driven TX & RX FIFOs Sizes in Bytes For Each USART ( Must Be a Power of 2 , Maximum 32768 ) */
+#define USART_TX_FIFO_SIZE 64
+#define USART_RX_FIFO_SIZE 64
+
 #endif
\ No newline at end of file
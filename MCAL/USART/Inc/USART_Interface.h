@@ -85,6 +85,7 @@ typedef enum
 {
     USART_OVER16 = 0,
     USART_OVER8 = 1,
+    USART_OVER_AUTO = 2, /* Oversampling Giving The Lowest Baud Rate Error , OVER16 on a Tie */
 
 } USART_Oversampling_t;
 
@@ -178,6 +179,17 @@ typedef enum
 
 } USART_HW_FLOW_CTRL_t;
 
+/**
+ * @brief : This Enum Holds Values of USART Mute Mode Wakeup Methods
+ * @enum  : @USART_WakeUp_t
+ */
+typedef enum
+{
+    USART_WAKEUP_IDLE_LINE = 0,    /* Receiver Wakes Up on an IDLE Line */
+    USART_WAKEUP_ADDRESS_MARK = 1, /* Receiver Wakes Up on an Address Byte Matching The Node Address */
+
+} USART_WakeUp_t;
+
 /**
  * @brief : This Struct Holds Values of USART Configuration Options
  * @struct: @USART_Config_t
@@ -194,9 +206,35 @@ typedef struct
     USART_STOP_BITS_t StopBits;
     USART_HW_FLOW_CTRL_t HW_FlowControlMode;
     uint32_t BaudRate;
+    uint32_t PeripheralClock; /* APB Clock Feeding This USART in Hz , 0 Uses F_PCLK */
 
 } USART_Config_t;
 
+/**
+ * @brief : This Struct Holds The Result of a Baud Rate Calculation
+ * @struct: @USART_BaudRateInfo_t
+ */
+typedef struct
+{
+    uint16_t BRR;                      /* Baud Rate Register Value */
+    USART_Oversampling_t Oversampling; /* Selected Oversampling ( USART_OVER16 / USART_OVER8 ) */
+    uint32_t AchievedBaudRate;         /* Real Baud Rate in bps */
+    int32_t ErrorPPM;                  /* ( Achieved - Requested ) / Requested in Parts Per Million */
+
+} USART_BaudRateInfo_t;
+
+/**
+ * @brief : This Struct Holds One Segment of a Scatter Gather Transmission
+ * @struct: @USART_Segment_t
+ * @note  : An Array of Segments is Sent Back to Back ( e.g. Header , Payload & CRC ) Without Copying Them Into One Buffer
+ */
+typedef struct
+{
+    const uint8_t *Data; /* Segment Bytes */
+    uint32_t Length;     /* Segment Length in Bytes */
+
+} USART_Segment_t;
+
 /* ------------------------------------------------------------------------------------------------ */
 /* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
 /* ------------------------------------------------------------------------------------------------ */
@@ -256,18 +294,20 @@ ERRORS_t USART_SetCallBack(USART_t USARTNum, USART_IT_t ITNumber, void (*Pv_Call
  * @param  : Data   => This Parameter is Used to Pass The Variable to Be Received inside it
  * @param  : pv_CallBackFunc   => This Parameter is Used to Pass The CallBack Function to be Used in Interrupt Mode
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Returns USART_NOK While a Reception is Already in Progress on The Same Peripheral
  */
 ERRORS_t USART_ReceiveData_IT(USART_Config_t *Config, uint16_t *ReceivedData, void (*pv_CallBackFunc)(void));
 
 /**
- * @brief  : This Function is Used to Send String Using a USART Peripheral ( Non-Blocking Mode )
+ * @brief  : This Function is Used to Send String Using a USART Peripheral ( Blocking Mode )
  * @fn     : USART_SendBuffer
  * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send String Using it
  * @param  : Data   => This Parameter is Used to Pass The Buffer of Data to Be Sent Using The USART Peripheral
  * @param  : Size   => This Parameter is Used to Pass The Size of The Buffer to Be Sent Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Next Byte is Written as Soon as The Data Register is Empty , Transmission Complete is Awaited Only After The Last Byte
  */
-ERRORS_t USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint8_t Size);
+ERRORS_t USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint32_t Size);
 
 /**
  * @brief  : This Function is Used to Receive String Using a USART Peripheral ( Blocking Mode )
@@ -277,7 +317,7 @@ ERRORS_t USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint8_t
  * @param  : Size   => This Parameter is Used to Pass The Size of The Buffer to Be Received Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-ERRORS_t USART_ReceiveBuffer(USART_Config_t *Config, uint8_t *ReceivedData, uint8_t Size);
+ERRORS_t USART_ReceiveBuffer(USART_Config_t *Config, uint8_t *ReceivedData, uint32_t Size);
 
 /**
  * @brief  : This Function is Used to Enable DMA Receiver
@@ -311,6 +351,7 @@ ERRORS_t USART_EnableIT(USART_Config_t *Config);
  * @param  : Data => This Parameter is Used to Pass The Data to Be Sent Using The USART Peripheral
  * @param  : pv_CallBack_Func => This Parameter is Used to Pass The CallBack Function to be Used in Interrupt Mode to be invoked when Interrupt Occurs
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Returns USART_NOK While a Transmission is Already in Progress on The Same Peripheral
  */
 ERRORS_t USART_SendData_IT(USART_Config_t *Configuration, uint16_t Data, void (*pv_CallBack_Func)(void));
 
@@ -322,8 +363,9 @@ ERRORS_t USART_SendData_IT(USART_Config_t *Configuration, uint16_t Data, void (*
  * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Sent Using The USART Peripheral
  * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be Used in Interrupt Mode to be invoked when Interrupt Occurs
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Returns USART_NOK While a Transmission is Already in Progress on The Same Peripheral
  */
-ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint8_t BufferSize, void (*pv_CallBackFunc)(void));
+ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint32_t BufferSize, void (*pv_CallBackFunc)(void));
 
 /**
  * @brief  : This Function is Used to Receive a Buffer of Data Using a USART Peripheral ( Non-Blocking Mode ) AKA Asycnchronous
@@ -332,8 +374,217 @@ ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint8_
  * @param  : ReceiveBuffer => This Parameter is Used to Pass The Buffer of Data to Be Received inside it Using The USART Peripheral
  * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Received Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Returns USART_NOK While a Reception is Already in Progress on The Same Peripheral
+ */
+ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint32_t BufferSize, void(*pv_CallBackFunc));
+
+/**
+ * @brief  : This Function is Used to Send a Buffer of Data Using a USART Peripheral & DMA ( Non-Blocking Mode ) AKA Asycnchronous
+ * @fn     : USART_SendBuffer_DMA
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send Buffer Using it
+ * @param  : DataBuffer => This Parameter is Used to Pass The Buffer of Data to Be Sent Using The USART Peripheral
+ * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Sent Using The USART Peripheral
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when The Whole Buffer is Sent
+ * @param  : pv_ErrorCallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when a DMA Transfer Error Occurs ( Can Be NULL )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The DMA Stream IRQ of The USART TX Stream Must Be Enabled in The NVIC , Check USART DMA Mapping in USART_Program.c
+ *           Returns USART_NOK While an Interrupt , DMA or FIFO Transmission Owns The Same Peripheral
+ */
+ERRORS_t USART_SendBuffer_DMA(USART_Config_t *Config, uint8_t *DataBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(void), void (*pv_ErrorCallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Receive a Buffer of Data Using a USART Peripheral & DMA ( Non-Blocking Mode ) AKA Asycnchronous
+ * @fn     : USART_ReceiveBuffer_DMA
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Receive Buffer Using it
+ * @param  : ReceiveBuffer => This Parameter is Used to Pass The Buffer of Data to Be Received inside it Using The USART Peripheral
+ * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Received Using The USART Peripheral
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when The Whole Buffer is Received
+ * @param  : pv_ErrorCallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when a DMA Transfer Error Occurs ( Can Be NULL )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The DMA Stream IRQ of The USART RX Stream Must Be Enabled in The NVIC , Check USART DMA Mapping in USART_Program.c
+ *           Returns USART_NOK While an Interrupt , DMA or FIFO Reception Owns The Same Peripheral
+ */
+ERRORS_t USART_ReceiveBuffer_DMA(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(void), void (*pv_ErrorCallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Start Receiving Variable Length Frames Into a Ring Buffer Using Circular DMA & IDLE Line Detection
+ * @fn     : USART_StartReceiveToIdle_DMA
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Receive Using it
+ * @param  : RingBuffer => This Parameter is Used to Pass The Ring Buffer Filled Continuously by The DMA
+ * @param  : RingSize => This Parameter is Used to Pass The Size of The Ring Buffer
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked When New Bytes Are Reported
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : An Event is Reported When The Line Goes IDLE After a Frame & When The DMA Reaches The Half or The End of The Ring ,
+ *           Use USART_GetRxToIdleEvent Inside The CallBack to Get The New Bytes , Both The USART IRQ & The RX DMA Stream IRQ Must Be Enabled in The NVIC
+ *           Returns USART_NOK While an Interrupt , DMA or FIFO Reception Owns The Same Peripheral
+ */
+ERRORS_t USART_StartReceiveToIdle_DMA(USART_Config_t *Config, uint8_t *RingBuffer, uint16_t RingSize, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Stop a Receive To IDLE Reception Started by USART_StartReceiveToIdle_DMA
+ * @fn     : USART_StopReceiveToIdle_DMA
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_StopReceiveToIdle_DMA(USART_t USARTNum);
+
+/**
+ * @brief  : This Function is Used to Get All Bytes Reported by Receive To IDLE Events Since The Previous Call
+ * @fn     : USART_GetRxToIdleEvent
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Offset => This Parameter is Used to Return The Ring Index of The First New Byte
+ * @param  : Length => This Parameter is Used to Return The Number of New Bytes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : New Bytes May Wrap Around The End of The Ring , Byte i is at RingBuffer[ ( Offset + i ) % RingSize ] , They Are Marked as Read ,
+ *           Events Not Read in Time Are Accumulated , USART_RX_OVERRUN is Returned With Length 0 IF The DMA Overwrote Unread Bytes ( They Are Dropped )
+ */
+ERRORS_t USART_GetRxToIdleEvent(USART_t USARTNum, uint16_t *Offset, uint16_t *Length);
+
+/**
+ * @brief  : This Function is Used to Start The Interrupt Driven TX & RX FIFOs of a USART Peripheral
+ * @fn     : USART_StartFifo
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Received Bytes Are Stored in The RX FIFO Continuously , The USART IRQ Must Be Enabled in The NVIC
+ *           Returns USART_NOK While an Interrupt or DMA Transfer is in Progress in Either Direction
+ */
+ERRORS_t USART_StartFifo(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Stop The Interrupt Driven TX & RX FIFOs of a USART Peripheral
+ * @fn     : USART_StopFifo
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Bytes Still Queued in The TX FIFO Are Discarded
+ */
+ERRORS_t USART_StopFifo(USART_t USARTNum);
+
+/**
+ * @brief  : This Function is Used to Queue Bytes in The TX FIFO Without Blocking
+ * @fn     : USART_FifoWrite
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Data => This Parameter is Used to Pass The Bytes to Be Sent
+ * @param  : Length => This Parameter is Used to Pass The Number of Bytes to Be Sent
+ * @param  : Written => This Parameter is Used to Return The Number of Bytes Actually Queued ( Less Than Length When The FIFO is Full )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Single Producer , Only One Context Should Write to The Same USART
+ */
+ERRORS_t USART_FifoWrite(USART_t USARTNum, const uint8_t *Data, uint16_t Length, uint16_t *Written);
+
+/**
+ * @brief  : This Function is Used to Read Received Bytes From The RX FIFO Without Blocking
+ * @fn     : USART_FifoRead
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Data => This Parameter is Used to Pass The Buffer to Copy The Received Bytes Into
+ * @param  : Length => This Parameter is Used to Pass The Maximum Number of Bytes to Read
+ * @param  : ReadLength => This Parameter is Used to Return The Number of Bytes Actually Read
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Single Consumer , Only One Context Should Read From The Same USART
+ */
+ERRORS_t USART_FifoRead(USART_t USARTNum, uint8_t *Data, uint16_t Length, uint16_t *ReadLength);
+
+/**
+ * @brief  : This Function is Used to Get The Number of Received Bytes Waiting in The RX FIFO
+ * @fn     : USART_FifoAvailable
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Available => This Parameter is Used to Return The Number of Bytes Ready to Be Read
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_FifoAvailable(USART_t USARTNum, uint16_t *Available);
+
+/**
+ * @brief  : This Function is Used to Send a List of Buffer Segments Back to Back Using a USART Peripheral ( Blocking Mode )
+ * @fn     : USART_SendSegments
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send Using it
+ * @param  : Segments => This Parameter is Used to Pass The Array of Segments to Be Sent in Order -> @USART_Segment_t
+ * @param  : SegmentCount => This Parameter is Used to Pass The Number of Segments in The Array
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_SendSegments(USART_Config_t *Config, const USART_Segment_t *Segments, uint8_t SegmentCount);
+
+/**
+ * @brief  : This Function is Used to Send a List of Buffer Segments Back to Back Using a USART Peripheral ( Non-Blocking Mode ) AKA Asycnchronous
+ * @fn     : USART_SendSegments_IT
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send Using it
+ * @param  : Segments => This Parameter is Used to Pass The Array of Segments to Be Sent in Order -> @USART_Segment_t
+ * @param  : SegmentCount => This Parameter is Used to Pass The Number of Segments in The Array
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when The Last Byte is Sent
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Segments Array & Their Data Must Stay Valid Until The CallBack is Invoked
+ */
+ERRORS_t USART_SendSegments_IT(USART_Config_t *Config, const USART_Segment_t *Segments, uint8_t SegmentCount, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Configure The Mute Mode Wakeup Method & Node Address of a USART Peripheral
+ * @fn     : USART_SetMuteMode
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @param  : WakeUp => This Parameter is Used to Select The Wakeup Method -> @USART_WakeUp_t
+ * @param  : Address => This Parameter is Used to Pass The Node Address ( 0 -> 15 ) , Used With Address Mark Wakeup Only
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Receiver is Not Muted Here , Call USART_EnterMuteMode When The Node Has to Ignore The Bus
+ */
+ERRORS_t USART_SetMuteMode(USART_Config_t *Config, USART_WakeUp_t WakeUp, uint8_t Address);
+
+/**
+ * @brief  : This Function is Used to Mute The Receiver of a USART Peripheral
+ * @fn     : USART_EnterMuteMode
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : No RXNE is Raised While Muted , Hardware Unmutes on The Selected Wakeup Event ( The Matching Address Byte is Received ) &
+ *           Mutes Again by Itself on a Non Matching Address Byte
+ */
+ERRORS_t USART_EnterMuteMode(USART_t USARTNum);
+
+/**
+ * @brief  : This Function is Used to Unmute The Receiver of a USART Peripheral
+ * @fn     : USART_ExitMuteMode
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_ExitMuteMode(USART_t USARTNum);
+
+/**
+ * @brief  : This Function is Used to Send an Address Byte Waking Up The Node Having This Address ( Blocking Mode )
+ * @fn     : USART_SendAddress
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send Using it
+ * @param  : Address => This Parameter is Used to Pass The Destination Node Address ( 0 -> 15 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Address Mark ( Most Significant Data Bit ) is Set by The Driver According to The Word Length & Parity
+ */
+ERRORS_t USART_SendAddress(USART_Config_t *Config, uint8_t Address);
+
+/**
+ * @brief  : This Function is Used to Set The RS-485 Driver Enable Pin Driven by The USART Driver Around Each Transmission
+ * @fn     : USART_SetDriverEnablePin
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Port => This Parameter is Used to Select The Driver Enable Pin Port -> @Port_t
+ * @param  : Pin => This Parameter is Used to Select The Driver Enable Pin Number -> @Pin_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Pin is Configured as Push Pull Output & Driven Low ( Receive ) , It is Driven High Before The First Byte & Low After
+ *           Transmission Complete of The Last Byte , For DMA & FIFO Transmissions The USART IRQ Must Be Enabled in The NVIC
+ */
+ERRORS_t USART_SetDriverEnablePin(USART_t USARTNum, uint8_t Port, uint8_t Pin);
+
+/**
+ * @brief  : This Function is Used to Calculate The Baud Rate Register Value Closest to a Requested Baud Rate Using Integer Math Only
+ * @fn     : USART_CalculateBaudRate
+ * @param  : PeripheralClock => This Parameter is Used to Pass The APB Clock Feeding The USART in Hz
+ * @param  : BaudRate => This Parameter is Used to Pass The Requested Baud Rate in bps
+ * @param  : Oversampling => This Parameter is Used to Select The Oversampling , USART_OVER_AUTO Evaluates Both -> @USART_Oversampling_t
+ * @param  : Info => This Parameter is Used to Return The Register Value , Achieved Baud Rate & Error -> @USART_BaudRateInfo_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Nothing is Written to The Peripheral , Use it to Check a Baud Rate Before USART_Init
+ */
+ERRORS_t USART_CalculateBaudRate(uint32_t PeripheralClock, uint32_t BaudRate, USART_Oversampling_t Oversampling, USART_BaudRateInfo_t *Info);
+
+/**
+ * @brief  : This Function is Used to Get The Baud Rate Programmed by The Last USART_Init
+ * @fn     : USART_GetBaudRateInfo
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Info => This Parameter is Used to Return The Register Value , Achieved Baud Rate & Error -> @USART_BaudRateInfo_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint8_t BufferSize, void(*pv_CallBackFunc));
+ERRORS_t USART_GetBaudRateInfo(USART_t USARTNum, USART_BaudRateInfo_t *Info);
 /* ---------------------------------------------------------------------------------------------- */
 /* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
 /* ---------------------------------------------------------------------------------------------- */
@@ -16,6 +16,158 @@
 #ifndef USART_PRIVATE_H_
 #define USART_PRIVATE_H_
 
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+#define USART_OVER8_MASK 0x7FFF
+#define USART_M_MASK 0xEFFF
+#define USART_PEIE_MASK 0xFEFF
+#define USART_TXEIE_MASK 0xFF7F
+#define USART_TCIE_MASK 0xFFBF
+#define USART_RXNEIE_MASK 0xFFDF
+#define USART_IDLEIE_MASK 0xFFEF
+#define USART_LBDIE_MASK 0xFFBF
+#define USART_CTSIE_MASK 0xFBFF
+#define USART_EIE_MASK 0xFFFE
+#define USART_STOP_MASK 0xCFFF
+
+#define USART_CLEAR_PARITY_8_MASK 0x7F
+#define USART_CLEAR_PARITY_9_MASK 0xFF
+
+#define USART_DMA_IDLE 0
+#define USART_DMA_BUSY 1
+#define USART_DMA_RX_TO_IDLE 2
+#define USART_DMA_TX_DRAINING 3
+
+#define USART_DE_DIS 0
+#define USART_DE_EN 1
+
+#define USART_ADDRESS_MASK 0x0F
+
+#define USART_OVER16_MIN_DIV 16U
+#define USART_OVER16_MAX_DIV 0xFFFFU
+#define USART_OVER8_MIN_DIV 8U
+#define USART_OVER8_MAX_DIV 0x7FFFU
+
+#define USART_FIFO_DIS 0
+#define USART_FIFO_EN 1
+
+/* ======================================================================
+ * PRIVATE ENUMS
+ * ====================================================================== */
+
+typedef enum
+{
+    USART_NO_SRC = 0,
+    USART_RECEIVE_DATA = 1,
+    USART_SEND_DATA = 2,
+    USART_SEND_BUFFER = 3,
+    USART_RECEIVE_BUFFER = 4,
+    USART_SEND_SEGMENTS = 5,
+
+} USART_IRQ_SRC_t;
+
+/**
+ * @brief : This Enum Holds The Direction of a USART DMA Transfer
+ * @enum  : @USART_DMA_DIR_t
+ */
+typedef enum
+{
+    USART_DMA_TX = 0,
+    USART_DMA_RX = 1,
+
+} USART_DMA_DIR_t;
+
+/**
+ * @brief : This Struct Holds The DMA Controller , Streams & Channel Connected to a USART Peripheral
+ * @struct: @USART_DMA_MAP_t
+ */
+typedef struct
+{
+    DMA_CONTROLLER_t DMAController;
+    DMA_STREAMS_t RxStream;
+    DMA_STREAMS_t TxStream;
+    DMA_CHANNEL_t ChannelNumber;
+
+} USART_DMA_MAP_t;
+
+/**
+ * @brief : This Struct Holds The State of a USART Receive To IDLE Ring Buffer
+ * @struct: @USART_RxToIdle_t
+ */
+typedef struct
+{
+    uint8_t *RingBuffer;  /* User Ring Buffer Filled by Circular DMA */
+    uint16_t RingSize;    /* Ring Buffer Size in Bytes */
+    uint16_t LastIndex;           /* Ring Index Reached at The Previous Event */
+    volatile uint32_t WriteCount; /* Free Running Count of Bytes Written by The DMA Up to The Previous Event */
+    uint32_t ReadCount;           /* Free Running Count of Bytes Already Reported to The User */
+
+} USART_RxToIdle_t;
+
+/**
+ * @brief : This Struct Holds a Single Producer Single Consumer FIFO Used by The Interrupt Driven USART Streams
+ * @struct: @USART_FIFO_t
+ * @note  : Head is Only Written by The Producer & Tail Only by The Consumer , Both Are Free Running & Masked on Access
+ */
+typedef struct
+{
+    volatile uint8_t *Buffer; /* FIFO Storage */
+    uint16_t Mask;            /* FIFO Size - 1 */
+    volatile uint16_t Head;   /* Next Write Position */
+    volatile uint16_t Tail;   /* Next Read Position */
+
+} USART_FIFO_t;
+
+/**
+ * @brief : This Struct Holds The Progress of an Interrupt Driven Scatter Gather Transmission
+ * @struct: @USART_SegmentsState_t
+ */
+typedef struct
+{
+    const USART_Segment_t *Segments; /* Segments Array Being Sent */
+    uint8_t Count;                   /* Number of Segments */
+    uint8_t Index;                   /* Segment Being Sent */
+    uint32_t Offset;                 /* Next Byte to Send in The Current Segment */
+
+} USART_SegmentsState_t;
+
+/**
+ * @brief : This Struct Holds Every Transfer State of a Single USART Peripheral
+ * @struct: @USART_Handle_t
+ * @note  : TX & RX Sources Are Separate So an Interrupt Driven Send & Receive Can Run at The Same Time on One Peripheral
+ */
+typedef struct
+{
+    volatile USART_IRQ_SRC_t TxSource; /* Interrupt Driven Transmission in Progress */
+    volatile USART_IRQ_SRC_t RxSource; /* Interrupt Driven Reception in Progress */
+
+    uint16_t *ReceivedData;   /* USART_ReceiveData_IT Destination */
+    uint8_t *SentBuffer;      /* USART_SendBuffer_IT Source */
+    uint32_t SentSize;        /* USART_SendBuffer_IT Size */
+    uint32_t SentCounter;     /* Next Byte to Send */
+    uint8_t *ReceivedBuffer;  /* USART_ReceiveBuffer_IT Destination */
+    uint32_t ReceivedSize;    /* USART_ReceiveBuffer_IT Size */
+    uint32_t ReceivedCounter; /* Next Byte to Receive */
+
+    USART_SegmentsState_t Segments; /* USART_SendSegments_IT Progress */
+
+    volatile uint8_t DMATxState; /* USART_DMA_IDLE / USART_DMA_BUSY / USART_DMA_TX_DRAINING */
+    volatile uint8_t DMARxState; /* USART_DMA_IDLE / USART_DMA_BUSY / USART_DMA_RX_TO_IDLE */
+    USART_RxToIdle_t RxToIdle;   /* Receive To IDLE Ring Buffer State */
+
+    volatile uint8_t FifoState; /* USART_FIFO_DIS / USART_FIFO_EN */
+    USART_FIFO_t TxFifo;        /* Interrupt Driven TX FIFO */
+    USART_FIFO_t RxFifo;        /* Interrupt Driven RX FIFO */
+
+    uint8_t DEState; /* USART_DE_DIS / USART_DE_EN */
+    uint8_t DEPort;  /* RS-485 Driver Enable Pin Port */
+    uint8_t DEPin;   /* RS-485 Driver Enable Pin Number */
+
+    USART_BaudRateInfo_t BaudRate; /* Baud Rate Programmed by USART_Init */
+
+} USART_Handle_t;
+
 /* ======================================================================
  * PRIVATE FUNCTION
  * ====================================================================== */
@@ -47,12 +199,25 @@ static ERRORS_t USART_SetParity(USART_t UsartNum, USART_ParityMode_t Parity);
 static ERRORS_t USART_SetMode(USART_t UsartNum, USART_Mode_t Mode);
 
 /**
- * @brief  : This Function is Used to Set The BaudRate of USART Peripheral
+ * @brief  : This Function is Used to Set The BaudRate & Oversampling of USART Peripheral
  *
  * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Set The BaudRate
- * @return : void
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Nothing is Written IF The Error Exceeds USART_BAUD_MAX_ERROR_PPM
  */
-static void USART_SetBaudRate(USART_Config_t *Config);
+static ERRORS_t USART_SetBaudRate(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Find The Divider ( Clock / BaudRate ) Closest to The Requested Baud Rate Within a Range
+ *
+ * @param  : PeripheralClock => This Parameter is Used to Pass The USART Clock in Hz
+ * @param  : BaudRate => This Parameter is Used to Pass The Requested Baud Rate in bps
+ * @param  : MinDiv => This Parameter is Used to Pass The Smallest Divider Allowed by The Oversampling
+ * @param  : MaxDiv => This Parameter is Used to Pass The Largest Divider Allowed by The Oversampling
+ * @param  : ErrorPPM => This Parameter is Used to Return The Error of The Selected Divider in ppm
+ * @return : uint32_t => The Selected Divider , Equal to 16 * USARTDIV With OVER16 & 8 * USARTDIV With OVER8
+ */
+static uint32_t USART_BestDivider(uint32_t PeripheralClock, uint32_t BaudRate, uint32_t MinDiv, uint32_t MaxDiv, int32_t *ErrorPPM);
 
 /**
  * @brief  : This Function is Used to Handle The Interrupts of USART Peripheral
@@ -63,36 +228,69 @@ static void USART_SetBaudRate(USART_Config_t *Config);
  */
 static void USART_HANDLE_IT(USART_t USARTNum);
 
-/* ======================================================================
- * PRIVATE MACROS
- * ====================================================================== */
-#define USART_OVER8_MASK 0x7FFF
-#define USART_M_MASK 0xEFFF
-#define USART_PEIE_MASK 0xFEFF
-#define USART_TXEIE_MASK 0xFF7F
-#define USART_TCIE_MASK 0xFFBF
-#define USART_RXNEIE_MASK 0xFFDF
-#define USART_IDLEIE_MASK 0xFFEF
-#define USART_LBDIE_MASK 0xFFBF
-#define USART_CTSIE_MASK 0xFBFF
-#define USART_EIE_MASK 0xFFFE
-#define USART_STOP_MASK 0xCFFF
+/**
+ * @brief  : This Function is Used to Configure & Start The DMA Stream of a USART Peripheral in One Direction
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Direction => This Parameter is Used to Select The Transfer Direction -> @USART_DMA_DIR_t
+ * @param  : Buffer => This Parameter is Used to Pass The Memory Buffer to Be Sent From or Received Into
+ * @param  : BufferSize => This Parameter is Used to Pass The Number of Bytes to Be Transferred
+ * @param  : Mode => This Parameter is Used to Select Normal or Circular DMA Mode -> @DMA_MODE_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Private Function Used Inside USART_SendBuffer_DMA & USART_ReceiveBuffer_DMA After Checking Their Arguments
+ */
+static ERRORS_t USART_StartDMA(USART_t USARTNum, USART_DMA_DIR_t Direction, uint8_t *Buffer, uint16_t BufferSize, DMA_MODE_t Mode);
 
-#define USART_CLEAR_PARITY_8_MASK 0x7F
-#define USART_CLEAR_PARITY_9_MASK 0xFF
+/**
+ * @brief  : This Function is Used to Report The Bytes Received Since The Previous Receive To IDLE Event
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : void
+ * @note   : Called on IDLE Line Detection & on DMA Half / Full Ring Events So Long Messages Are Reported Before They Get Overwritten
+ */
+static void USART_RxToIdleEvent(USART_t USARTNum);
 
-/* ======================================================================
- * PRIVATE ENUMS
- * ====================================================================== */
+/**
+ * @brief  : This Function is Used to Load The Next Byte of an Interrupt Driven Scatter Gather Transmission
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : void
+ * @note   : Called on TXE , Empty Segments Are Skipped & Transmission Complete Interrupt Takes Over After The Last Byte ( Private Function )
+ */
+static void USART_SendNextSegmentByte(USART_t USARTNum);
 
-typedef enum
-{
-    USART_NO_SRC = 0,
-    USART_RECEIVE_DATA = 1,
-    USART_SEND_DATA = 2,
-    USART_SEND_BUFFER = 3,
-    USART_RECEIVE_BUFFER = 4,
+/**
+ * @brief  : This Function is Used to Drive The RS-485 Driver Enable Pin of a USART Peripheral IF One is Set
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Level => This Parameter is Used to Pass The Pin Level , 1 to Transmit & 0 to Receive
+ * @return : void
+ * @note   : Does Nothing IF USART_SetDriverEnablePin Was Not Called For This USART ( Private Function )
+ */
+static void USART_DriverEnable(USART_t USARTNum, uint8_t Level);
 
-} USART_IRQ_SRC_t;
+/**
+ * @brief  : This Function is Used to Handle The End of a USART DMA Transfer ( Transfer Complete or Transfer Error )
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Direction => This Parameter is Used to Select The Finished Transfer Direction -> @USART_DMA_DIR_t
+ * @return : void
+ * @note   : This Function is Called From The DMA Stream Call Backs Registered by The USART Driver ( Private Function )
+ */
+static void USART_DMA_HANDLE_IT(USART_t USARTNum, USART_DMA_DIR_t Direction);
+
+/* DMA Stream Call Backs , The DMA Driver Call Backs Take no Arguments So Each USART Has Its Own Pair */
+static void USART1_DMA_TxHandler(void);
+static void USART1_DMA_RxHandler(void);
+static void USART2_DMA_TxHandler(void);
+static void USART2_DMA_RxHandler(void);
+static void USART3_DMA_TxHandler(void);
+static void USART3_DMA_RxHandler(void);
+static void UART4_DMA_TxHandler(void);
+static void UART4_DMA_RxHandler(void);
+static void UART5_DMA_TxHandler(void);
+static void UART5_DMA_RxHandler(void);
+static void USART6_DMA_TxHandler(void);
+static void USART6_DMA_RxHandler(void);
 
 #endif /* USART_PRIVATE_H_ */
\ No newline at end of file
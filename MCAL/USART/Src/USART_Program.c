@@ -22,6 +22,9 @@
 #include "../../../LIB/STM32F446xx.h"
 #include "../../../LIB/ErrType.h"
 
+#include "../../DMA/Inc/DMA_Interface.h"
+#include "../../GPIO/Inc/GPIO_Interface.h"
+
 #include "../Inc/USART_Interface.h"
 #include "../Inc/USART_Config.h"
 #include "../Inc/USART_Private.h"
@@ -38,17 +41,41 @@ static USART_RegDef_t *USART[USART_MAX_NUMBER] = {USART1, USART2, USART3, UART4,
 
 static void (*USART_PTR_TO_FUNC[USART_MAX_NUMBER][USART_IT_NUM])(void) = {NULL};
 
-static uint16_t *USART_ReceivedData[USART_MAX_NUMBER] = {NULL};
-
-static uint8_t *USART_SentBuffer[USART_MAX_NUMBER] = {NULL};
-
-static uint8_t *USART_ReceivedBuffer[USART_MAX_NUMBER] = {NULL};
-
-static uint8_t USART_SentbufferSize[USART_MAX_NUMBER] = {0};
+/* Per Instance Transfer State , Every USART Runs Its Own Transfers Independently of The Others */
+static USART_Handle_t USART_Handle[USART_MAX_NUMBER] = {0};
 
-static uint8_t USART_ReceivebufferSize[USART_MAX_NUMBER] = {0};
-
-static USART_IRQ_SRC_t IRQ_SRC[USART_MAX_NUMBER] = {USART_NO_SRC};
+/* USART DMA Request Mapping ( RM0390 DMA1 & DMA2 Request Mapping Tables ) , Streams Shared With SPI & I2C Are Refused by DMA_Init While Enabled */
+static const USART_DMA_MAP_t USART_DMA_MAP[USART_MAX_NUMBER] =
+	{
+		{DMA2_CONTROLLER, DMA_STREAM2, DMA_STREAM7, DMA_CHANNEL4}, /* USART1 */
+		{DMA1_CONTROLLER, DMA_STREAM5, DMA_STREAM6, DMA_CHANNEL4}, /* USART2 */
+		{DMA1_CONTROLLER, DMA_STREAM1, DMA_STREAM3, DMA_CHANNEL4}, /* USART3 */
+		{DMA1_CONTROLLER, DMA_STREAM2, DMA_STREAM4, DMA_CHANNEL4}, /* UART4 */
+		{DMA1_CONTROLLER, DMA_STREAM0, DMA_STREAM7, DMA_CHANNEL4}, /* UART5 */
+		{DMA2_CONTROLLER, DMA_STREAM1, DMA_STREAM6, DMA_CHANNEL5}  /* USART6 */
+};
+
+/* USART DMA RX & TX Streams Configurations */
+static DMA_INIT_STRUCT_t USART_DMA_RxConfig[USART_MAX_NUMBER];
+static DMA_INIT_STRUCT_t USART_DMA_TxConfig[USART_MAX_NUMBER];
+
+/* USART DMA Completion & Error Call Back Functions [ USART_DMA_TX / USART_DMA_RX ] */
+static void (*USART_DMA_CallBack[USART_MAX_NUMBER][2])(void) = {{NULL}};
+static void (*USART_DMA_ErrorCallBack[USART_MAX_NUMBER][2])(void) = {{NULL}};
+
+/* USART Interrupt Driven TX & RX FIFOs Storage */
+static uint8_t USART_TxFifoBuffer[USART_MAX_NUMBER][USART_TX_FIFO_SIZE];
+static uint8_t USART_RxFifoBuffer[USART_MAX_NUMBER][USART_RX_FIFO_SIZE];
+
+/* DMA Stream Handlers Registered in The DMA Driver For Each USART [ USART_DMA_TX / USART_DMA_RX ] */
+static void (*const USART_DMA_Handler[USART_MAX_NUMBER][2])(void) =
+	{
+		{USART1_DMA_TxHandler, USART1_DMA_RxHandler},
+		{USART2_DMA_TxHandler, USART2_DMA_RxHandler},
+		{USART3_DMA_TxHandler, USART3_DMA_RxHandler},
+		{UART4_DMA_TxHandler, UART4_DMA_RxHandler},
+		{UART5_DMA_TxHandler, UART5_DMA_RxHandler},
+		{USART6_DMA_TxHandler, USART6_DMA_RxHandler}};
 /*==============================================================================================================================================
  * GLOBAL VARIABLES SECTION END
  *==============================================================================================================================================*/
@@ -93,17 +120,22 @@ ERRORS_t USART_Init(USART_Config_t *USART_Config)
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	if (USART_WRONG_CONFIGURATION != USART_CheckConfig(USART_Config))
+	if (USART_WRONG_CONFIGURATION == USART_CheckConfig(USART_Config))
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else if (USART_OK != USART_SetBaudRate(USART_Config))
+	{
+		/* Baud Rate Can Not Be Reached Within USART_BAUD_MAX_ERROR_PPM From This Clock */
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
 	{
-		/* Correct Configurations are Handled */
+		/* Correct Configurations are Handled , OverSampling & BaudRate Are Already Set */
 
 		/* Enable USART */
 		USART[USART_Config->USART_Number]->CR1 |= (1 << UE);
 
-		/* Set OverSampling Rate */
-		USART[USART_Config->USART_Number]->CR1 &= (USART_OVER8_MASK);
-		USART[USART_Config->USART_Number]->CR1 |= (USART_Config->Oversampling << OVER8);
-
 		/* Set Word Length */
 		USART[USART_Config->USART_Number]->CR1 &= (USART_M_MASK);
 		USART[USART_Config->USART_Number]->CR1 |= (USART_Config->WordLength << M);
@@ -118,9 +150,6 @@ ERRORS_t USART_Init(USART_Config_t *USART_Config)
 		USART[USART_Config->USART_Number]->CR2 &= (USART_STOP_MASK);
 		USART[USART_Config->USART_Number]->CR2 |= (USART_Config->StopBits << STOP);
 
-		/* Set BaudRate */
-		USART_SetBaudRate(USART_Config);
-
 		/* Set HW Flow Control */
 		if (USART_Config->HW_FlowControlMode == USART_HW_FLOW_CTRL_DIS)
 		{
@@ -135,10 +164,6 @@ ERRORS_t USART_Init(USART_Config_t *USART_Config)
 		/* Set USART Mode */
 		USART_SetMode(USART_Config->USART_Number, USART_Config->Mode);
 	}
-	else
-	{
-		Local_u8ErrorStatus = USART_NOK;
-	}
 	return Local_u8ErrorStatus;
 }
 
@@ -204,6 +229,9 @@ ERRORS_t USART_SendData(USART_Config_t *Config, uint16_t Data)
 	{
 		/* Configurations are OK */
 
+		/* RS-485 Driver Enable Before The First Bit */
+		USART_DriverEnable(Config->USART_Number, 1);
+
 		/* Wait Until Transmission Data Register Empty Flag is Set */
 
 		while (USART_FLAG_SET != FlagStatus)
@@ -221,6 +249,9 @@ ERRORS_t USART_SendData(USART_Config_t *Config, uint16_t Data)
 		{
 			USART_ReadFlag(Config->USART_Number, USART_TRANSMISSION_COMP, &FlagStatus);
 		}
+
+		/* Release The Bus After The Last Bit */
+		USART_DriverEnable(Config->USART_Number, 0);
 	}
 	else
 	{
@@ -274,13 +305,23 @@ ERRORS_t USART_ReceiveData_IT(USART_Config_t *Config, uint16_t *ReceivedData, vo
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	if ((NULL != ReceivedData) && (NULL != pv_CallBackFunc))
+	if ((NULL == ReceivedData) || (NULL == pv_CallBackFunc))
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) ||
+			 USART_Handle[Config->USART_Number].RxSource != USART_NO_SRC || USART_Handle[Config->USART_Number].FifoState == USART_FIFO_EN ||
+			 USART_Handle[Config->USART_Number].DMARxState != USART_DMA_IDLE)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
 	{
 		/* Setting IRQ Source */
-		IRQ_SRC[Config->USART_Number] = USART_RECEIVE_DATA;
+		USART_Handle[Config->USART_Number].RxSource = USART_RECEIVE_DATA;
 
 		/* Setting Global Variable */
-		USART_ReceivedData[Config->USART_Number] = ReceivedData;
+		USART_Handle[Config->USART_Number].ReceivedData = ReceivedData;
 
 		/* Setting Call Back Function */
 		USART_PTR_TO_FUNC[Config->USART_Number][USART_IT_RXNE] = pv_CallBackFunc;
@@ -288,37 +329,57 @@ ERRORS_t USART_ReceiveData_IT(USART_Config_t *Config, uint16_t *ReceivedData, vo
 		/* Enable Read Data Register Not Empty Interrupt */
 		USART[Config->USART_Number]->CR1 |= (1 << RXNEIE);
 	}
-	else
-	{
-		Local_u8ErrorStatus = NULL_POINTER;
-	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Send String Using a USART Peripheral ( Non-Blocking Mode )
+ * @brief  : This Function is Used to Send String Using a USART Peripheral ( Blocking Mode )
  * @fn     : USART_SendBuffer
  * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send String Using it
  * @param  : Data   => This Parameter is Used to Pass The Buffer of Data to Be Sent Using The USART Peripheral
  * @param  : Size   => This Parameter is Used to Pass The Size of The Buffer to Be Sent Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Next Byte is Written as Soon as The Data Register is Empty , Transmission Complete is Awaited Only After The Last Byte
  */
-ERRORS_t USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint8_t Size)
+ERRORS_t USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint32_t Size)
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	uint8_t Local_u8Counter = 0;
+	uint32_t Local_u32Counter = 0;
+
+	USART_RegDef_t *Local_pUSART = NULL;
 
-	if ((NULL != Configuration) && (NULL != Data))
+	if ((NULL == Configuration) || (NULL == Data))
 	{
-		for (Local_u8Counter = 0; Local_u8Counter < Size; Local_u8Counter++)
-		{
-			USART_SendData(Configuration, (uint16_t)Data[Local_u8Counter]);
-		}
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Configuration))
+	{
+		Local_u8ErrorStatus = USART_NOK;
 	}
 	else
 	{
-		Local_u8ErrorStatus = NULL_POINTER;
+		/* Configurations Are Checked Once For The Whole Buffer */
+		Local_pUSART = USART[Configuration->USART_Number];
+
+		/* RS-485 Driver Enable Before The First Bit */
+		USART_DriverEnable(Configuration->USART_Number, 1);
+
+		for (Local_u32Counter = 0; Local_u32Counter < Size; Local_u32Counter++)
+		{
+			/* Wait Until Data Register is Empty Only , The Shift Register Keeps Sending The Previous Byte Meanwhile */
+			while (!((Local_pUSART->SR >> USART_TDATA_REG_EMPTY) & 1))
+				;
+
+			Local_pUSART->DR = Data[Local_u32Counter];
+		}
+
+		/* Wait Once For The Last Byte to Leave The Shift Register */
+		while (!((Local_pUSART->SR >> USART_TRANSMISSION_COMP) & 1))
+			;
+
+		/* Release The Bus After The Last Bit */
+		USART_DriverEnable(Configuration->USART_Number, 0);
 	}
 	return Local_u8ErrorStatus;
 }
@@ -331,17 +392,22 @@ ERRORS_t USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint8_t
  * @param  : Size   => This Parameter is Used to Pass The Size of The Buffer to Be Received Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-ERRORS_t USART_ReceiveBuffer(USART_Config_t *Config, uint8_t *ReceivedData, uint8_t Size)
+ERRORS_t USART_ReceiveBuffer(USART_Config_t *Config, uint8_t *ReceivedData, uint32_t Size)
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	uint8_t Local_u8Counter = 0;
+	uint32_t Local_u32Counter = 0;
+
+	uint16_t Local_u16Data = 0;
 
 	if ((NULL != Config) && (NULL != ReceivedData))
 	{
-		for (Local_u8Counter = 0; Local_u8Counter < Size; Local_u8Counter++)
+		for (Local_u32Counter = 0; Local_u32Counter < Size; Local_u32Counter++)
 		{
-			USART_ReceiveData(Config, (uint16_t *)&ReceivedData[Local_u8Counter]);
+			/* Receive in a Half Word Then Store One Byte , Avoids Writing Past The End of The Buffer */
+			USART_ReceiveData(Config, &Local_u16Data);
+
+			ReceivedData[Local_u32Counter] = (uint8_t)Local_u16Data;
 		}
 	}
 	else
@@ -457,21 +523,26 @@ ERRORS_t USART_SendData_IT(USART_Config_t *Configuration, uint16_t Data, void (*
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	if ((USART_WRONG_CONFIGURATION != USART_CheckConfig(Configuration)) && (NULL != pv_CallBack_Func))
+	if ((USART_WRONG_CONFIGURATION != USART_CheckConfig(Configuration)) && (NULL != pv_CallBack_Func) &&
+		USART_Handle[Configuration->USART_Number].TxSource == USART_NO_SRC && USART_Handle[Configuration->USART_Number].FifoState != USART_FIFO_EN &&
+		USART_Handle[Configuration->USART_Number].DMATxState == USART_DMA_IDLE)
 	{
 		/* Correct Cofiguration */
 
 		/* Setting IRQ_SRC */
-		IRQ_SRC[Configuration->USART_Number] = USART_SEND_DATA;
+		USART_Handle[Configuration->USART_Number].TxSource = USART_SEND_DATA;
 
 		/* Setting Call Back Function */
 		USART_PTR_TO_FUNC[Configuration->USART_Number][USART_IT_TC] = pv_CallBack_Func;
 
+		/* RS-485 Driver Enable Before The First Bit , Released on Transmission Complete */
+		USART_DriverEnable(Configuration->USART_Number, 1);
+
 		/* Send Data */
 		USART[Configuration->USART_Number]->DR = Data;
 
 		/* Enable Transmission Complete Interrupt */
-		USART[Configuration->USART_Number]->CR1 |= (1 < TRANS_CIE);
+		USART[Configuration->USART_Number]->CR1 |= (1 << TRANS_CIE);
 	}
 	else
 	{
@@ -489,28 +560,36 @@ ERRORS_t USART_SendData_IT(USART_Config_t *Configuration, uint16_t Data, void (*
  * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be Used in Interrupt Mode to be invoked when Interrupt Occurs
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint8_t BufferSize, void (*pv_CallBackFunc)(void))
+ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint32_t BufferSize, void (*pv_CallBackFunc)(void))
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
 	USART_FlagStatus_t FlagState = USART_FLAG_RESET;
 
-	if (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config))
+	if (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config) && BufferSize != 0 &&
+		USART_Handle[Config->USART_Number].TxSource == USART_NO_SRC && USART_Handle[Config->USART_Number].FifoState != USART_FIFO_EN &&
+		USART_Handle[Config->USART_Number].DMATxState == USART_DMA_IDLE)
 	{
 		if (DataBuffer != NULL && pv_CallBackFunc != NULL)
 		{
 			/* Setting IRQ Source */
-			IRQ_SRC[Config->USART_Number] = USART_SEND_BUFFER;
+			USART_Handle[Config->USART_Number].TxSource = USART_SEND_BUFFER;
 
 			/* Setting Buffer to Send Globaly */
-			USART_SentBuffer[Config->USART_Number] = DataBuffer;
+			USART_Handle[Config->USART_Number].SentBuffer = DataBuffer;
 
 			/* Setting Buffer Size Globaly */
-			USART_SentbufferSize[Config->USART_Number] = BufferSize;
+			USART_Handle[Config->USART_Number].SentSize = BufferSize;
+
+			/* First Character is Sent Here , ISR Continues From The Second One */
+			USART_Handle[Config->USART_Number].SentCounter = 1;
 
 			/* Setting Call Back Function */
 			USART_PTR_TO_FUNC[Config->USART_Number][USART_IT_TC] = pv_CallBackFunc;
 
+			/* RS-485 Driver Enable Before The First Bit , Released on Transmission Complete */
+			USART_DriverEnable(Config->USART_Number, 1);
+
 			/* Send First Character */
 			while (USART_FLAG_SET != FlagState)
 			{
@@ -542,22 +621,27 @@ ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint8_
  * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Received Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint8_t BufferSize, void(*pv_CallBackFunc))
+ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint32_t BufferSize, void(*pv_CallBackFunc))
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	if (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config))
+	if (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config) && BufferSize != 0 &&
+		USART_Handle[Config->USART_Number].RxSource == USART_NO_SRC && USART_Handle[Config->USART_Number].FifoState != USART_FIFO_EN &&
+		USART_Handle[Config->USART_Number].DMARxState == USART_DMA_IDLE)
 	{
 		if (ReceiveBuffer != NULL && pv_CallBackFunc != NULL)
 		{
 			/* Set IRQ Source */
-			IRQ_SRC[Config->USART_Number] = USART_RECEIVE_BUFFER;
+			USART_Handle[Config->USART_Number].RxSource = USART_RECEIVE_BUFFER;
 
 			/* Setting Buffer Size globally */
-			USART_ReceivebufferSize[Config->USART_Number] = BufferSize;
+			USART_Handle[Config->USART_Number].ReceivedSize = BufferSize;
+
+			/* Start Filling From The First Byte */
+			USART_Handle[Config->USART_Number].ReceivedCounter = 0;
 
 			/* Setting Buffer to Receive globally */
-			USART_ReceivedBuffer[Config->USART_Number] = ReceiveBuffer;
+			USART_Handle[Config->USART_Number].ReceivedBuffer = ReceiveBuffer;
 
 			/* Setting Call Back Function */
 			USART_PTR_TO_FUNC[Config->USART_Number][USART_IT_RXNE] = pv_CallBackFunc;
@@ -578,237 +662,1411 @@ ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer,
 }
 
 /**
- * @brief  : This Function is Used to Check The Configuration of USART Peripheral
- *
- * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Check it
+ * @brief  : This Function is Used to Send a List of Buffer Segments Back to Back Using a USART Peripheral ( Blocking Mode )
+ * @fn     : USART_SendSegments
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send Using it
+ * @param  : Segments => This Parameter is Used to Pass The Array of Segments to Be Sent in Order -> @USART_Segment_t
+ * @param  : SegmentCount => This Parameter is Used to Pass The Number of Segments in The Array
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-static ERRORS_t USART_CheckConfig(USART_Config_t *Config)
+ERRORS_t USART_SendSegments(USART_Config_t *Config, const USART_Segment_t *Segments, uint8_t SegmentCount)
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	if (Config->Mode < USART_Rx || Config->Mode > USART_Rx_Tx ||
-		Config->USART_Number < USART_PERIPH_1 || Config->USART_Number > USART_PERIPH_6 ||
-		Config->WordLength < USART_8_BITS_WIDTH || Config->WordLength > USART_9_BITS_WIDTH ||
-		Config->Oversampling < USART_OVER16 || Config->Oversampling > USART_OVER8 ||
-		Config->ParityMode < USART_PARITY_DIS || Config->ParityMode > USART_PARITY_EN_ODD ||
-		Config->IT_FlagEnable.ParityErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ParityErrorIT > USART_IT_FLAG_EN ||
-		Config->IT_FlagEnable.TDataRegEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TDataRegEmptyIT > USART_IT_FLAG_EN ||
-		Config->IT_FlagEnable.TransmissionCompleteIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TransmissionCompleteIT > USART_IT_FLAG_EN ||
-		Config->IT_FlagEnable.RDataRegNEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.RDataRegNEmptyIT > USART_IT_FLAG_EN ||
-		Config->IT_FlagEnable.IDLELineDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.IDLELineDetectedIT > USART_IT_FLAG_EN ||
-		Config->IT_FlagEnable.CTSIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.CTSIT > USART_IT_FLAG_EN ||
-		Config->IT_FlagEnable.ErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ErrorIT > USART_IT_FLAG_EN ||
-		Config->IT_FlagEnable.LINBreakDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.LINBreakDetectedIT > USART_IT_FLAG_EN ||
-		Config->StopBits < USART_ONE_SB || Config->StopBits > USART_ONE_AND_HALF_SB)
+	uint8_t Local_u8SegmentCounter = 0;
+
+	uint32_t Local_u32Counter = 0;
+
+	USART_RegDef_t *Local_pUSART = NULL;
+
+	if (Config == NULL || Segments == NULL)
 	{
-		Local_u8ErrorStatus = USART_WRONG_CONFIGURATION;
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config))
+	{
+		Local_u8ErrorStatus = USART_NOK;
 	}
+	else
+	{
+		Local_pUSART = USART[Config->USART_Number];
+
+		/* RS-485 Driver Enable Before The First Bit */
+		USART_DriverEnable(Config->USART_Number, 1);
+
+		/* Segments Are Pipelined on TXE Like One Contiguous Buffer */
+		for (Local_u8SegmentCounter = 0; Local_u8SegmentCounter < SegmentCount; Local_u8SegmentCounter++)
+		{
+			for (Local_u32Counter = 0; Local_u32Counter < Segments[Local_u8SegmentCounter].Length; Local_u32Counter++)
+			{
+				while (!((Local_pUSART->SR >> USART_TDATA_REG_EMPTY) & 1))
+					;
+
+				Local_pUSART->DR = Segments[Local_u8SegmentCounter].Data[Local_u32Counter];
+			}
+		}
+
+		/* Wait Once For The Last Byte to Leave The Shift Register */
+		while (!((Local_pUSART->SR >> USART_TRANSMISSION_COMP) & 1))
+			;
 
+		/* Release The Bus After The Last Bit */
+		USART_DriverEnable(Config->USART_Number, 0);
+	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Set The BaudRate of USART Peripheral
- *
- * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Set The BaudRate
- * @return : void
+ * @brief  : This Function is Used to Send a List of Buffer Segments Back to Back Using a USART Peripheral ( Non-Blocking Mode ) AKA Asycnchronous
+ * @fn     : USART_SendSegments_IT
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send Using it
+ * @param  : Segments => This Parameter is Used to Pass The Array of Segments to Be Sent in Order -> @USART_Segment_t
+ * @param  : SegmentCount => This Parameter is Used to Pass The Number of Segments in The Array
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when The Last Byte is Sent
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Segments Array & Their Data Must Stay Valid Until The CallBack is Invoked
  */
-static void USART_SetBaudRate(USART_Config_t *Config)
+ERRORS_t USART_SendSegments_IT(USART_Config_t *Config, const USART_Segment_t *Segments, uint8_t SegmentCount, void (*pv_CallBackFunc)(void))
 {
-	float USART_DIV = 0;
-
-	uint32_t DIV_Fraction = 0;
-
-	USART[Config->USART_Number]->BRR = 0;
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	/* BaudRate Equation */
-	USART_DIV = F_PCLK / (float)(8U * (2U - Config->Oversampling) * Config->BaudRate);
-	USART_DIV *= 1000UL;
+	if (Config == NULL || Segments == NULL || pv_CallBackFunc == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) || SegmentCount == 0 ||
+			 USART_Handle[Config->USART_Number].TxSource != USART_NO_SRC || USART_Handle[Config->USART_Number].FifoState == USART_FIFO_EN ||
+			 USART_Handle[Config->USART_Number].DMATxState != USART_DMA_IDLE)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		/* Setting IRQ Source */
+		USART_Handle[Config->USART_Number].TxSource = USART_SEND_SEGMENTS;
 
-	/* Set the Mantissa Part */
-	USART[Config->USART_Number]->BRR |= ((uint32_t)USART_DIV / 1000UL) << DIV_MANTISSA;
+		USART_Handle[Config->USART_Number].Segments.Segments = Segments;
+		USART_Handle[Config->USART_Number].Segments.Count = SegmentCount;
+		USART_Handle[Config->USART_Number].Segments.Index = 0;
+		USART_Handle[Config->USART_Number].Segments.Offset = 0;
 
-	/* Calculte the Fraction */
-	DIV_Fraction = (uint32_t)USART_DIV % 1000UL;
+		/* Setting Call Back Function */
+		USART_PTR_TO_FUNC[Config->USART_Number][USART_IT_TC] = pv_CallBackFunc;
 
-	DIV_Fraction = DIV_Fraction * (16 / (Config->Oversampling + 1));
+		/* RS-485 Driver Enable Before The First Bit , Released on Transmission Complete */
+		USART_DriverEnable(Config->USART_Number, 1);
 
-	/* get Round */
-	DIV_Fraction += 500UL;
+		/* Clear Transmission Complete Flag ( rc_w0 , Writing Ones Leaves The Other Flags Untouched ) , Its Interrupt is Enabled After The Last Byte Only */
+		USART[Config->USART_Number]->SR = (~(1 << USART_TRANSMISSION_COMP));
 
-	USART[Config->USART_Number]->BRR |= (uint32_t)(DIV_Fraction / 1000UL) << DIV_FRACTION;
+		/* Enable Transmit Data Register Empty Interrupt , Each TXE Loads The Next Byte Across Segments */
+		USART[Config->USART_Number]->CR1 |= (1 << TXEIE);
+	}
+	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Set The Parity Mode of USART Peripheral
- *
- * @param  : UsartNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
- * @param  : Parity   => This Parameter is Used to Select The Parity Mode to Be Used -> @USART_ParityMode_t
+ * @brief  : This Function is Used to Send a Buffer of Data Using a USART Peripheral & DMA ( Non-Blocking Mode ) AKA Asycnchronous
+ * @fn     : USART_SendBuffer_DMA
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send Buffer Using it
+ * @param  : DataBuffer => This Parameter is Used to Pass The Buffer of Data to Be Sent Using The USART Peripheral
+ * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Sent Using The USART Peripheral
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when The Whole Buffer is Sent
+ * @param  : pv_ErrorCallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when a DMA Transfer Error Occurs ( Can Be NULL )
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The DMA Stream IRQ of The USART TX Stream Must Be Enabled in The NVIC , Check USART DMA Mapping in USART_Program.c
+ *           Returns USART_NOK While an Interrupt , DMA or FIFO Transmission Owns The Same Peripheral
  */
-static ERRORS_t USART_SetParity(USART_t UsartNum, USART_ParityMode_t Parity)
+ERRORS_t USART_SendBuffer_DMA(USART_Config_t *Config, uint8_t *DataBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(void), void (*pv_ErrorCallBackFunc)(void))
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	if (UsartNum < USART_PERIPH_1 || UsartNum > USART_PERIPH_6 ||
-		Parity < USART_PARITY_DIS || Parity > USART_PARITY_EN_ODD)
+	if (Config == NULL || DataBuffer == NULL || pv_CallBackFunc == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) || BufferSize == 0 ||
+			 USART_Handle[Config->USART_Number].DMATxState != USART_DMA_IDLE || USART_Handle[Config->USART_Number].TxSource != USART_NO_SRC ||
+			 USART_Handle[Config->USART_Number].FifoState == USART_FIFO_EN)
 	{
 		Local_u8ErrorStatus = USART_NOK;
 	}
 	else
 	{
-		switch (Parity)
-		{
-		case USART_PARITY_DIS:
-			USART[UsartNum]->CR1 &= (~(1 << PCE));
-			break;
-		case USART_PARITY_EN_EVEN:
-			USART[UsartNum]->CR1 |= (1 << PCE);
-			USART[UsartNum]->CR1 &= (~(1 << PS));
-			break;
-		case USART_PARITY_EN_ODD:
-			USART[UsartNum]->CR1 |= (1 << PCE);
-			USART[UsartNum]->CR1 |= (1 << PS);
-			break;
-		}
+		USART_DMA_CallBack[Config->USART_Number][USART_DMA_TX] = pv_CallBackFunc;
+		USART_DMA_ErrorCallBack[Config->USART_Number][USART_DMA_TX] = pv_ErrorCallBackFunc;
+
+		Local_u8ErrorStatus = USART_StartDMA(Config->USART_Number, USART_DMA_TX, DataBuffer, BufferSize, DMA_NORMAL);
 	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Set The Mode of USART Peripheral
- *
- * @param  : UsartNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
- * @param  : Mode     => This Parameter is Used to Select The Mode to Be Used -> @USART_Mode_t
+ * @brief  : This Function is Used to Receive a Buffer of Data Using a USART Peripheral & DMA ( Non-Blocking Mode ) AKA Asycnchronous
+ * @fn     : USART_ReceiveBuffer_DMA
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Receive Buffer Using it
+ * @param  : ReceiveBuffer => This Parameter is Used to Pass The Buffer of Data to Be Received inside it Using The USART Peripheral
+ * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Received Using The USART Peripheral
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when The Whole Buffer is Received
+ * @param  : pv_ErrorCallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked when a DMA Transfer Error Occurs ( Can Be NULL )
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The DMA Stream IRQ of The USART RX Stream Must Be Enabled in The NVIC , Check USART DMA Mapping in USART_Program.c
+ *           Returns USART_NOK While an Interrupt , DMA or FIFO Reception Owns The Same Peripheral
  */
-static ERRORS_t USART_SetMode(USART_t UsartNum, USART_Mode_t Mode)
+ERRORS_t USART_ReceiveBuffer_DMA(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(void), void (*pv_ErrorCallBackFunc)(void))
 {
 	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	if (UsartNum < USART_PERIPH_1 || UsartNum > USART_PERIPH_6 ||
-		Mode < USART_Rx || Mode > USART_Rx_Tx)
+	if (Config == NULL || ReceiveBuffer == NULL || pv_CallBackFunc == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) || BufferSize == 0 ||
+			 USART_Handle[Config->USART_Number].DMARxState != USART_DMA_IDLE || USART_Handle[Config->USART_Number].RxSource != USART_NO_SRC ||
+			 USART_Handle[Config->USART_Number].FifoState == USART_FIFO_EN)
 	{
 		Local_u8ErrorStatus = USART_NOK;
 	}
 	else
 	{
-		switch (Mode)
-		{
-		case USART_Rx:
-			USART[UsartNum]->CR1 &= (~(1 << TE));
-			USART[UsartNum]->CR1 |= (1 << RE);
-			break;
-		case USART_Tx:
-			USART[UsartNum]->CR1 &= (~(1 << RE));
-			USART[UsartNum]->CR1 |= (1 << TE);
-			break;
-		case USART_Rx_Tx:
-			USART[UsartNum]->CR1 |= (1 << TE);
-			USART[UsartNum]->CR1 |= (1 << RE);
-			break;
-		}
+		USART_DMA_CallBack[Config->USART_Number][USART_DMA_RX] = pv_CallBackFunc;
+		USART_DMA_ErrorCallBack[Config->USART_Number][USART_DMA_RX] = pv_ErrorCallBackFunc;
+
+		Local_u8ErrorStatus = USART_StartDMA(Config->USART_Number, USART_DMA_RX, ReceiveBuffer, BufferSize, DMA_NORMAL);
 	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Handle The Interrupts of USART Peripheral
- * @fn	   : USART_HANDLE_IT
- * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
- * @return : void
- * @note   : This Function is Used Inside All IRQ Handlers to Handle The Interrupts ( Private Function )
+ * @brief  : This Function is Used to Start Receiving Variable Length Frames Into a Ring Buffer Using Circular DMA & IDLE Line Detection
+ * @fn     : USART_StartReceiveToIdle_DMA
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Receive Using it
+ * @param  : RingBuffer => This Parameter is Used to Pass The Ring Buffer Filled Continuously by The DMA
+ * @param  : RingSize => This Parameter is Used to Pass The Size of The Ring Buffer
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function to be invoked When New Bytes Are Reported
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : An Event is Reported When The Line Goes IDLE After a Frame & When The DMA Reaches The Half or The End of The Ring ,
+ *           Use USART_GetRxToIdleEvent Inside The CallBack to Get The New Bytes , Both The USART IRQ & The RX DMA Stream IRQ Must Be Enabled in The NVIC
+ *           Returns USART_NOK While an Interrupt , DMA or FIFO Reception Owns The Same Peripheral
  */
-static void USART_HANDLE_IT(USART_t USARTNum)
+ERRORS_t USART_StartReceiveToIdle_DMA(USART_Config_t *Config, uint8_t *RingBuffer, uint16_t RingSize, void (*pv_CallBackFunc)(void))
 {
-	USART_FlagStatus_t FlagState = USART_FLAG_RESET;
-
-	/* Read Data Register Not Empty Flag */
-	USART_ReadFlag(USARTNum, USART_RDATA_REG_NEMPTY, &FlagState);
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	if (FlagState == USART_FLAG_SET && IRQ_SRC[USARTNum] == USART_RECEIVE_DATA)
+	if (Config == NULL || RingBuffer == NULL || pv_CallBackFunc == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) || RingSize < 2 ||
+			 USART_Handle[Config->USART_Number].DMARxState != USART_DMA_IDLE || USART_Handle[Config->USART_Number].RxSource != USART_NO_SRC ||
+			 USART_Handle[Config->USART_Number].FifoState == USART_FIFO_EN)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
 	{
-		/* Clearing IRQ Source */
+		USART_Handle[Config->USART_Number].RxToIdle.RingBuffer = RingBuffer;
+		USART_Handle[Config->USART_Number].RxToIdle.RingSize = RingSize;
+		USART_Handle[Config->USART_Number].RxToIdle.LastIndex = 0;
+		USART_Handle[Config->USART_Number].RxToIdle.WriteCount = 0;
+		USART_Handle[Config->USART_Number].RxToIdle.ReadCount = 0;
 
-		IRQ_SRC[USARTNum] = USART_NO_SRC;
+		USART_DMA_CallBack[Config->USART_Number][USART_DMA_RX] = pv_CallBackFunc;
+		USART_DMA_ErrorCallBack[Config->USART_Number][USART_DMA_RX] = NULL;
 
-		/* Setting Received Data */
-		*USART_ReceivedData[USARTNum] = USART[USARTNum]->DR;
+		/* Clear a Pending IDLE Flag ( Read SR Then DR ) So The First Event Belongs to The First Frame */
+		(void)USART[Config->USART_Number]->SR;
+		(void)USART[Config->USART_Number]->DR;
 
-		/* Disable Receive Data Register Not Empty Intterupt */
-		USART[USARTNum]->CR1 &= (~(1 << RXNEIE));
+		Local_u8ErrorStatus = USART_StartDMA(Config->USART_Number, USART_DMA_RX, RingBuffer, RingSize, DMA_CIRCULAR);
 
-		/* Invoke the Call Back Function */
-		if (USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE] != NULL)
+		if (Local_u8ErrorStatus == USART_OK)
 		{
-			USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE]();
+			/* Enable IDLE Line Detected Interrupt */
+			USART[Config->USART_Number]->CR1 |= (1 << IDLEIE);
 		}
 	}
-	else if (FlagState == USART_FLAG_SET && IRQ_SRC[USARTNum] == USART_RECEIVE_BUFFER)
-	{
-		static uint8_t Local_u8Counter = 0;
+	return Local_u8ErrorStatus;
+}
 
-		/* Setting Received Data */
-		USART_ReceivedBuffer[USARTNum][Local_u8Counter++] = USART[USARTNum]->DR;
+/**
+ * @brief  : This Function is Used to Stop a Receive To IDLE Reception Started by USART_StartReceiveToIdle_DMA
+ * @fn     : USART_StopReceiveToIdle_DMA
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_StopReceiveToIdle_DMA(USART_t USARTNum)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-		if (Local_u8Counter == USART_ReceivebufferSize[USARTNum])
-		{
-			/* clear IRQ Source */
-			IRQ_SRC[USARTNum] = USART_NO_SRC;
+	if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6 || USART_Handle[USARTNum].DMARxState != USART_DMA_RX_TO_IDLE)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		/* Disable IDLE Line Detected Interrupt & DMA Request */
+		USART[USARTNum]->CR1 &= (~(1 << IDLEIE));
+		USART[USARTNum]->CR3 &= (~(1 << DMAR));
 
-			/* Disable Receive Data Register Not Empty Intterupt */
-			USART[USARTNum]->CR1 &= (~(1 << RXNEIE));
+		DMA_DisableStream(USART_DMA_MAP[USARTNum].DMAController, USART_DMA_MAP[USARTNum].RxStream);
 
-			/* Invoke the Call Back Function */
-			if (USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE] != NULL)
-			{
-				USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE]();
-			}
-		}
+		USART_Handle[USARTNum].DMARxState = USART_DMA_IDLE;
 	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get All Bytes Reported by Receive To IDLE Events Since The Previous Call
+ * @fn     : USART_GetRxToIdleEvent
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Offset => This Parameter is Used to Return The Ring Index of The First New Byte
+ * @param  : Length => This Parameter is Used to Return The Number of New Bytes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : New Bytes May Wrap Around The End of The Ring , Byte i is at RingBuffer[ ( Offset + i ) % RingSize ] , They Are Marked as Read ,
+ *           Events Not Read in Time Are Accumulated , USART_RX_OVERRUN is Returned With Length 0 IF The DMA Overwrote Unread Bytes ( They Are Dropped )
+ */
+ERRORS_t USART_GetRxToIdleEvent(USART_t USARTNum, uint16_t *Offset, uint16_t *Length)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-	FlagState = USART_FLAG_RESET;
+	USART_RxToIdle_t *Local_pRing = NULL;
 
-	/* Transmission Complete Flag */
-	USART_ReadFlag(USARTNum, USART_TRANSMISSION_COMP, &FlagState);
+	uint32_t Local_u32WriteCount = 0;
+	uint32_t Local_u32Unread = 0;
 
-	if (FlagState == USART_FLAG_SET && IRQ_SRC[USARTNum] == USART_SEND_BUFFER)
+	if (Offset == NULL || Length == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6 || USART_Handle[USARTNum].RxToIdle.RingSize == 0)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
 	{
-		static uint8_t Local_u8counter = 1;
+		Local_pRing = &USART_Handle[USARTNum].RxToIdle;
 
-		/* Send Next Data */
-		USART[USARTNum]->DR = USART_SentBuffer[USARTNum][Local_u8counter++];
+		/* Single Snapshot , The Event Handler May Advance The Write Count at Any Time */
+		Local_u32WriteCount = Local_pRing->WriteCount;
+		Local_u32Unread = Local_u32WriteCount - Local_pRing->ReadCount;
 
-		if (Local_u8counter == USART_SentbufferSize[USARTNum])
+		if (Local_u32Unread > Local_pRing->RingSize)
 		{
-			/* Clear IRQ Source */
-			IRQ_SRC[USARTNum] = USART_NO_SRC;
-
-			/* Disable Transmission Complete Interrupt */
-			USART[USARTNum]->CR1 &= (~(1 << TRANS_CIE));
+			/* The DMA Lapped The Reader , The Oldest Unread Bytes Are Gone , Restart From The Write Position */
+			*Offset = (uint16_t)(Local_u32WriteCount % Local_pRing->RingSize);
+			*Length = 0;
 
-			/* Invoke Call Back Function */
-			if (USART_PTR_TO_FUNC[USARTNum][USART_IT_TC] != NULL)
-			{
-				USART_PTR_TO_FUNC[USARTNum][USART_IT_TC]();
-			}
+			Local_u8ErrorStatus = USART_RX_OVERRUN;
+		}
+		else
+		{
+			*Offset = (uint16_t)(Local_pRing->ReadCount % Local_pRing->RingSize);
+			*Length = (uint16_t)Local_u32Unread;
 		}
+
+		Local_pRing->ReadCount = Local_u32WriteCount;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start The Interrupt Driven TX & RX FIFOs of a USART Peripheral
+ * @fn     : USART_StartFifo
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Received Bytes Are Stored in The RX FIFO Continuously , The USART IRQ Must Be Enabled in The NVIC
+ *           Returns USART_NOK While an Interrupt or DMA Transfer is in Progress in Either Direction
+ */
+ERRORS_t USART_StartFifo(USART_Config_t *Config)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (Config == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) ||
+			 USART_Handle[Config->USART_Number].TxSource != USART_NO_SRC || USART_Handle[Config->USART_Number].RxSource != USART_NO_SRC ||
+			 USART_Handle[Config->USART_Number].DMATxState != USART_DMA_IDLE || USART_Handle[Config->USART_Number].DMARxState != USART_DMA_IDLE)
+	{
+		Local_u8ErrorStatus = USART_NOK;
 	}
-	else if (FlagState == USART_FLAG_SET && IRQ_SRC[USARTNum] == USART_SEND_DATA)
+	else
 	{
-		/* Clear IRQ Source */
-		IRQ_SRC[USARTNum] = USART_NO_SRC;
+		USART_Handle[Config->USART_Number].TxFifo.Buffer = USART_TxFifoBuffer[Config->USART_Number];
+		USART_Handle[Config->USART_Number].TxFifo.Mask = USART_TX_FIFO_SIZE - 1;
+		USART_Handle[Config->USART_Number].TxFifo.Head = 0;
+		USART_Handle[Config->USART_Number].TxFifo.Tail = 0;
 
-		/* Disable Transmission Complete Interrupt */
-		USART[USARTNum]->CR1 &= (~(1 << TRANS_CIE));
+		USART_Handle[Config->USART_Number].RxFifo.Buffer = USART_RxFifoBuffer[Config->USART_Number];
+		USART_Handle[Config->USART_Number].RxFifo.Mask = USART_RX_FIFO_SIZE - 1;
+		USART_Handle[Config->USART_Number].RxFifo.Head = 0;
+		USART_Handle[Config->USART_Number].RxFifo.Tail = 0;
 
-		/* Invoke Call Back Function */
-		if (USART_PTR_TO_FUNC[USARTNum][USART_IT_TC] != NULL)
-		{
-			USART_PTR_TO_FUNC[USARTNum][USART_IT_TC]();
-		}
+		USART_Handle[Config->USART_Number].FifoState = USART_FIFO_EN;
+
+		/* Enable Receive Data Register Not Empty Interrupt , TXE Interrupt is Enabled Only While TX FIFO Has Data */
+		USART[Config->USART_Number]->CR1 |= (1 << RXNEIE);
 	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stop The Interrupt Driven TX & RX FIFOs of a USART Peripheral
+ * @fn     : USART_StopFifo
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Bytes Still Queued in The TX FIFO Are Discarded
+ */
+ERRORS_t USART_StopFifo(USART_t USARTNum)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6 || USART_Handle[USARTNum].FifoState != USART_FIFO_EN)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		USART[USARTNum]->CR1 &= (~((1 << RXNEIE) | (1 << TXEIE)));
+
+		USART_Handle[USARTNum].FifoState = USART_FIFO_DIS;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Queue Bytes in The TX FIFO Without Blocking
+ * @fn     : USART_FifoWrite
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Data => This Parameter is Used to Pass The Bytes to Be Sent
+ * @param  : Length => This Parameter is Used to Pass The Number of Bytes to Be Sent
+ * @param  : Written => This Parameter is Used to Return The Number of Bytes Actually Queued ( Less Than Length When The FIFO is Full )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Single Producer , Only One Context Should Write to The Same USART
+ */
+ERRORS_t USART_FifoWrite(USART_t USARTNum, const uint8_t *Data, uint16_t Length, uint16_t *Written)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	USART_FIFO_t *Local_pFifo = NULL;
+
+	uint16_t Local_u16Head = 0;
+	uint16_t Local_u16Free = 0;
+	uint16_t Local_u16Counter = 0;
+
+	if (Data == NULL || Written == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6 || USART_Handle[USARTNum].FifoState != USART_FIFO_EN)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		Local_pFifo = &USART_Handle[USARTNum].TxFifo;
+
+		/* Producer Owns Head , Tail is Only Read Once */
+		Local_u16Head = Local_pFifo->Head;
+		Local_u16Free = (uint16_t)(USART_TX_FIFO_SIZE - (uint16_t)(Local_u16Head - Local_pFifo->Tail));
+
+		if (Length > Local_u16Free)
+		{
+			Length = Local_u16Free;
+		}
+
+		for (Local_u16Counter = 0; Local_u16Counter < Length; Local_u16Counter++)
+		{
+			Local_pFifo->Buffer[(uint16_t)(Local_u16Head + Local_u16Counter) & Local_pFifo->Mask] = Data[Local_u16Counter];
+		}
+
+		/* Publish The New Bytes After They Are Stored */
+		Local_pFifo->Head = (uint16_t)(Local_u16Head + Length);
+
+		*Written = Length;
+
+		/* Let The ISR Drain The FIFO , Driver Enable Comes After Publishing So The ISR Never Releases The Bus With Bytes Queued */
+		if (Length != 0)
+		{
+			USART_DriverEnable(USARTNum, 1);
+
+			USART[USARTNum]->CR1 |= (1 << TXEIE);
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Read Received Bytes From The RX FIFO Without Blocking
+ * @fn     : USART_FifoRead
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Data => This Parameter is Used to Pass The Buffer to Copy The Received Bytes Into
+ * @param  : Length => This Parameter is Used to Pass The Maximum Number of Bytes to Read
+ * @param  : ReadLength => This Parameter is Used to Return The Number of Bytes Actually Read
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Single Consumer , Only One Context Should Read From The Same USART
+ */
+ERRORS_t USART_FifoRead(USART_t USARTNum, uint8_t *Data, uint16_t Length, uint16_t *ReadLength)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	USART_FIFO_t *Local_pFifo = NULL;
+
+	uint16_t Local_u16Tail = 0;
+	uint16_t Local_u16Available = 0;
+	uint16_t Local_u16Counter = 0;
+
+	if (Data == NULL || ReadLength == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6 || USART_Handle[USARTNum].FifoState != USART_FIFO_EN)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		Local_pFifo = &USART_Handle[USARTNum].RxFifo;
+
+		/* Consumer Owns Tail , Head is Only Read Once */
+		Local_u16Tail = Local_pFifo->Tail;
+		Local_u16Available = (uint16_t)(Local_pFifo->Head - Local_u16Tail);
+
+		if (Length > Local_u16Available)
+		{
+			Length = Local_u16Available;
+		}
+
+		for (Local_u16Counter = 0; Local_u16Counter < Length; Local_u16Counter++)
+		{
+			Data[Local_u16Counter] = Local_pFifo->Buffer[(uint16_t)(Local_u16Tail + Local_u16Counter) & Local_pFifo->Mask];
+		}
+
+		/* Release The Space After The Bytes Are Copied */
+		Local_pFifo->Tail = (uint16_t)(Local_u16Tail + Length);
+
+		*ReadLength = Length;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Number of Received Bytes Waiting in The RX FIFO
+ * @fn     : USART_FifoAvailable
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Available => This Parameter is Used to Return The Number of Bytes Ready to Be Read
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_FifoAvailable(USART_t USARTNum, uint16_t *Available)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (Available == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6 || USART_Handle[USARTNum].FifoState != USART_FIFO_EN)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		*Available = (uint16_t)(USART_Handle[USARTNum].RxFifo.Head - USART_Handle[USARTNum].RxFifo.Tail);
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Configure The Mute Mode Wakeup Method & Node Address of a USART Peripheral
+ * @fn     : USART_SetMuteMode
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @param  : WakeUp => This Parameter is Used to Select The Wakeup Method -> @USART_WakeUp_t
+ * @param  : Address => This Parameter is Used to Pass The Node Address ( 0 -> 15 ) , Used With Address Mark Wakeup Only
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Receiver is Not Muted Here , Call USART_EnterMuteMode When The Node Has to Ignore The Bus
+ */
+ERRORS_t USART_SetMuteMode(USART_Config_t *Config, USART_WakeUp_t WakeUp, uint8_t Address)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (Config == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) ||
+			 WakeUp < USART_WAKEUP_IDLE_LINE || WakeUp > USART_WAKEUP_ADDRESS_MARK || Address > USART_ADDRESS_MASK)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		/* Set Node Address */
+		USART[Config->USART_Number]->CR2 &= (~(USART_ADDRESS_MASK << ADD));
+		USART[Config->USART_Number]->CR2 |= (Address << ADD);
+
+		/* Set Wakeup Method */
+		USART[Config->USART_Number]->CR1 &= (~(1 << WAKE));
+		USART[Config->USART_Number]->CR1 |= (WakeUp << WAKE);
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Mute The Receiver of a USART Peripheral
+ * @fn     : USART_EnterMuteMode
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : With IDLE Line Wakeup The Receiver Must Have Received a Byte Before Muting , Otherwise The Current IDLE Line Unmutes it at Once
+ */
+ERRORS_t USART_EnterMuteMode(USART_t USARTNum)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		USART[USARTNum]->CR1 |= (1 << RWU);
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Unmute The Receiver of a USART Peripheral
+ * @fn     : USART_ExitMuteMode
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_ExitMuteMode(USART_t USARTNum)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		USART[USARTNum]->CR1 &= (~(1 << RWU));
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send an Address Byte Waking Up The Node Having This Address ( Blocking Mode )
+ * @fn     : USART_SendAddress
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send Using it
+ * @param  : Address => This Parameter is Used to Pass The Destination Node Address ( 0 -> 15 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Address Mark ( Most Significant Data Bit ) is Set by The Driver According to The Word Length & Parity
+ */
+ERRORS_t USART_SendAddress(USART_Config_t *Config, uint8_t Address)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	uint8_t Local_u8MarkBit = 0;
+
+	if (Config == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Address > USART_ADDRESS_MASK)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		/* Address Mark is The MSB of The Data , The Bit Before Parity When Parity is Enabled */
+		Local_u8MarkBit = (Config->WordLength == USART_9_BITS_WIDTH) ? 8 : 7;
+
+		if (Config->ParityMode != USART_PARITY_DIS)
+		{
+			Local_u8MarkBit--;
+		}
+
+		Local_u8ErrorStatus = USART_SendData(Config, (uint16_t)((1 << Local_u8MarkBit) | Address));
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set The RS-485 Driver Enable Pin Driven by The USART Driver Around Each Transmission
+ * @fn     : USART_SetDriverEnablePin
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Port => This Parameter is Used to Select The Driver Enable Pin Port -> @Port_t
+ * @param  : Pin => This Parameter is Used to Select The Driver Enable Pin Number -> @Pin_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Pin is Configured as Push Pull Output & Driven Low ( Receive ) , It is Driven High Before The First Byte & Low After
+ *           Transmission Complete of The Last Byte , For DMA & FIFO Transmissions The USART IRQ Must Be Enabled in The NVIC
+ */
+ERRORS_t USART_SetDriverEnablePin(USART_t USARTNum, uint8_t Port, uint8_t Pin)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	GPIO_PinConfig_t Local_DEPin = {0};
+
+	if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6 || Port > PORTH || Pin > PIN15)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		Local_DEPin.Port = (Port_t)Port;
+		Local_DEPin.PinNum = (Pin_t)Pin;
+		Local_DEPin.Mode = OUTPUT;
+		Local_DEPin.Speed = MEDIUM_SPEED;
+		Local_DEPin.OutputType = PUSH_PULL;
+		Local_DEPin.PullType = NO_PULL;
+
+		if (OK != GPIO_u8PinInit(&Local_DEPin) || OK != GPIO_u8SetPinValue((Port_t)Port, (Pin_t)Pin, PIN_LOW))
+		{
+			Local_u8ErrorStatus = USART_NOK;
+		}
+		else
+		{
+			USART_Handle[USARTNum].DEPort = Port;
+			USART_Handle[USARTNum].DEPin = Pin;
+			USART_Handle[USARTNum].DEState = USART_DE_EN;
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Calculate The Baud Rate Register Value Closest to a Requested Baud Rate Using Integer Math Only
+ * @fn     : USART_CalculateBaudRate
+ * @param  : PeripheralClock => This Parameter is Used to Pass The APB Clock Feeding The USART in Hz
+ * @param  : BaudRate => This Parameter is Used to Pass The Requested Baud Rate in bps
+ * @param  : Oversampling => This Parameter is Used to Select The Oversampling , USART_OVER_AUTO Evaluates Both -> @USART_Oversampling_t
+ * @param  : Info => This Parameter is Used to Return The Register Value , Achieved Baud Rate & Error -> @USART_BaudRateInfo_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Nothing is Written to The Peripheral , Use it to Check a Baud Rate Before USART_Init
+ */
+ERRORS_t USART_CalculateBaudRate(uint32_t PeripheralClock, uint32_t BaudRate, USART_Oversampling_t Oversampling, USART_BaudRateInfo_t *Info)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	uint32_t Local_u32Div16 = 0;
+	uint32_t Local_u32Div8 = 0;
+
+	int32_t Local_s32Error16 = 0;
+	int32_t Local_s32Error8 = 0;
+
+	if (Info == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (PeripheralClock == 0 || BaudRate == 0 || Oversampling < USART_OVER16 || Oversampling > USART_OVER_AUTO)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		/* Baud = Clock / Div With Div = 16 * USARTDIV ( OVER16 ) or 8 * USARTDIV ( OVER8 ) , Only The Allowed Range Differs */
+		Local_u32Div16 = USART_BestDivider(PeripheralClock, BaudRate, USART_OVER16_MIN_DIV, USART_OVER16_MAX_DIV, &Local_s32Error16);
+		Local_u32Div8 = USART_BestDivider(PeripheralClock, BaudRate, USART_OVER8_MIN_DIV, USART_OVER8_MAX_DIV, &Local_s32Error8);
+
+		if (Oversampling == USART_OVER_AUTO)
+		{
+			/* OVER16 Tolerates More Clock Deviation & Noise , OVER8 Only Wins With a Strictly Lower Error */
+			Oversampling = (((Local_s32Error8 < 0) ? -Local_s32Error8 : Local_s32Error8) < ((Local_s32Error16 < 0) ? -Local_s32Error16 : Local_s32Error16)) ? USART_OVER8 : USART_OVER16;
+		}
+
+		if (Oversampling == USART_OVER16)
+		{
+			/* Mantissa in [15:4] & 4 Bits Fraction in [3:0] , Which is The Divider Itself */
+			Info->BRR = (uint16_t)Local_u32Div16;
+			Info->ErrorPPM = Local_s32Error16;
+			Info->AchievedBaudRate = (PeripheralClock + (Local_u32Div16 / 2U)) / Local_u32Div16;
+		}
+		else
+		{
+			/* Mantissa in [15:4] & 3 Bits Fraction in [2:0] , Bit 3 Must Stay Cleared */
+			Info->BRR = (uint16_t)(((Local_u32Div8 >> 3) << DIV_MANTISSA) | (Local_u32Div8 & 0x7U));
+			Info->ErrorPPM = Local_s32Error8;
+			Info->AchievedBaudRate = (PeripheralClock + (Local_u32Div8 / 2U)) / Local_u32Div8;
+		}
+
+		Info->Oversampling = Oversampling;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Baud Rate Programmed by The Last USART_Init
+ * @fn     : USART_GetBaudRateInfo
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Info => This Parameter is Used to Return The Register Value , Achieved Baud Rate & Error -> @USART_BaudRateInfo_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_GetBaudRateInfo(USART_t USARTNum, USART_BaudRateInfo_t *Info)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (Info == NULL)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_6)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		*Info = USART_Handle[USARTNum].BaudRate;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Configure & Start The DMA Stream of a USART Peripheral in One Direction
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Direction => This Parameter is Used to Select The Transfer Direction -> @USART_DMA_DIR_t
+ * @param  : Buffer => This Parameter is Used to Pass The Memory Buffer to Be Sent From or Received Into
+ * @param  : BufferSize => This Parameter is Used to Pass The Number of Bytes to Be Transferred
+ * @param  : Mode => This Parameter is Used to Select Normal or Circular DMA Mode -> @DMA_MODE_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Private Function Used Inside USART_SendBuffer_DMA & USART_ReceiveBuffer_DMA After Checking Their Arguments
+ */
+static ERRORS_t USART_StartDMA(USART_t USARTNum, USART_DMA_DIR_t Direction, uint8_t *Buffer, uint16_t BufferSize, DMA_MODE_t Mode)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	DMA_INIT_STRUCT_t *Local_pDMAConfig = (Direction == USART_DMA_TX) ? &USART_DMA_TxConfig[USARTNum] : &USART_DMA_RxConfig[USARTNum];
+
+	Local_pDMAConfig->DMAController = USART_DMA_MAP[USARTNum].DMAController;
+	Local_pDMAConfig->StreamNumber = (Direction == USART_DMA_TX) ? USART_DMA_MAP[USARTNum].TxStream : USART_DMA_MAP[USARTNum].RxStream;
+	Local_pDMAConfig->ChannelNumber = USART_DMA_MAP[USARTNum].ChannelNumber;
+	Local_pDMAConfig->PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER;
+	Local_pDMAConfig->MemBurst = DMA_MEM_SINGLE_TRANSFER;
+	Local_pDMAConfig->Priority = (Direction == USART_DMA_TX) ? DMA_HIGH_PRIORITY : DMA_VERY_HIGH_PRIORITY;
+	Local_pDMAConfig->MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS;
+	Local_pDMAConfig->PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS;
+	Local_pDMAConfig->MemInc = DMA_MINC_ENABLE;
+	Local_pDMAConfig->PeriphInc = DMA_PINC_DISABLE;
+	Local_pDMAConfig->Mode = Mode;
+	Local_pDMAConfig->DoubleBuffer = DMA_DOUBLE_BUFFER_DIS;
+	Local_pDMAConfig->Direction = (Direction == USART_DMA_TX) ? DMA_MEM_TO_PERIPH : DMA_PERIPH_TO_MEM;
+	Local_pDMAConfig->EnableIT.FIFOErrorIT = DMA_INT_DISABLE;
+	Local_pDMAConfig->EnableIT.DirectModeErrorIT = DMA_INT_DISABLE;
+
+	/* Circular Mode Reports Half & Full Ring Events Instead of Errors ( Remaining Count Can Not Tell Them Apart in This Mode ) */
+	Local_pDMAConfig->EnableIT.TransferErrorIT = (Mode == DMA_NORMAL) ? DMA_INT_ENABLE : DMA_INT_DISABLE;
+	Local_pDMAConfig->EnableIT.HalfTransferIT = (Mode == DMA_NORMAL) ? DMA_INT_DISABLE : DMA_INT_ENABLE;
+	Local_pDMAConfig->EnableIT.TransferCompleteIT = DMA_INT_ENABLE;
+	Local_pDMAConfig->FIFOMode = DMA_FIFOMODE_DISABLE;
+	Local_pDMAConfig->FIFOThreshold = DMA_FIFO_THRESHOLD_HALF_FULL;
+
+	if (DMA_OK != DMA_Init(Local_pDMAConfig))
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		/* Same Handler For Both Events , It Tells Them Apart Using The Remaining Data Count */
+		DMA_SetCallBack(Local_pDMAConfig, DMA_TRANSFER_CMP_CALLBACK, USART_DMA_Handler[USARTNum][Direction]);
+		DMA_SetCallBack(Local_pDMAConfig, DMA_TRANSFER_ERROR_CALLBACK, USART_DMA_Handler[USARTNum][Direction]);
+
+		/* Half Ring Events Exist in Circular Mode Only , a Normal Transfer Must Report Its Completion Once */
+		if (Mode == DMA_CIRCULAR)
+		{
+			DMA_SetCallBack(Local_pDMAConfig, DMA_HALF_TRANSFER_CALLBACK, USART_DMA_Handler[USARTNum][Direction]);
+		}
+
+		/* Clear Flags Left From Previous Transfers Before Enabling The Stream */
+		DMA_ClearInterruptFlag(Local_pDMAConfig->DMAController, Local_pDMAConfig->StreamNumber, TRANSFER_COMPLETE_IT_FLAG);
+		DMA_ClearInterruptFlag(Local_pDMAConfig->DMAController, Local_pDMAConfig->StreamNumber, HALF_TRANSFER_IT_FLAG);
+		DMA_ClearInterruptFlag(Local_pDMAConfig->DMAController, Local_pDMAConfig->StreamNumber, TRANSFER_ERROR_IT_FLAG);
+
+		if (Direction == USART_DMA_TX)
+		{
+			USART_Handle[USARTNum].DMATxState = USART_DMA_BUSY;
+
+			/* RS-485 Driver Enable Before The First Bit , Released on Transmission Complete */
+			USART_DriverEnable(USARTNum, 1);
+
+			/* Clear Transmission Complete Flag ( rc_w0 , Writing Ones Leaves The Other Flags Untouched ) Then Let The DMA Feed The Data Register */
+			USART[USARTNum]->SR = (~(1 << USART_TRANSMISSION_COMP));
+
+			DMA_StartTransfer(Local_pDMAConfig, (uint32_t *)Buffer, (uint32_t *)&(USART[USARTNum]->DR), BufferSize);
+
+			USART[USARTNum]->CR3 |= (1 << DMAT);
+		}
+		else
+		{
+			USART_Handle[USARTNum].DMARxState = (Mode == DMA_NORMAL) ? USART_DMA_BUSY : USART_DMA_RX_TO_IDLE;
+
+			DMA_StartTransfer(Local_pDMAConfig, (uint32_t *)&(USART[USARTNum]->DR), (uint32_t *)Buffer, BufferSize);
+
+			USART[USARTNum]->CR3 |= (1 << DMAR);
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Check The Configuration of USART Peripheral
+ *
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Check it
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t USART_CheckConfig(USART_Config_t *Config)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (Config->Mode < USART_Rx || Config->Mode > USART_Rx_Tx ||
+		Config->USART_Number < USART_PERIPH_1 || Config->USART_Number > USART_PERIPH_6 ||
+		Config->WordLength < USART_8_BITS_WIDTH || Config->WordLength > USART_9_BITS_WIDTH ||
+		Config->Oversampling < USART_OVER16 || Config->Oversampling > USART_OVER_AUTO ||
+		Config->ParityMode < USART_PARITY_DIS || Config->ParityMode > USART_PARITY_EN_ODD ||
+		Config->IT_FlagEnable.ParityErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ParityErrorIT > USART_IT_FLAG_EN ||
+		Config->IT_FlagEnable.TDataRegEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TDataRegEmptyIT > USART_IT_FLAG_EN ||
+		Config->IT_FlagEnable.TransmissionCompleteIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TransmissionCompleteIT > USART_IT_FLAG_EN ||
+		Config->IT_FlagEnable.RDataRegNEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.RDataRegNEmptyIT > USART_IT_FLAG_EN ||
+		Config->IT_FlagEnable.IDLELineDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.IDLELineDetectedIT > USART_IT_FLAG_EN ||
+		Config->IT_FlagEnable.CTSIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.CTSIT > USART_IT_FLAG_EN ||
+		Config->IT_FlagEnable.ErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ErrorIT > USART_IT_FLAG_EN ||
+		Config->IT_FlagEnable.LINBreakDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.LINBreakDetectedIT > USART_IT_FLAG_EN ||
+		Config->StopBits < USART_ONE_SB || Config->StopBits > USART_ONE_AND_HALF_SB)
+	{
+		Local_u8ErrorStatus = USART_WRONG_CONFIGURATION;
+	}
+
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set The BaudRate & Oversampling of USART Peripheral
+ *
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Set The BaudRate
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Nothing is Written IF The Error Exceeds USART_BAUD_MAX_ERROR_PPM
+ */
+static ERRORS_t USART_SetBaudRate(USART_Config_t *Config)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	USART_BaudRateInfo_t Local_Info = {0};
+
+	uint32_t Local_u32Clock = (Config->PeripheralClock != 0) ? Config->PeripheralClock : F_PCLK;
+
+	if (USART_OK != USART_CalculateBaudRate(Local_u32Clock, Config->BaudRate, Config->Oversampling, &Local_Info) ||
+		Local_Info.ErrorPPM > USART_BAUD_MAX_ERROR_PPM || Local_Info.ErrorPPM < -USART_BAUD_MAX_ERROR_PPM)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		/* Set OverSampling Rate */
+		USART[Config->USART_Number]->CR1 &= (USART_OVER8_MASK);
+		USART[Config->USART_Number]->CR1 |= (Local_Info.Oversampling << OVER8);
+
+		USART[Config->USART_Number]->BRR = Local_Info.BRR;
+
+		USART_Handle[Config->USART_Number].BaudRate = Local_Info;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Find The Divider ( Clock / BaudRate ) Closest to The Requested Baud Rate Within a Range
+ *
+ * @param  : PeripheralClock => This Parameter is Used to Pass The USART Clock in Hz
+ * @param  : BaudRate => This Parameter is Used to Pass The Requested Baud Rate in bps
+ * @param  : MinDiv => This Parameter is Used to Pass The Smallest Divider Allowed by The Oversampling
+ * @param  : MaxDiv => This Parameter is Used to Pass The Largest Divider Allowed by The Oversampling
+ * @param  : ErrorPPM => This Parameter is Used to Return The Error of The Selected Divider in ppm
+ * @return : uint32_t => The Selected Divider , Equal to 16 * USARTDIV With OVER16 & 8 * USARTDIV With OVER8
+ * @note   : Both Neighbours of Clock / BaudRate Are Tried , Out of Range Dividers Are Clamped & Reported With Their Real Error
+ */
+static uint32_t USART_BestDivider(uint32_t PeripheralClock, uint32_t BaudRate, uint32_t MinDiv, uint32_t MaxDiv, int32_t *ErrorPPM)
+{
+	uint32_t Local_u32Div[2] = {0};
+
+	int32_t Local_s32Error[2] = {0};
+
+	uint8_t Local_u8Counter = 0;
+
+	/* Round Down & Round Up Candidates */
+	Local_u32Div[0] = PeripheralClock / BaudRate;
+	Local_u32Div[1] = Local_u32Div[0] + 1U;
+
+	for (Local_u8Counter = 0; Local_u8Counter < 2; Local_u8Counter++)
+	{
+		if (Local_u32Div[Local_u8Counter] < MinDiv)
+		{
+			Local_u32Div[Local_u8Counter] = MinDiv;
+		}
+		else if (Local_u32Div[Local_u8Counter] > MaxDiv)
+		{
+			Local_u32Div[Local_u8Counter] = MaxDiv;
+		}
+
+		/* Achieved = Clock / Div , Error = Achieved / Requested - 1 */
+		Local_s32Error[Local_u8Counter] = (int32_t)(((uint64_t)PeripheralClock * 1000000ULL) / ((uint64_t)Local_u32Div[Local_u8Counter] * BaudRate)) - 1000000L;
+	}
+
+	Local_u8Counter = (((Local_s32Error[1] < 0) ? -Local_s32Error[1] : Local_s32Error[1]) < ((Local_s32Error[0] < 0) ? -Local_s32Error[0] : Local_s32Error[0])) ? 1 : 0;
+
+	*ErrorPPM = Local_s32Error[Local_u8Counter];
+
+	return Local_u32Div[Local_u8Counter];
+}
+
+/**
+ * @brief  : This Function is Used to Set The Parity Mode of USART Peripheral
+ *
+ * @param  : UsartNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Parity   => This Parameter is Used to Select The Parity Mode to Be Used -> @USART_ParityMode_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t USART_SetParity(USART_t UsartNum, USART_ParityMode_t Parity)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (UsartNum < USART_PERIPH_1 || UsartNum > USART_PERIPH_6 ||
+		Parity < USART_PARITY_DIS || Parity > USART_PARITY_EN_ODD)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		switch (Parity)
+		{
+		case USART_PARITY_DIS:
+			USART[UsartNum]->CR1 &= (~(1 << PCE));
+			break;
+		case USART_PARITY_EN_EVEN:
+			USART[UsartNum]->CR1 |= (1 << PCE);
+			USART[UsartNum]->CR1 &= (~(1 << PS));
+			break;
+		case USART_PARITY_EN_ODD:
+			USART[UsartNum]->CR1 |= (1 << PCE);
+			USART[UsartNum]->CR1 |= (1 << PS);
+			break;
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set The Mode of USART Peripheral
+ *
+ * @param  : UsartNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Mode     => This Parameter is Used to Select The Mode to Be Used -> @USART_Mode_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t USART_SetMode(USART_t UsartNum, USART_Mode_t Mode)
+{
+	ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+	if (UsartNum < USART_PERIPH_1 || UsartNum > USART_PERIPH_6 ||
+		Mode < USART_Rx || Mode > USART_Rx_Tx)
+	{
+		Local_u8ErrorStatus = USART_NOK;
+	}
+	else
+	{
+		switch (Mode)
+		{
+		case USART_Rx:
+			USART[UsartNum]->CR1 &= (~(1 << TE));
+			USART[UsartNum]->CR1 |= (1 << RE);
+			break;
+		case USART_Tx:
+			USART[UsartNum]->CR1 &= (~(1 << RE));
+			USART[UsartNum]->CR1 |= (1 << TE);
+			break;
+		case USART_Rx_Tx:
+			USART[UsartNum]->CR1 |= (1 << TE);
+			USART[UsartNum]->CR1 |= (1 << RE);
+			break;
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Handle The Interrupts of USART Peripheral
+ * @fn	   : USART_HANDLE_IT
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : void
+ * @note   : This Function is Used Inside All IRQ Handlers to Handle The Interrupts ( Private Function )
+ */
+static void USART_HANDLE_IT(USART_t USARTNum)
+{
+	USART_RegDef_t *Local_pUSART = USART[USARTNum];
+
+	USART_Handle_t *Local_pHandle = &USART_Handle[USARTNum];
+
+	/* Status Register is Read Once Per Entry , All Flags Below Are Tested on This Copy */
+	uint32_t Local_u32Status = Local_pUSART->SR;
+
+	/* Interrupts Enabled on Entry , a Flag is Serviced Only IF Its Interrupt is Enabled */
+	uint32_t Local_u32Control = Local_pUSART->CR1;
+
+	/* IDLE Line Detected While Receiving To IDLE Using DMA */
+	if (((Local_u32Status >> USART_IDLE_LINE_DETECT) & 1) && Local_pHandle->DMARxState == USART_DMA_RX_TO_IDLE)
+	{
+		/* Clear IDLE Flag ( SR Already Read , Then Read DR ) */
+		(void)Local_pUSART->DR;
+
+		USART_RxToIdleEvent(USARTNum);
+	}
+
+	/* Receive Data Register Not Empty */
+	if (((Local_u32Status >> USART_RDATA_REG_NEMPTY) & 1) && ((Local_u32Control >> RXNEIE) & 1))
+	{
+		if (Local_pHandle->RxSource == USART_RECEIVE_DATA)
+		{
+			/* Clearing IRQ Source */
+			Local_pHandle->RxSource = USART_NO_SRC;
+
+			/* Setting Received Data */
+			*Local_pHandle->ReceivedData = Local_pUSART->DR;
+
+			/* Disable Receive Data Register Not Empty Intterupt */
+			Local_pUSART->CR1 &= (~(1 << RXNEIE));
+
+			/* Invoke the Call Back Function */
+			if (USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE] != NULL)
+			{
+				USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE]();
+			}
+		}
+		else if (Local_pHandle->RxSource == USART_RECEIVE_BUFFER)
+		{
+			/* Setting Received Data */
+			Local_pHandle->ReceivedBuffer[Local_pHandle->ReceivedCounter++] = Local_pUSART->DR;
+
+			if (Local_pHandle->ReceivedCounter == Local_pHandle->ReceivedSize)
+			{
+				/* clear IRQ Source */
+				Local_pHandle->RxSource = USART_NO_SRC;
+
+				/* Disable Receive Data Register Not Empty Intterupt */
+				Local_pUSART->CR1 &= (~(1 << RXNEIE));
+
+				/* Invoke the Call Back Function */
+				if (USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE] != NULL)
+				{
+					USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE]();
+				}
+			}
+		}
+		else if (Local_pHandle->FifoState == USART_FIFO_EN)
+		{
+			/* Store Received Byte in RX FIFO , Dropped IF The FIFO is Full ( Reading DR Clears RXNE Anyway ) */
+			uint8_t Local_u8Data = (uint8_t)Local_pUSART->DR;
+
+			if ((uint16_t)(Local_pHandle->RxFifo.Head - Local_pHandle->RxFifo.Tail) < USART_RX_FIFO_SIZE)
+			{
+				Local_pHandle->RxFifo.Buffer[Local_pHandle->RxFifo.Head & Local_pHandle->RxFifo.Mask] = Local_u8Data;
+				Local_pHandle->RxFifo.Head++;
+			}
+		}
+	}
+	else if (((Local_u32Status >> USART_OVERRNUN_ERROR) & 1) && ((Local_u32Control >> RXNEIE) & 1))
+	{
+		/* Overrun Without Pending Data Keeps The Interrupt Pending , Clear it ( SR Already Read , Then Read DR ) */
+		(void)Local_pUSART->DR;
+	}
+
+	/* Transmit Data Register Empty */
+	if (((Local_u32Status >> USART_TDATA_REG_EMPTY) & 1) && ((Local_u32Control >> TXEIE) & 1))
+	{
+		if (Local_pHandle->FifoState == USART_FIFO_EN)
+		{
+			if (Local_pHandle->TxFifo.Head != Local_pHandle->TxFifo.Tail)
+			{
+				/* Send Next Byte */
+				Local_pUSART->DR = Local_pHandle->TxFifo.Buffer[Local_pHandle->TxFifo.Tail & Local_pHandle->TxFifo.Mask];
+				Local_pHandle->TxFifo.Tail++;
+			}
+			else
+			{
+				/* TX FIFO is Empty , Disable Transmit Data Register Empty Interrupt Until The Next Write */
+				Local_pUSART->CR1 &= (~(1 << TXEIE));
+
+				/* Release The RS-485 Bus Once The Last Byte Leaves The Shift Register */
+				if (Local_pHandle->DEState == USART_DE_EN)
+				{
+					Local_pUSART->CR1 |= (1 << TRANS_CIE);
+				}
+			}
+		}
+		else if (Local_pHandle->TxSource == USART_SEND_SEGMENTS)
+		{
+			USART_SendNextSegmentByte(USARTNum);
+		}
+	}
+
+	/* Transmission Complete */
+	if (((Local_u32Status >> USART_TRANSMISSION_COMP) & 1) && ((Local_u32Control >> TRANS_CIE) & 1))
+	{
+		if (Local_pHandle->TxSource == USART_SEND_BUFFER && Local_pHandle->SentCounter < Local_pHandle->SentSize)
+		{
+			/* Send Next Data */
+			Local_pUSART->DR = Local_pHandle->SentBuffer[Local_pHandle->SentCounter++];
+		}
+		else if (Local_pHandle->TxSource != USART_NO_SRC)
+		{
+			/* Last Character is Sent ( Buffer , Segments or Single Data ) , Clear IRQ Source */
+			Local_pHandle->TxSource = USART_NO_SRC;
+
+			/* Disable Transmission Complete Interrupt & Release The RS-485 Bus */
+			Local_pUSART->CR1 &= (~(1 << TRANS_CIE));
+
+			USART_DriverEnable(USARTNum, 0);
+
+			/* Invoke Call Back Function */
+			if (USART_PTR_TO_FUNC[USARTNum][USART_IT_TC] != NULL)
+			{
+				USART_PTR_TO_FUNC[USARTNum][USART_IT_TC]();
+			}
+		}
+		else if (Local_pHandle->DMATxState == USART_DMA_TX_DRAINING)
+		{
+			/* Last DMA Byte Left The Shift Register , Release The RS-485 Bus Then Report Completion */
+			Local_pUSART->CR1 &= (~(1 << TRANS_CIE));
+
+			USART_DriverEnable(USARTNum, 0);
+
+			Local_pHandle->DMATxState = USART_DMA_IDLE;
+
+			if (USART_DMA_CallBack[USARTNum][USART_DMA_TX] != NULL)
+			{
+				USART_DMA_CallBack[USARTNum][USART_DMA_TX]();
+			}
+		}
+		else if (Local_pHandle->FifoState == USART_FIFO_EN)
+		{
+			Local_pUSART->CR1 &= (~(1 << TRANS_CIE));
+
+			/* Bytes Queued Meanwhile Keep The Bus , The Next Empty FIFO Enables This Interrupt Again */
+			if (Local_pHandle->TxFifo.Head == Local_pHandle->TxFifo.Tail)
+			{
+				USART_DriverEnable(USARTNum, 0);
+			}
+		}
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Load The Next Byte of an Interrupt Driven Scatter Gather Transmission
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : void
+ * @note   : Called on TXE , Empty Segments Are Skipped & Transmission Complete Interrupt Takes Over After The Last Byte ( Private Function )
+ */
+static void USART_SendNextSegmentByte(USART_t USARTNum)
+{
+	USART_SegmentsState_t *Local_pState = &USART_Handle[USARTNum].Segments;
+
+	/* Skip Finished & Empty Segments */
+	while (Local_pState->Index < Local_pState->Count && Local_pState->Offset >= Local_pState->Segments[Local_pState->Index].Length)
+	{
+		Local_pState->Index++;
+		Local_pState->Offset = 0;
+	}
+
+	if (Local_pState->Index < Local_pState->Count)
+	{
+		/* Send Next Byte */
+		USART[USARTNum]->DR = Local_pState->Segments[Local_pState->Index].Data[Local_pState->Offset++];
+	}
+	else
+	{
+		/* All Bytes Are Loaded , Wait For The Last One to Leave The Shift Register */
+		USART[USARTNum]->CR1 &= (~(1 << TXEIE));
+		USART[USARTNum]->CR1 |= (1 << TRANS_CIE);
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Drive The RS-485 Driver Enable Pin of a USART Peripheral IF One is Set
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Level => This Parameter is Used to Pass The Pin Level , 1 to Transmit & 0 to Receive
+ * @return : void
+ * @note   : Does Nothing IF USART_SetDriverEnablePin Was Not Called For This USART ( Private Function )
+ */
+static void USART_DriverEnable(USART_t USARTNum, uint8_t Level)
+{
+	if (USART_Handle[USARTNum].DEState == USART_DE_EN)
+	{
+		GPIO_u8SetPinValue((Port_t)USART_Handle[USARTNum].DEPort, (Pin_t)USART_Handle[USARTNum].DEPin, (Level != 0) ? PIN_HIGH : PIN_LOW);
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Handle The End of a USART DMA Transfer ( Transfer Complete or Transfer Error )
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Direction => This Parameter is Used to Select The Finished Transfer Direction -> @USART_DMA_DIR_t
+ * @return : void
+ * @note   : This Function is Called From The DMA Stream Call Backs Registered by The USART Driver ( Private Function )
+ */
+static void USART_DMA_HANDLE_IT(USART_t USARTNum, USART_DMA_DIR_t Direction)
+{
+	DMA_INIT_STRUCT_t *Local_pDMAConfig = (Direction == USART_DMA_TX) ? &USART_DMA_TxConfig[USARTNum] : &USART_DMA_RxConfig[USARTNum];
+
+	uint16_t Local_u16Remaining = 0;
+
+	/* Circular Reception Keeps Running , Half & Full Ring Events Only Report The New Bytes */
+	if (Direction == USART_DMA_RX && USART_Handle[USARTNum].DMARxState == USART_DMA_RX_TO_IDLE)
+	{
+		USART_RxToIdleEvent(USARTNum);
+	}
+	else if ((Direction == USART_DMA_TX && USART_Handle[USARTNum].DMATxState != USART_DMA_BUSY) ||
+			 (Direction == USART_DMA_RX && USART_Handle[USARTNum].DMARxState != USART_DMA_BUSY))
+	{
+		/* Late Stream Event of a Transfer Already Reported , Nothing Left to Do */
+	}
+	else
+	{
+		/* Stream is Disabled by Hardware in Both Cases , Data Left Means The Transfer Was Stopped by an Error */
+		DMA_GetRemainingDataCount(Local_pDMAConfig->DMAController, Local_pDMAConfig->StreamNumber, &Local_u16Remaining);
+
+		/* Disable DMA Request & Release The Direction */
+		if (Direction == USART_DMA_TX)
+		{
+			USART[USARTNum]->CR3 &= (~(1 << DMAT));
+			USART_Handle[USARTNum].DMATxState = USART_DMA_IDLE;
+		}
+		else
+		{
+			USART[USARTNum]->CR3 &= (~(1 << DMAR));
+			USART_Handle[USARTNum].DMARxState = USART_DMA_IDLE;
+		}
+
+		if (Direction == USART_DMA_TX && USART_Handle[USARTNum].DEState == USART_DE_EN && Local_u16Remaining == 0)
+		{
+			/* RS-485 Bus is Released on USART Transmission Complete , Which Reports Completion Instead */
+			USART_Handle[USARTNum].DMATxState = USART_DMA_TX_DRAINING;
+
+			USART[USARTNum]->CR1 |= (1 << TRANS_CIE);
+		}
+		else if (Local_u16Remaining != 0)
+		{
+			/* Transfer Stopped , Release The RS-485 Bus Right Away */
+			if (Direction == USART_DMA_TX)
+			{
+				USART_DriverEnable(USARTNum, 0);
+			}
+
+			if (USART_DMA_ErrorCallBack[USARTNum][Direction] != NULL)
+			{
+				USART_DMA_ErrorCallBack[USARTNum][Direction]();
+			}
+		}
+		else if (USART_DMA_CallBack[USARTNum][Direction] != NULL)
+		{
+			USART_DMA_CallBack[USARTNum][Direction]();
+		}
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Report The Bytes Received Since The Previous Receive To IDLE Event
+ *
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : void
+ * @note   : Called on IDLE Line Detection & on DMA Half / Full Ring Events So Long Messages Are Reported Before They Get Overwritten
+ */
+static void USART_RxToIdleEvent(USART_t USARTNum)
+{
+	USART_RxToIdle_t *Local_pRing = &USART_Handle[USARTNum].RxToIdle;
+
+	uint16_t Local_u16Remaining = 0;
+	uint16_t Local_u16WriteIndex = 0;
+
+	/* DMA Write Position = Ring Size - Remaining Count ( Remaining Count Reloads to Ring Size After Wrapping ) */
+	DMA_GetRemainingDataCount(USART_DMA_MAP[USARTNum].DMAController, USART_DMA_MAP[USARTNum].RxStream, &Local_u16Remaining);
+
+	Local_u16WriteIndex = (uint16_t)((Local_pRing->RingSize - Local_u16Remaining) % Local_pRing->RingSize);
+
+	/* Nothing New Since The Previous Event ( e.g. IDLE Right After a Half / Full Ring Event ) */
+	if (Local_u16WriteIndex != Local_pRing->LastIndex)
+	{
+		/* Half & Full Ring Events Bound The Distance Between Two Events to Half a Ring , So The Modulo Never Hides a Lap */
+		Local_pRing->WriteCount += (uint16_t)((Local_u16WriteIndex + Local_pRing->RingSize - Local_pRing->LastIndex) % Local_pRing->RingSize);
+		Local_pRing->LastIndex = Local_u16WriteIndex;
+
+		if (USART_DMA_CallBack[USARTNum][USART_DMA_RX] != NULL)
+		{
+			USART_DMA_CallBack[USARTNum][USART_DMA_RX]();
+		}
+	}
+}
+
+/*==============================================================================================================================================
+ * DMA CALL BACKS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+static void USART1_DMA_TxHandler(void)
+{
+	USART_DMA_HANDLE_IT(USART_PERIPH_1, USART_DMA_TX);
+}
+
+static void USART1_DMA_RxHandler(void)
+{
+	USART_DMA_HANDLE_IT(USART_PERIPH_1, USART_DMA_RX);
+}
+
+static void USART2_DMA_TxHandler(void)
+{
+	USART_DMA_HANDLE_IT(USART_PERIPH_2, USART_DMA_TX);
+}
+
+static void USART2_DMA_RxHandler(void)
+{
+	USART_DMA_HANDLE_IT(USART_PERIPH_2, USART_DMA_RX);
+}
+
+static void USART3_DMA_TxHandler(void)
+{
+	USART_DMA_HANDLE_IT(USART_PERIPH_3, USART_DMA_TX);
+}
+
+static void USART3_DMA_RxHandler(void)
+{
+	USART_DMA_HANDLE_IT(USART_PERIPH_3, USART_DMA_RX);
+}
+
+static void UART4_DMA_TxHandler(void)
+{
+	USART_DMA_HANDLE_IT(UART_PERIPH_4, USART_DMA_TX);
+}
+
+static void UART4_DMA_RxHandler(void)
+{
+	USART_DMA_HANDLE_IT(UART_PERIPH_4, USART_DMA_RX);
+}
+
+static void UART5_DMA_TxHandler(void)
+{
+	USART_DMA_HANDLE_IT(UART_PERIPH_5, USART_DMA_TX);
+}
+
+static void UART5_DMA_RxHandler(void)
+{
+	USART_DMA_HANDLE_IT(UART_PERIPH_5, USART_DMA_RX);
+}
+
+static void USART6_DMA_TxHandler(void)
+{
+	USART_DMA_HANDLE_IT(USART_PERIPH_6, USART_DMA_TX);
+}
+
+static void USART6_DMA_RxHandler(void)
+{
+	USART_DMA_HANDLE_IT(USART_PERIPH_6, USART_DMA_RX);
 }
 
 /*==============================================================================================================================================